@@ -78,6 +78,11 @@ int entry(int argc, char **argv)
     .help("Single optional argument for bisection method. "
           "Whether input node should be quantized to Q16: 'auto', 'true', 'false'.");
 
+  arser.add_argument("--num_threads")
+    .type(arser::DataType::INT32)
+    .default_value(1)
+    .help("Number of candidates evaluated concurrently by bisection (default: 1)");
+
   arser.add_argument(patterns_str)
     .nargs(0)
     .required(false)
@@ -221,6 +226,14 @@ int entry(int argc, char **argv)
       std::make_unique<mpqsolver::core::H5FileDataProvider>(data_path, input_model_path);
     bi_solver->setInputData(std::move(input_data));
 
+    auto num_threads = arser.get<int>("--num_threads");
+    if (num_threads < 1)
+    {
+      std::cerr << "ERROR: the number of threads must be greater than zero" << std::endl;
+      return EXIT_FAILURE;
+    }
+    bi_solver->setNumThreads(static_cast<uint32_t>(num_threads));
+
     {
       auto value = arser.get<std::string>(bisection_str);
       if (value == "auto")
@@ -24,8 +24,14 @@
 
 #include <luci/ImporterEx.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <thread>
 
 using namespace mpqsolver::bisection;
 
@@ -73,6 +79,50 @@ bool front_has_higher_error(const NodeDepthType &nodes_depth, const std::string
   return error_at_input > error_at_output;
 }
 
+/**
+ * @brief Collect cut depths which bisection visits from [min_depth, max_depth] in the next
+ *        lookahead + 1 iterations, whatever errors are
+ */
+void collect_cuts(float min_depth, float max_depth, int last_depth, bool int16_front,
+                  uint32_t lookahead, std::vector<int> &cuts)
+{
+  int cut_depth = static_cast<int>(std::floor(0.5f * (min_depth + max_depth)));
+  if (cut_depth == last_depth)
+    return;
+
+  if (std::find(cuts.begin(), cuts.end(), cut_depth) == cuts.end())
+    cuts.push_back(cut_depth);
+
+  if (lookahead == 0)
+    return;
+
+  // Error at cut_depth is less than target, and vice versa
+  if (int16_front)
+  {
+    collect_cuts(min_depth, cut_depth, cut_depth, int16_front, lookahead - 1, cuts);
+    collect_cuts(cut_depth, max_depth, cut_depth, int16_front, lookahead - 1, cuts);
+  }
+  else
+  {
+    collect_cuts(cut_depth, max_depth, cut_depth, int16_front, lookahead - 1, cuts);
+    collect_cuts(min_depth, cut_depth, cut_depth, int16_front, lookahead - 1, cuts);
+  }
+}
+
+std::vector<char> read_file(const std::string &path)
+{
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (file.fail())
+    throw std::runtime_error("Failed to open " + path);
+
+  std::vector<char> data(static_cast<size_t>(file.tellg()));
+  file.seekg(0, std::ios::beg);
+  if (file.read(data.data(), data.size()).fail())
+    throw std::runtime_error("Failed to read " + path);
+
+  return data;
+}
+
 } // namespace
 
 BisectionSolver::BisectionSolver(const mpqsolver::core::Quantizer::Context &ctx, float qerror_ratio)
@@ -80,26 +130,69 @@ BisectionSolver::BisectionSolver(const mpqsolver::core::Quantizer::Context &ctx,
 {
 }
 
-float BisectionSolver::evaluate(const core::DatasetEvaluator &evaluator,
-                                const std::string &flt_path, const std::string &def_quant,
-                                core::LayerParams &layers)
+std::vector<float> BisectionSolver::evaluate(const core::DatasetEvaluator &evaluator,
+                                             const std::vector<Candidate> &candidates)
 {
-  auto model = readModule(flt_path);
-  assert(model != nullptr);
+  std::vector<float> errors(candidates.size());
+  std::vector<std::exception_ptr> exceptions(candidates.size());
+  std::atomic<size_t> next(0);
+
+  auto worker = [&]() {
+    // Hooks are not called here, because candidates are evaluated out of order
+    core::Quantizer quantizer(_quantizer->getContext());
+    for (size_t index = next++; index < candidates.size(); index = next++)
+    {
+      try
+      {
+        luci::ImporterEx importer;
+        auto model = importer.importModule(_model_data);
+        if (model == nullptr)
+          throw std::runtime_error("Failed to load model");
+
+        // get fake quantized model for evaluation
+        auto layers = candidates[index].layers;
+        if (!quantizer.fakeQuantize(model.get(), candidates[index].def_quant, layers))
+        {
+          throw std::runtime_error("Failed to produce fake-quantized model.");
+        }
+
+        errors[index] = evaluator.evaluate(model.get());
+      }
+      catch (...)
+      {
+        exceptions[index] = std::current_exception();
+      }
+    }
+  };
 
-  // get fake quantized model for evaluation
-  if (!_quantizer->fakeQuantize(model.get(), def_quant, layers))
+  const auto num_threads = std::min<size_t>(_num_threads, candidates.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < num_threads; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (auto &thread : threads)
+    thread.join();
+
+  for (const auto &exception : exceptions)
   {
-    throw std::runtime_error("Failed to produce fake-quantized model.");
+    if (exception)
+      std::rethrow_exception(exception);
   }
 
-  return evaluator.evaluate(model.get());
+  return errors;
 }
 
 void BisectionSolver::algorithm(Algorithm algorithm) { _algorithm = algorithm; }
 
 void BisectionSolver::setVisqPath(const std::string &visq_path) { _visq_data_path = visq_path; }
 
+void BisectionSolver::setNumThreads(uint32_t num_threads)
+{
+  if (num_threads == 0)
+    throw std::runtime_error("The number of threads must be greater than zero");
+  _num_threads = num_threads;
+}
+
 void BisectionSolver::setInputData(std::unique_ptr<mpqsolver::core::DataProvider> &&data)
 {
   _input_data = std::move(data);
@@ -109,6 +202,8 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
 {
   auto module = readModule(module_path);
   assert(module != nullptr);
+  // Candidates are imported from memory
+  _model_data = read_file(module_path);
 
   float min_depth = 0.f;
   float max_depth = 0.f;
@@ -130,12 +225,13 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
   core::DatasetEvaluator evaluator(module.get(), *_input_data.get(), *metric.get());
 
   core::LayerParams layer_params;
-  float int16_qerror =
-    evaluate(evaluator, module_path, "int16" /* default quant_dtype */, layer_params);
+  const auto baseline_qerrors =
+    evaluate(evaluator, {{"int16" /* default quant_dtype */, layer_params},
+                         {"uint8" /* default quant_dtype */, layer_params}});
+  float int16_qerror = baseline_qerrors[0];
   SolverOutput::get() << "Full int16 model qerror: " << int16_qerror << "\n";
 
-  float uint8_qerror =
-    evaluate(evaluator, module_path, "uint8" /* default quant_dtype */, layer_params);
+  float uint8_qerror = baseline_qerrors[1];
   SolverOutput::get() << "Full uint8 model qerror: " << uint8_qerror << "\n";
   _quantizer->setHook(_hooks.get());
   if (_hooks)
@@ -229,25 +325,7 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
 
   SolverOutput::get() << "\n";
 
-  while (true)
-  {
-    int cut_depth = static_cast<int>(std::floor(0.5f * (min_depth + max_depth)));
-
-    if (last_depth == cut_depth)
-    {
-      break;
-    }
-
-    if (_hooks)
-    {
-      _hooks->onBeginIteration();
-    }
-
-    SolverOutput::get() << "Looking for the optimal configuration in [" << min_depth << " , "
-                        << max_depth << "] depth segment\n";
-
-    last_depth = cut_depth;
-
+  auto make_layer_params = [&](int cut_depth) {
     core::LayerParams layer_params;
     for (auto &node : active_nodes)
     {
@@ -272,8 +350,63 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
         layer_params.emplace_back(layer_param);
       }
     }
+    return layer_params;
+  };
+
+  // Iterations which can be evaluated together, e.g. 1 for 3 threads and 2 for 7 threads
+  uint32_t lookahead = 0;
+  while ((2u << (lookahead + 1)) - 1 <= _num_threads)
+    ++lookahead;
+
+  // qerrors of cut depths, some of which are evaluated before their iterations
+  std::map<int, float> cut_errors;
+
+  while (true)
+  {
+    int cut_depth = static_cast<int>(std::floor(0.5f * (min_depth + max_depth)));
+
+    if (last_depth == cut_depth)
+    {
+      break;
+    }
+
+    if (cut_errors.find(cut_depth) == cut_errors.end())
+    {
+      std::vector<int> cuts;
+      collect_cuts(min_depth, max_depth, last_depth, int16_front, lookahead, cuts);
 
-    float cur_error = evaluate(evaluator, module_path, "uint8", layer_params);
+      std::vector<Candidate> candidates;
+      for (auto cut : cuts)
+        candidates.push_back({"uint8", make_layer_params(cut)});
+
+      const auto errors = evaluate(evaluator, candidates);
+      for (size_t i = 0; i < cuts.size(); ++i)
+        cut_errors[cuts[i]] = errors[i];
+    }
+
+    if (_hooks)
+    {
+      _hooks->onBeginIteration();
+    }
+
+    SolverOutput::get() << "Looking for the optimal configuration in [" << min_depth << " , "
+                        << max_depth << "] depth segment\n";
+
+    last_depth = cut_depth;
+
+    core::LayerParams layer_params = make_layer_params(cut_depth);
+
+    float cur_error = cut_errors[cut_depth];
+
+    if (_hooks)
+    {
+      // Quantized model of this iteration is passed to hooks
+      auto model = luci::ImporterEx().importModule(_model_data);
+      if (model == nullptr || !_quantizer->quantize(model.get(), "uint8", layer_params))
+      {
+        throw std::runtime_error("Failed to quantize model.");
+      }
+    }
 
     if (_hooks)
     {
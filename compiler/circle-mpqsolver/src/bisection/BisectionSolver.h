@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace mpqsolver
 {
@@ -76,9 +77,26 @@ public:
    */
   void setVisqPath(const std::string &visq_path);
 
+  /**
+   * @brief   set the number of candidates which are evaluated concurrently
+   * @details bisection evaluates cut depths of next iterations ahead as many as num_threads
+   *          allows, so the solver finds the same configuration with fewer rounds.
+   */
+  void setNumThreads(uint32_t num_threads);
+
 private:
-  float evaluate(const core::DatasetEvaluator &evaluator, const std::string &module_path,
-                 const std::string &def_quant, core::LayerParams &layers);
+  struct Candidate
+  {
+    std::string def_quant;
+    core::LayerParams layers;
+  };
+
+  /**
+   * @brief return qerrors of candidates, which are evaluated concurrently
+   * @note  each candidate is imported from _model_data, not from the file
+   */
+  std::vector<float> evaluate(const core::DatasetEvaluator &evaluator,
+                              const std::vector<Candidate> &candidates);
 
 private:
   const float _qerror_ratio = 0.f; // quantization error ratio
@@ -86,6 +104,9 @@ private:
   Algorithm _algorithm = Algorithm::ForceQ16Front;
   std::string _visq_data_path;
   std::unique_ptr<mpqsolver::core::DataProvider> _input_data;
+  uint32_t _num_threads = 1;
+  // Contents of the float module file
+  std::vector<char> _model_data;
 };
 
 } // namespace bisection
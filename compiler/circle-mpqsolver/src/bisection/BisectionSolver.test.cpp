@@ -24,6 +24,11 @@
 #include <luci/CircleExporter.h>
 #include <luci/CircleFileExpContract.h>
 
+#include <ftw.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
 namespace
 {
 
@@ -44,6 +49,64 @@ protected:
   std::string _module_path;
 };
 
+class TemporaryFolder
+{
+public:
+  explicit TemporaryFolder(const char *name_template)
+  {
+    std::string name = name_template;
+    _path = mpqsolver::test::io_utils::makeTemporaryFolder(&name[0]);
+  }
+
+  ~TemporaryFolder()
+  {
+    auto callback = [](const char *child, const struct stat *, int, struct FTW *) {
+      return remove(child);
+    };
+    nftw(_path.c_str(), callback, 128, FTW_DEPTH | FTW_MOUNT | FTW_PHYS);
+  }
+
+  const std::string &path() const { return _path; }
+
+private:
+  std::string _path;
+};
+
+std::string readFile(const std::string &path)
+{
+  std::ifstream file(path);
+  EXPECT_TRUE(file.good()) << path;
+  std::stringstream ss;
+  ss << file.rdbuf();
+  return ss.str();
+}
+
+void expectSameQuantization(luci::Module *expected, luci::Module *actual)
+{
+  ASSERT_EQ(expected->size(), actual->size());
+  for (size_t g = 0; g < expected->size(); ++g)
+  {
+    auto expected_nodes = expected->graph(g)->nodes();
+    auto actual_nodes = actual->graph(g)->nodes();
+    ASSERT_EQ(expected_nodes->size(), actual_nodes->size());
+    for (uint32_t n = 0; n < expected_nodes->size(); ++n)
+    {
+      auto expected_node = loco::must_cast<luci::CircleNode *>(expected_nodes->at(n));
+      auto actual_node = loco::must_cast<luci::CircleNode *>(actual_nodes->at(n));
+      EXPECT_EQ(expected_node->name(), actual_node->name());
+      EXPECT_EQ(expected_node->dtype(), actual_node->dtype());
+
+      auto expected_qparam = expected_node->quantparam();
+      auto actual_qparam = actual_node->quantparam();
+      ASSERT_EQ(expected_qparam == nullptr, actual_qparam == nullptr);
+      if (expected_qparam == nullptr)
+        continue;
+      EXPECT_EQ(expected_qparam->scale, actual_qparam->scale);
+      EXPECT_EQ(expected_qparam->zerop, actual_qparam->zerop);
+    }
+  }
+}
+
 } // namespace
 
 TEST_F(CircleMPQSolverBisectionSolverTestF, verifyResultsTest)
@@ -71,6 +134,56 @@ TEST_F(CircleMPQSolverBisectionSolverTestF, verifyResultsTest)
   EXPECT_TRUE(res.get() != nullptr);
 }
 
+TEST_F(CircleMPQSolverBisectionSolverTestF, verifyResultsMultiThreadsTest)
+{
+  // create network
+  auto m = luci::make_module();
+  _g.init();
+  _g.transfer_to(m.get());
+
+  // export to _module_path
+  luci::CircleExporter exporter;
+  luci::CircleFileExpContract contract(m.get(), _module_path);
+  EXPECT_TRUE(exporter.invoke(&contract));
+
+  SolverOutput::get().TurnOn(false);
+
+  // run solver with the same model and inputs, sequentially and concurrently
+  auto run_solver = [this](uint32_t num_threads, const std::string &save_path) {
+    mpqsolver::core::Quantizer::Context ctx;
+    mpqsolver::bisection::BisectionSolver solver(ctx, 0.5);
+    auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+    solver.setInputData(std::move(data));
+    solver.algorithm(mpqsolver::bisection::BisectionSolver::Algorithm::ForceQ16Front);
+    solver.setNumThreads(num_threads);
+    solver.setSaveIntermediate(save_path);
+    return solver.run(_module_path);
+  };
+
+  TemporaryFolder single_dir("CircleMPQSolverBisectionSolverTest-SINGLE-XXXXXX");
+  TemporaryFolder multi_dir("CircleMPQSolverBisectionSolverTest-MULTI-XXXXXX");
+  auto single_res = run_solver(1, single_dir.path());
+  auto multi_res = run_solver(3, multi_dir.path());
+  ASSERT_TRUE(single_res.get() != nullptr);
+  ASSERT_TRUE(multi_res.get() != nullptr);
+
+  // chosen layer params and qerrors should be the same
+  const std::string final_mpq = "/FinalConfiguration.mpq.json";
+  const std::string errors = "/errors.mpq.txt";
+  EXPECT_EQ(readFile(single_dir.path() + final_mpq), readFile(multi_dir.path() + final_mpq));
+  EXPECT_EQ(readFile(single_dir.path() + errors), readFile(multi_dir.path() + errors));
+
+  // quantized models should be the same
+  expectSameQuantization(single_res.get(), multi_res.get());
+}
+
+TEST(CircleMPQSolverBisectionSolverTest, num_threads_NEG)
+{
+  mpqsolver::core::Quantizer::Context ctx;
+  mpqsolver::bisection::BisectionSolver solver(ctx, 0.0);
+  EXPECT_ANY_THROW(solver.setNumThreads(0));
+}
+
 TEST(CircleMPQSolverBisectionSolverTest, empty_path_NEG)
 {
   mpqsolver::core::Quantizer::Context ctx;
@@ -41,7 +41,7 @@ template <typename NodeT> size_t get_tensor_size(const NodeT *node)
   return tensor_size;
 }
 
-WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data_provider)
+Inputs read_inputs(const luci::Module *module, const DataProvider *data_provider)
 {
   if (data_provider == nullptr)
   {
@@ -54,10 +54,7 @@ WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data
   const auto input_nodes = loco::input_nodes(module->graph());
   const auto num_inputs = input_nodes.size();
 
-  WholeOutput dataset_output;
-
-  // Create interpreter.
-  luci_interpreter::Interpreter interpreter(module);
+  Inputs inputs(num_records);
   for (uint32_t record_idx = 0; record_idx < num_records; record_idx++)
   {
     if (num_inputs != data_provider->numInputs(record_idx))
@@ -69,8 +66,37 @@ WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data
 
       InputData input_data(get_tensor_size(input_node));
       data_provider->getSampleInput(record_idx, input_idx, input_data);
+      inputs[record_idx].emplace_back(std::move(input_data));
+    }
+  }
+
+  return inputs;
+}
+
+WholeOutput compute_outputs(const luci::Module *module, const Inputs &inputs)
+{
+  const auto input_nodes = loco::input_nodes(module->graph());
+  const auto num_inputs = input_nodes.size();
+
+  WholeOutput dataset_output;
+
+  // Create interpreter.
+  luci_interpreter::Interpreter interpreter(module);
+  interpreter.enableStaticPlan();
+  for (const auto &record : inputs)
+  {
+    if (num_inputs != record.size())
+      throw std::runtime_error("Wrong number of inputs.");
+    for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+    {
+      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+      assert(input_node->index() == input_idx);
+
+      const auto &input_data = record[input_idx].data();
+      if (input_data.size() != get_tensor_size(input_node))
+        throw std::runtime_error("Input size mismatch.");
 
-      interpreter.writeInputTensor(input_node, input_data.data().data(), input_data.data().size());
+      interpreter.writeInputTensor(input_node, input_data.data(), input_data.size());
     }
 
     interpreter.interpret();
@@ -99,7 +125,8 @@ DatasetEvaluator::DatasetEvaluator(const luci::Module *ref_module, const DataPro
                                    const ErrorMetric &metric)
   : _ref_module(ref_module), _provider(&provider), _metric(&metric)
 {
-  _ref_output = compute_outputs(_ref_module, _provider);
+  _inputs = read_inputs(_ref_module, _provider);
+  _ref_output = compute_outputs(_ref_module, _inputs);
 }
 
 void DatasetEvaluator::validate(const luci::Module *trgt_fq_module) const
@@ -124,7 +151,7 @@ float DatasetEvaluator::evaluate(const luci::Module *trgt_fq_module) const
 
   validate(trgt_fq_module);
 
-  const WholeOutput &cur_output = compute_outputs(trgt_fq_module, _provider);
+  const WholeOutput &cur_output = compute_outputs(trgt_fq_module, _inputs);
   float error = _metric->compute(_ref_output, cur_output);
   return error;
 }
@@ -32,11 +32,15 @@ namespace mpqsolver
 namespace core
 {
 
+// Input data of every record
+using Inputs = std::vector<std::vector<InputData>>;
+
 class DatasetEvaluator final
 {
 public:
   /**
    * @brief create Evaluator for comparing output of ref_module on provider
+   * @note  inputs are read from provider only once, and outputs of ref_module are kept
    */
   DatasetEvaluator(const luci::Module *ref_module, const DataProvider &provider,
                    const ErrorMetric &metric);
@@ -46,6 +50,7 @@ public:
   /**
    * @brief evaluate trgt_fq_module (fake-quantized)
    * returns error-metric
+   * @note  different modules can be evaluated concurrently
    */
   float evaluate(const luci::Module *trgt_fq_module) const;
 
@@ -58,6 +63,7 @@ private:
 private:
   const luci::Module *_ref_module = nullptr;
   const DataProvider *_provider = nullptr;
+  Inputs _inputs;
   WholeOutput _ref_output;
   const ErrorMetric *_metric = nullptr;
 };
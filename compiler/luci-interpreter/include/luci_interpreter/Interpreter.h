@@ -64,6 +64,11 @@ public:
 
   void interpret();
 
+  // Configure kernels once and reuse their memory in later interpret() calls. Kernels are
+  // configured again only if their inputs change in shape or in short values such as shapes
+  // and axes. This is for models which are interpreted many times, e.g. for calibration.
+  void enableStaticPlan();
+
   void attachObserver(ExecutionObserver *observer);
 
   const Tensor *getTensor(const loco::Node *node) { return _node_to_tensor[node]; }
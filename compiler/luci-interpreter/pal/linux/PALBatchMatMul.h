@@ -19,14 +19,71 @@
 
 #include <tensorflow/lite/kernels/internal/reference/batch_matmul.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
+/**
+ * @brief BatchMatMul whose output columns are split over the thread pool
+ *
+ * A unit is a column of an output matrix, i.e. a row of a rhs matrix which is stored transposed.
+ * Batch dims are broadcast as the reference kernel does, and each range in a batch is given to the
+ * reference kernel as a single matrix multiplication with a slice of rhs rows.
+ */
 inline void BatchMatMul(const tflite::RuntimeShape &lhs_shape, const float *lhs_data,
                         const tflite::RuntimeShape &rhs_shape, const float *rhs_data,
                         const tflite::RuntimeShape &output_shape, float *output_data)
 {
-  tflite::reference_ops::BatchMatMul(lhs_shape, lhs_data, rhs_shape, rhs_data, output_shape,
-                                     output_data);
+  const tflite::RuntimeShape extended_lhs_shape = tflite::RuntimeShape::ExtendedShape(5, lhs_shape);
+  const tflite::RuntimeShape extended_rhs_shape = tflite::RuntimeShape::ExtendedShape(5, rhs_shape);
+
+  int batch_dims[3];
+  int lhs_strides[3];
+  int rhs_strides[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    batch_dims[i] = std::max(extended_lhs_shape.Dims(i), extended_rhs_shape.Dims(i));
+    // Broadcast batch dims are not advanced
+    lhs_strides[i] = extended_lhs_shape.Dims(i) == 1 ? 0 : 1;
+    rhs_strides[i] = extended_rhs_shape.Dims(i) == 1 ? 0 : 1;
+    for (int j = i + 1; j < 5; ++j)
+    {
+      lhs_strides[i] *= extended_lhs_shape.Dims(j);
+      rhs_strides[i] *= extended_rhs_shape.Dims(j);
+    }
+  }
+
+  const int lhs_rows = extended_lhs_shape.Dims(3);
+  const int rhs_cols = extended_rhs_shape.Dims(4);
+  const int accum_depth = extended_lhs_shape.Dims(4);
+  const tflite::RuntimeShape matrix_lhs_shape{lhs_rows, accum_depth};
+
+  auto columns = [&](int start, int end) {
+    for (int unit = start; unit < end;)
+    {
+      const int batch = unit / rhs_cols;
+      const int col_start = unit % rhs_cols;
+      const int col_end = std::min(rhs_cols, col_start + (end - unit));
+      const int b0 = batch / (batch_dims[1] * batch_dims[2]);
+      const int b1 = batch / batch_dims[2] % batch_dims[1];
+      const int b2 = batch % batch_dims[2];
+      const float *lhs_ptr =
+        lhs_data + b0 * lhs_strides[0] + b1 * lhs_strides[1] + b2 * lhs_strides[2];
+      const float *rhs_ptr =
+        rhs_data + b0 * rhs_strides[0] + b1 * rhs_strides[1] + b2 * rhs_strides[2];
+      const int cols = col_end - col_start;
+      tflite::reference_ops::BatchMatMul(matrix_lhs_shape, lhs_ptr,
+                                         tflite::RuntimeShape{accum_depth, cols},
+                                         rhs_ptr + col_start * accum_depth,
+                                         tflite::RuntimeShape{cols, lhs_rows},
+                                         output_data + (batch * rhs_cols + col_start) * lhs_rows);
+      unit += cols;
+    }
+  };
+  (void)output_shape;
+  const int batches = batch_dims[0] * batch_dims[1] * batch_dims[2];
+  ThreadPool::get().parallelFor(batches * rhs_cols, static_cast<int64_t>(lhs_rows) * accum_depth,
+                                columns);
 }
 
 static inline void SetupScratchpadTensor(luci_interpreter::Tensor *lhs_scratchpad,
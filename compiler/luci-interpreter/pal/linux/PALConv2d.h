@@ -20,6 +20,8 @@
 #include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/conv.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
 static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeShape &input_shape,
@@ -52,19 +54,36 @@ static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeS
   // NOTE This is just a rough check.
   bool opt_kernel_overflow = im2col_flat_size > std::numeric_limits<int32_t>::max();
 
+  const int64_t cost_per_row = static_cast<int64_t>(output_width) * output_shape.Dims(3) *
+                               input_depth * filter_height * filter_width;
+  // Output rows are split over the thread pool, and each band has its own part of im2col
   if (scratchpad_data and not opt_kernel_overflow)
   {
-    tflite::RuntimeShape im2col_shape{batches, output_height, output_width,
-                                      input_depth * filter_height * filter_width};
-
-    tflite::optimized_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                                bias_shape, bias_data, output_shape, output_data, im2col_shape,
-                                scratchpad_data);
+    const int32_t im2col_depth = input_depth * filter_height * filter_width;
+    ParallelConvRows(
+      params, filter_height, input_shape, output_shape, cost_per_row,
+      [&](const tflite::ConvParams &band_params, const tflite::RuntimeShape &band_input_shape,
+          int input_offset, const tflite::RuntimeShape &band_output_shape, int output_offset,
+          int first_row) {
+        tflite::RuntimeShape im2col_shape{1, band_output_shape.Dims(1), output_width,
+                                          im2col_depth};
+        tflite::optimized_ops::Conv(
+          band_params, band_input_shape, input_data + input_offset, filter_shape, filter_data,
+          bias_shape, bias_data, band_output_shape, output_data + output_offset, im2col_shape,
+          scratchpad_data + static_cast<int64_t>(first_row) * output_width * im2col_depth);
+      });
   }
   else
-    tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                                bias_shape, bias_data, output_shape, output_data,
-                                tflite::RuntimeShape(), nullptr);
+    ParallelConvRows(
+      params, filter_height, input_shape, output_shape, cost_per_row,
+      [&](const tflite::ConvParams &band_params, const tflite::RuntimeShape &band_input_shape,
+          int input_offset, const tflite::RuntimeShape &band_output_shape, int output_offset,
+          int) {
+        tflite::reference_ops::Conv(band_params, band_input_shape, input_data + input_offset,
+                                    filter_shape, filter_data, bias_shape, bias_data,
+                                    band_output_shape, output_data + output_offset,
+                                    tflite::RuntimeShape(), nullptr);
+      });
 }
 
 static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeShape &input_shape,
@@ -74,14 +93,21 @@ static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeS
                         uint8 *output_data, const tflite::RuntimeShape &scratchpad_shape,
                         uint8 *scratchpad_data)
 {
-  // TODO This should only be done once (although it takes only a few microseconds).
-  //  Also, the user should be able to adjust the number of threads.
-  auto gemmlowp_context = std::make_unique<gemmlowp::GemmContext>();
-  gemmlowp_context->set_max_num_threads(static_cast<int>(std::thread::hardware_concurrency()));
-
-  tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                              bias_shape, bias_data, output_shape, output_data, scratchpad_shape,
-                              scratchpad_data, gemmlowp_context.get());
+  (void)scratchpad_shape;
+  (void)scratchpad_data;
+
+  const int64_t cost_per_row = static_cast<int64_t>(output_shape.Dims(2)) * output_shape.Dims(3) *
+                               filter_shape.FlatSize() / filter_shape.Dims(0);
+  ParallelConvRows(
+    params, filter_shape.Dims(1), input_shape, output_shape, cost_per_row,
+    [&](const tflite::ConvParams &band_params, const tflite::RuntimeShape &band_input_shape,
+        int input_offset, const tflite::RuntimeShape &band_output_shape, int output_offset, int) {
+      // The reference kernel does not use im2col nor the gemmlowp context
+      tflite::reference_ops::Conv(band_params, band_input_shape, input_data + input_offset,
+                                  filter_shape, filter_data, bias_shape, bias_data,
+                                  band_output_shape, output_data + output_offset,
+                                  tflite::RuntimeShape(), nullptr, nullptr);
+    });
 }
 
 static inline void ConvPerChannel(const tflite::ConvParams &params, const int32_t *mult,
@@ -95,9 +121,16 @@ static inline void ConvPerChannel(const tflite::ConvParams &params, const int32_
   (void)scratchpad_shape;
   (void)scratchpad_data;
   // TODO enable optimized version
-  tflite::reference_integer_ops::ConvPerChannel(params, mult, shifts, input_shape, input_data,
-                                                filter_shape, filter_data, bias_shape, bias_data,
-                                                output_shape, output_data);
+  const int64_t cost_per_row = static_cast<int64_t>(output_shape.Dims(2)) * output_shape.Dims(3) *
+                               filter_shape.FlatSize() / filter_shape.Dims(0);
+  ParallelConvRows(
+    params, filter_shape.Dims(1), input_shape, output_shape, cost_per_row,
+    [&](const tflite::ConvParams &band_params, const tflite::RuntimeShape &band_input_shape,
+        int input_offset, const tflite::RuntimeShape &band_output_shape, int output_offset, int) {
+      tflite::reference_integer_ops::ConvPerChannel(
+        band_params, mult, shifts, band_input_shape, input_data + input_offset, filter_shape,
+        filter_data, bias_shape, bias_data, band_output_shape, output_data + output_offset);
+    });
 }
 
 static inline void SetupScratchpadTensor(luci_interpreter::Tensor *scratchpad,
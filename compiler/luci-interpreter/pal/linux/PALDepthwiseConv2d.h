@@ -21,8 +21,28 @@
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
+static inline void DepthwiseConv(const tflite::DepthwiseParams &params,
+                                 const tflite::RuntimeShape &input_shape, const float *input_data,
+                                 const tflite::RuntimeShape &filter_shape, const float *filter_data,
+                                 const tflite::RuntimeShape &bias_shape, const float *bias_data,
+                                 const tflite::RuntimeShape &output_shape, float *output_data)
+{
+  const int64_t cost_per_row = static_cast<int64_t>(output_shape.Dims(2)) * output_shape.Dims(3) *
+                               filter_shape.Dims(1) * filter_shape.Dims(2);
+  ParallelConvRows(
+    params, filter_shape.Dims(1), input_shape, output_shape, cost_per_row,
+    [&](const tflite::DepthwiseParams &band_params, const tflite::RuntimeShape &band_input_shape,
+        int input_offset, const tflite::RuntimeShape &band_output_shape, int output_offset, int) {
+      tflite::reference_ops::DepthwiseConv(band_params, band_input_shape, input_data + input_offset,
+                                           filter_shape, filter_data, bias_shape, bias_data,
+                                           band_output_shape, output_data + output_offset);
+    });
+}
+
 template <typename T>
 static inline void
 DepthwiseConvPerChannel(const tflite::DepthwiseParams &params, const int32_t *output_multiplier,
@@ -64,9 +84,17 @@ inline void DepthwiseConvPerChannel<int8_t>(
 {
   (void)scratchpad_shape;
   (void)scratchpad_data;
-  tflite::reference_integer_ops::DepthwiseConvPerChannel(
-    params, output_multiplier, output_shift, input_shape, input_data, filter_shape, filter_data,
-    bias_shape, bias_data, output_shape, output_data);
+  const int64_t cost_per_row = static_cast<int64_t>(output_shape.Dims(2)) * output_shape.Dims(3) *
+                               filter_shape.Dims(1) * filter_shape.Dims(2);
+  ParallelConvRows(
+    params, filter_shape.Dims(1), input_shape, output_shape, cost_per_row,
+    [&](const tflite::DepthwiseParams &band_params, const tflite::RuntimeShape &band_input_shape,
+        int input_offset, const tflite::RuntimeShape &band_output_shape, int output_offset, int) {
+      tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        band_params, output_multiplier, output_shift, band_input_shape, input_data + input_offset,
+        filter_shape, filter_data, bias_shape, bias_data, band_output_shape,
+        output_data + output_offset);
+    });
 }
 
 static inline void SetupScratchpadTensor(luci_interpreter::Tensor *scratchpad,
@@ -20,8 +20,65 @@
 #include <tensorflow/lite/kernels/internal/reference/fully_connected.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
+/**
+ * @brief Split output units of a fully connected over the thread pool
+ *
+ * A unit is an output unit of a batch. Units of a range in a batch are a fully connected with a
+ * single batch and a slice of filter rows, which fn computes by
+ *   fn(batch, filter_shape, filter_offset, output_shape, output_offset, bias_offset)
+ */
+template <typename Fn>
+inline void ParallelFullyConnected(const tflite::RuntimeShape &filter_shape,
+                                   const tflite::RuntimeShape &output_shape, const Fn &fn)
+{
+  const int output_dims_count = output_shape.DimensionsCount();
+  const int filter_dims_count = filter_shape.DimensionsCount();
+  const int batches = tflite::FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  const int output_depth = tflite::MatchingDim(filter_shape, filter_dims_count - 2, output_shape,
+                                               output_dims_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dims_count - 1);
+
+  auto units = [&](int start, int end) {
+    for (int unit = start; unit < end;)
+    {
+      const int batch = unit / output_depth;
+      const int out_start = unit % output_depth;
+      const int out_end = std::min(output_depth, out_start + (end - unit));
+      const int count = out_end - out_start;
+      fn(batch, tflite::RuntimeShape{count, accum_depth}, out_start * accum_depth,
+         tflite::RuntimeShape{1, count}, batch * output_depth + out_start, out_start);
+      unit += count;
+    }
+  };
+  ThreadPool::get().parallelFor(batches * output_depth, accum_depth, units);
+}
+
+static inline void
+FullyConnected(const tflite::FullyConnectedParams &params, const tflite::RuntimeShape &input_shape,
+               const float *input_data, const tflite::RuntimeShape &filter_shape,
+               const float *filter_data, const tflite::RuntimeShape &bias_shape,
+               const float *bias_data, const tflite::RuntimeShape &output_shape, float *output_data)
+{
+  (void)input_shape;
+  (void)bias_shape;
+  const int accum_depth = filter_shape.Dims(filter_shape.DimensionsCount() - 1);
+  ParallelFullyConnected(
+    filter_shape, output_shape,
+    [&](int batch, const tflite::RuntimeShape &slice_filter_shape, int filter_offset,
+        const tflite::RuntimeShape &slice_output_shape, int output_offset, int bias_offset) {
+      tflite::reference_ops::FullyConnected(
+        params, tflite::RuntimeShape{1, accum_depth}, input_data + batch * accum_depth,
+        slice_filter_shape, filter_data + filter_offset,
+        tflite::RuntimeShape{slice_output_shape.Dims(1)},
+        bias_data ? bias_data + bias_offset : nullptr, slice_output_shape,
+        output_data + output_offset);
+    });
+}
+
 template <typename T>
 static inline void FullyConnected(const tflite::FullyConnectedParams &params,
                                   const tflite::RuntimeShape &input_shape, const T *input_data,
@@ -52,9 +109,20 @@ FullyConnected<int8_t>(const tflite::FullyConnectedParams &params,
                        const tflite::RuntimeShape &bias_shape, const int32_t *bias_data,
                        const tflite::RuntimeShape &output_shape, int8_t *output_data)
 {
-  tflite::reference_integer_ops::FullyConnected(params, input_shape, input_data, filter_shape,
-                                                filter_data, bias_shape, bias_data, output_shape,
-                                                output_data);
+  (void)input_shape;
+  (void)bias_shape;
+  const int accum_depth = filter_shape.Dims(filter_shape.DimensionsCount() - 1);
+  ParallelFullyConnected(
+    filter_shape, output_shape,
+    [&](int batch, const tflite::RuntimeShape &slice_filter_shape, int filter_offset,
+        const tflite::RuntimeShape &slice_output_shape, int output_offset, int bias_offset) {
+      tflite::reference_integer_ops::FullyConnected(
+        params, tflite::RuntimeShape{1, accum_depth}, input_data + batch * accum_depth,
+        slice_filter_shape, filter_data + filter_offset,
+        tflite::RuntimeShape{slice_output_shape.Dims(1)},
+        bias_data ? bias_data + bias_offset : nullptr, slice_output_shape,
+        output_data + output_offset);
+    });
 }
 } // namespace luci_interpreter_pal
 
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_PAL_THREADPOOL_H
+#define LUCI_INTERPRETER_PAL_THREADPOOL_H
+
+#include <tensorflow/lite/kernels/internal/types.h>
+#include <unsupported/Eigen/CXX11/ThreadPool>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace luci_interpreter_pal
+{
+
+/**
+ * @brief Thread pool shared by heavy kernels for intra-op parallelism
+ *
+ * The number of threads is LUCI_INTERPRETER_NUM_THREADS if it is set, otherwise the number of
+ * cores. The calling thread always takes a part of the work, so 1 means no worker is created.
+ * Workers are created lazily by the first kernel which is worth splitting.
+ */
+class ThreadPool
+{
+public:
+  static ThreadPool &get()
+  {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  int numThreads() const { return _num_threads; }
+
+  // NOTE This should not be called while kernels are running
+  void setNumThreads(int num_threads)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _workers.reset();
+    _num_threads = std::max(num_threads, 1);
+  }
+
+  /**
+   * @brief Call fn(start, end) over ranges of [0, units) and wait for all of them
+   *
+   * Ranges are contiguous, and the number of ranges is limited so that each has work of
+   * kMinCostPerTask at least. cost_per_unit is a rough count of multiply-adds of a unit.
+   */
+  template <typename Fn> void parallelFor(int units, int64_t cost_per_unit, const Fn &fn)
+  {
+    int64_t tasks = std::min<int64_t>(_num_threads, units);
+    tasks = std::min<int64_t>(tasks, units * cost_per_unit / kMinCostPerTask);
+    if (tasks <= 1)
+    {
+      fn(0, units);
+      return;
+    }
+
+    Eigen::ThreadPool *workers = getWorkers();
+    Eigen::Barrier barrier(static_cast<unsigned int>(tasks - 1));
+    // The first range is left for the calling thread
+    int start = units / tasks;
+    for (int64_t i = 1; i < tasks; ++i)
+    {
+      const int end = start + static_cast<int>((units - start) / (tasks - i));
+      workers->Schedule([&fn, &barrier, start, end]() {
+        fn(start, end);
+        barrier.Notify();
+      });
+      start = end;
+    }
+    fn(0, static_cast<int>(units / tasks));
+    barrier.Wait();
+  }
+
+private:
+  // Small kernels are not worth waking up workers
+  static constexpr int64_t kMinCostPerTask = 65536;
+
+  ThreadPool()
+  {
+    const char *env = std::getenv("LUCI_INTERPRETER_NUM_THREADS");
+    const int num_threads =
+      env != nullptr ? std::atoi(env) : static_cast<int>(std::thread::hardware_concurrency());
+    _num_threads = std::max(num_threads, 1);
+  }
+
+  Eigen::ThreadPool *getWorkers()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_workers == nullptr)
+      _workers = std::make_unique<Eigen::ThreadPool>(_num_threads - 1);
+    return _workers.get();
+  }
+
+private:
+  std::mutex _mutex;
+  std::atomic<int> _num_threads{1};
+  std::unique_ptr<Eigen::ThreadPool> _workers;
+};
+
+/**
+ * @brief Split output rows of a convolution over the thread pool
+ *
+ * A unit is an output row of a batch. Output rows of a range only see a band of input rows, so
+ * the band is given to fn as a smaller convolution whose top padding is adjusted:
+ *   fn(params, input_shape, input_offset, output_shape, output_offset, first_row)
+ * Offsets are in elements, and first_row is the index of the first row among batch x height rows.
+ * Params is either tflite::ConvParams or tflite::DepthwiseParams.
+ */
+template <typename Params, typename Fn>
+inline void ParallelConvRows(const Params &params, int filter_height,
+                             const tflite::RuntimeShape &input_shape,
+                             const tflite::RuntimeShape &output_shape, int64_t cost_per_row,
+                             const Fn &fn)
+{
+  const int batches = output_shape.Dims(0);
+  const int input_height = input_shape.Dims(1);
+  const int input_row_size = input_shape.Dims(2) * input_shape.Dims(3);
+  const int output_height = output_shape.Dims(1);
+  const int output_row_size = output_shape.Dims(2) * output_shape.Dims(3);
+  const int stride = params.stride_height;
+  const int dilation = params.dilation_height_factor;
+  const int padding = params.padding_values.height;
+
+  auto rows = [&](int start, int end) {
+    for (int unit = start; unit < end;)
+    {
+      const int batch = unit / output_height;
+      const int row_start = unit % output_height;
+      const int row_end = std::min(output_height, row_start + (end - unit));
+      // Input row under the top of the filter at row_start, which may be in the padding
+      const int origin = row_start * stride - padding;
+      const int input_start = std::min(std::max(origin, 0), input_height);
+      const int last = (row_end - 1) * stride - padding + (filter_height - 1) * dilation;
+      const int input_end = std::max(input_start, std::min(input_height, last + 1));
+
+      Params band_params = params;
+      band_params.padding_values.height = input_start - origin;
+      const tflite::RuntimeShape band_input_shape{1, input_end - input_start, input_shape.Dims(2),
+                                                  input_shape.Dims(3)};
+      const tflite::RuntimeShape band_output_shape{1, row_end - row_start, output_shape.Dims(2),
+                                                   output_shape.Dims(3)};
+      fn(band_params, band_input_shape, (batch * input_height + input_start) * input_row_size,
+         band_output_shape, (batch * output_height + row_start) * output_row_size, unit);
+      unit += row_end - row_start;
+    }
+  };
+  ThreadPool::get().parallelFor(batches * output_height, cost_per_row, rows);
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_THREADPOOL_H
@@ -22,6 +22,17 @@
 
 namespace luci_interpreter_pal
 {
+static inline void
+FullyConnected(const tflite::FullyConnectedParams &params, const tflite::RuntimeShape &input_shape,
+               const float *input_data, const tflite::RuntimeShape &filter_shape,
+               const float *filter_data, const tflite::RuntimeShape &bias_shape,
+               const float *bias_data, const tflite::RuntimeShape &output_shape, float *output_data)
+{
+  tflite::reference_ops::FullyConnected(params, input_shape, input_data, filter_shape,
+                                        filter_data, bias_shape, bias_data, output_shape,
+                                        output_data);
+}
+
 template <typename T>
 static inline void FullyConnected(const tflite::FullyConnectedParams &params,
                                   const tflite::RuntimeShape &input_shape, const T *input_data,
@@ -141,6 +141,8 @@ size_t Interpreter::getOutputTensorSize(const luci::CircleOutput *output_node)
 
 void Interpreter::interpret() { _runtime_module->execute(); }
 
+void Interpreter::enableStaticPlan() { _runtime_module->enableStaticPlan(); }
+
 void Interpreter::attachObserver(ExecutionObserver *observer)
 {
   if (std::find(_observers.cbegin(), _observers.cend(), observer) != _observers.cend())
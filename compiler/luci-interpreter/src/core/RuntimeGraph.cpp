@@ -19,11 +19,53 @@
 #include "core/RuntimeModule.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace luci_interpreter
 {
 
+namespace
+{
+
+// Kernel index of the first and the last use of a tensor
+using Lifetime = std::pair<size_t, size_t>;
+
+// Lifetimes of outputs of kernels, outputs of the graph live until the end of execution
+std::unordered_map<Tensor *, Lifetime>
+getLifetimes(const std::vector<std::unique_ptr<Kernel>> &kernels,
+             const std::vector<Tensor *> &graph_outputs)
+{
+  std::unordered_map<Tensor *, Lifetime> lifetimes;
+  const size_t num_kernels = kernels.size();
+  for (size_t index = 0; index < num_kernels; ++index)
+  {
+    const auto &kernel = kernels[index];
+    for (const Tensor *tensor : kernel->getInputTensors())
+    {
+      auto nc_tensor = const_cast<Tensor *>(tensor);
+      if (lifetimes.count(nc_tensor) > 0)
+        lifetimes.at(nc_tensor).second = index;
+    }
+    for (Tensor *tensor : kernel->getOutputTensors())
+    {
+      assert(lifetimes.count(tensor) == 0);
+      lifetimes[tensor] = Lifetime(index, index);
+    }
+  }
+  for (const Tensor *tensor : graph_outputs)
+  {
+    auto nc_tensor = const_cast<Tensor *>(tensor);
+    if (lifetimes.count(nc_tensor) > 0)
+      lifetimes.at(nc_tensor).second = num_kernels;
+  }
+  return lifetimes;
+}
+
+} // namespace
+
 class RuntimeGraph::TensorAllocPlan
 {
   std::vector<std::vector<Tensor *>> _alloc_plan;
@@ -48,30 +90,8 @@ RuntimeGraph::TensorAllocPlan::TensorAllocPlan(IMemoryManager *memory_manager)
 void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
 {
   invalidate();
-  using Lifetime = std::pair<size_t, size_t>;
-  std::unordered_map<Tensor *, Lifetime> lifetimes;
+  const auto lifetimes = getLifetimes(graph._kernels, graph.getOutputTensors());
   const size_t num_kernels = graph._kernels.size();
-  for (size_t index = 0; index < num_kernels; ++index)
-  {
-    const auto &kernel = graph._kernels[index];
-    for (const Tensor *tensor : kernel->getInputTensors())
-    {
-      auto nc_tensor = const_cast<Tensor *>(tensor);
-      if (lifetimes.count(nc_tensor) > 0)
-        lifetimes.at(nc_tensor).second = index;
-    }
-    for (Tensor *tensor : kernel->getOutputTensors())
-    {
-      assert(lifetimes.count(tensor) == 0);
-      lifetimes[tensor] = Lifetime(index, index);
-    }
-  }
-  for (const Tensor *tensor : graph.getOutputTensors())
-  {
-    auto nc_tensor = const_cast<Tensor *>(tensor);
-    if (lifetimes.count(nc_tensor) > 0)
-      lifetimes.at(nc_tensor).second = num_kernels;
-  }
   _alloc_plan.assign(num_kernels, std::vector<Tensor *>());
   _dealloc_plan.assign(num_kernels + 1, std::vector<Tensor *>());
   for (const auto &item : lifetimes)
@@ -100,6 +120,253 @@ void RuntimeGraph::TensorAllocPlan::deallocate(size_t kernel_index) const
   }
 }
 
+/**
+ * Plan which configures kernels once and places their outputs in a single arena
+ *
+ * A kernel is configured again only if its inputs change in shape, or if values of its short
+ * inputs computed at runtime change, since such inputs (e.g. shape of Reshape or axes of Mean)
+ * decide shapes of outputs. Outputs are laid out in the arena by their lifetimes and by their
+ * sizes at the previous run. An output which does not fit its place is allocated by the memory
+ * manager for the run, and the arena is laid out again before the next run.
+ */
+class RuntimeGraph::StaticPlan
+{
+  struct Slot
+  {
+    Tensor *tensor;
+    Lifetime lifetime;
+    // Size at the last allocation, and place in the arena
+    size_t size = 0;
+    size_t offset = 0;
+    size_t capacity = 0;
+    bool in_arena = false;
+  };
+
+  std::vector<Slot> _slots;
+  std::vector<std::vector<size_t>> _alloc_plan;
+  std::vector<std::vector<size_t>> _dealloc_plan;
+  // Inputs of each kernel whose values are computed at runtime
+  std::vector<std::vector<bool>> _runtime_inputs;
+  // Inputs seen by the last configure() of each kernel, empty if not configured yet
+  std::vector<std::vector<uint8_t>> _configured_inputs;
+  std::vector<uint8_t> _inputs_buffer;
+  std::unique_ptr<uint8_t[]> _arena;
+  bool _valid = false;
+  bool _layout_dirty = false;
+  IMemoryManager *_memory_manager;
+
+public:
+  explicit StaticPlan(IMemoryManager *memory_manager) : _memory_manager(memory_manager) {}
+  void invalidate() { _valid = false; }
+  bool isValid() const { return _valid; }
+  void build(const RuntimeGraph &graph);
+  void prepare();
+  void configure(size_t kernel_index, Kernel *kernel);
+  void allocate(size_t kernel_index);
+  void deallocate(size_t kernel_index);
+  void detach();
+
+private:
+  void serializeInputs(size_t kernel_index, const Kernel &kernel, std::vector<uint8_t> *out) const;
+  void layout();
+};
+
+void RuntimeGraph::StaticPlan::build(const RuntimeGraph &graph)
+{
+  detach();
+  const auto lifetimes = getLifetimes(graph._kernels, graph.getOutputTensors());
+  const size_t num_kernels = graph._kernels.size();
+
+  _slots.clear();
+  for (const auto &item : lifetimes)
+    _slots.push_back(Slot{item.first, item.second});
+  _alloc_plan.assign(num_kernels, std::vector<size_t>());
+  _dealloc_plan.assign(num_kernels + 1, std::vector<size_t>());
+  for (size_t i = 0; i < _slots.size(); ++i)
+  {
+    _alloc_plan[_slots[i].lifetime.first].push_back(i);
+    _dealloc_plan[_slots[i].lifetime.second].push_back(i);
+  }
+
+  std::unordered_set<const Tensor *> runtime_tensors(graph.getInputTensors().cbegin(),
+                                                     graph.getInputTensors().cend());
+  for (const auto &item : lifetimes)
+    runtime_tensors.insert(item.first);
+  _runtime_inputs.assign(num_kernels, std::vector<bool>());
+  for (size_t index = 0; index < num_kernels; ++index)
+  {
+    for (const Tensor *tensor : graph._kernels[index]->getInputTensors())
+      _runtime_inputs[index].push_back(runtime_tensors.count(tensor) > 0);
+  }
+
+  // Outputs are allocated by the memory manager at the first run, which gives their sizes
+  _configured_inputs.assign(num_kernels, std::vector<uint8_t>());
+  _arena.reset();
+  _layout_dirty = false;
+  _valid = true;
+}
+
+void RuntimeGraph::StaticPlan::serializeInputs(size_t kernel_index, const Kernel &kernel,
+                                               std::vector<uint8_t> *out) const
+{
+  // Values of shapes, paddings, axes and so on are short
+  constexpr size_t kMaxValueSize = 256;
+
+  auto append = [out](const void *data, size_t size) {
+    const auto bytes = static_cast<const uint8_t *>(data);
+    out->insert(out->end(), bytes, bytes + size);
+  };
+
+  out->clear();
+  const auto &inputs = kernel.getInputTensors();
+  for (size_t i = 0; i < inputs.size(); ++i)
+  {
+    const Tensor *tensor = inputs[i];
+    const int32_t rank = tensor != nullptr ? tensor->shape().num_dims() : -1;
+    append(&rank, sizeof(rank));
+    if (tensor == nullptr)
+      continue;
+    for (int axis = 0; axis < rank; ++axis)
+    {
+      const int32_t dim = tensor->shape().dim(axis);
+      append(&dim, sizeof(dim));
+    }
+
+    if (!_runtime_inputs[kernel_index][i] || !tensor->is_data_allocated())
+      continue;
+    const size_t size =
+      getDataTypeSize(tensor->element_type()) * tensor->shape().large_num_elements();
+    if (size <= kMaxValueSize)
+      append(tensor->data<void>(), size);
+  }
+}
+
+void RuntimeGraph::StaticPlan::prepare()
+{
+  if (_layout_dirty)
+    layout();
+}
+
+void RuntimeGraph::StaticPlan::configure(size_t kernel_index, Kernel *kernel)
+{
+  serializeInputs(kernel_index, *kernel, &_inputs_buffer);
+  auto &configured = _configured_inputs[kernel_index];
+  if (!configured.empty() && configured == _inputs_buffer)
+    return;
+
+  configured.clear();
+  kernel->configure();
+  configured.swap(_inputs_buffer);
+}
+
+void RuntimeGraph::StaticPlan::layout()
+{
+  detach();
+
+  // Greedy by size, each slot takes the lowest offset which does not overlap slots already placed
+  // and alive at the same time
+  constexpr size_t kAlignment = alignof(std::max_align_t);
+  std::vector<size_t> order(_slots.size());
+  for (size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  std::stable_sort(order.begin(), order.end(),
+                   [this](size_t a, size_t b) { return _slots[a].size > _slots[b].size; });
+
+  size_t arena_size = 0;
+  std::vector<const Slot *> placed;
+  std::vector<const Slot *> alive;
+  for (size_t index : order)
+  {
+    Slot &slot = _slots[index];
+    slot.capacity = (slot.size + kAlignment - 1) / kAlignment * kAlignment;
+
+    alive.clear();
+    for (const Slot *other : placed)
+    {
+      if (other->lifetime.first <= slot.lifetime.second &&
+          slot.lifetime.first <= other->lifetime.second)
+        alive.push_back(other);
+    }
+    std::sort(alive.begin(), alive.end(),
+              [](const Slot *a, const Slot *b) { return a->offset < b->offset; });
+
+    size_t offset = 0;
+    for (const Slot *other : alive)
+    {
+      if (offset + slot.capacity <= other->offset)
+        break;
+      offset = std::max(offset, other->offset + other->capacity);
+    }
+    slot.offset = offset;
+    arena_size = std::max(arena_size, offset + slot.capacity);
+    placed.push_back(&slot);
+  }
+
+  _arena.reset(new uint8_t[arena_size]);
+  _layout_dirty = false;
+}
+
+void RuntimeGraph::StaticPlan::allocate(size_t kernel_index)
+{
+  assert(_valid && kernel_index < _alloc_plan.size());
+  for (size_t index : _alloc_plan[kernel_index])
+  {
+    Slot &slot = _slots[index];
+    Tensor *tensor = slot.tensor;
+    if (!tensor->is_allocatable())
+    {
+      if (slot.in_arena)
+        tensor->set_data_buffer(nullptr);
+      slot.in_arena = false;
+      slot.size = 0;
+      continue;
+    }
+
+    slot.size = getDataTypeSize(tensor->element_type()) * tensor->shape().large_num_elements();
+    if (_arena != nullptr && slot.size <= slot.capacity)
+    {
+      // e.g. outputs of the graph from the previous run, or scratchpads allocated by the loader
+      if (!slot.in_arena && tensor->is_data_allocated())
+        _memory_manager->release_memory(*tensor);
+      tensor->set_data_buffer(_arena.get() + slot.offset);
+      slot.in_arena = true;
+    }
+    else
+    {
+      if (slot.in_arena)
+        tensor->set_data_buffer(nullptr);
+      slot.in_arena = false;
+      _memory_manager->allocate_memory(*tensor);
+      _layout_dirty = true;
+    }
+  }
+}
+
+void RuntimeGraph::StaticPlan::deallocate(size_t kernel_index)
+{
+  assert(_valid && kernel_index < _dealloc_plan.size());
+  for (size_t index : _dealloc_plan[kernel_index])
+  {
+    Slot &slot = _slots[index];
+    if (slot.in_arena)
+      slot.tensor->set_data_buffer(nullptr);
+    else
+      _memory_manager->release_memory(*slot.tensor);
+    slot.in_arena = false;
+  }
+}
+
+// Tensors do not point to the arena after this
+void RuntimeGraph::StaticPlan::detach()
+{
+  for (auto &slot : _slots)
+  {
+    if (slot.in_arena)
+      slot.tensor->set_data_buffer(nullptr);
+    slot.in_arena = false;
+  }
+}
+
 RuntimeGraph::RuntimeGraph(RuntimeModule *owning_module, IMemoryManager *memory_manager)
   : _owning_module(owning_module), _memory_manager(memory_manager),
     _tensor_alloc_plan(std::make_unique<TensorAllocPlan>(memory_manager))
@@ -108,6 +375,10 @@ RuntimeGraph::RuntimeGraph(RuntimeModule *owning_module, IMemoryManager *memory_
 
 RuntimeGraph::~RuntimeGraph()
 {
+  // Memory of the arena is not owned by the memory manager
+  if (_static_plan)
+    _static_plan->detach();
+
   for (auto &tensor : _tensors)
   {
     if (tensor->is_data_allocated())
@@ -146,11 +417,25 @@ void RuntimeGraph::addKernel(std::unique_ptr<Kernel> &&kernel)
   assert(kernel != nullptr);
   _kernels.push_back(std::move(kernel));
   _tensor_alloc_plan->invalidate();
+  if (_static_plan)
+    _static_plan->invalidate();
+}
+
+void RuntimeGraph::enableStaticPlan()
+{
+  if (!_static_plan)
+    _static_plan = std::make_unique<StaticPlan>(_memory_manager);
 }
 
 void RuntimeGraph::execute() const
 {
-  if (!_tensor_alloc_plan->isValid())
+  if (_static_plan)
+  {
+    if (!_static_plan->isValid())
+      _static_plan->build(*this);
+    _static_plan->prepare();
+  }
+  else if (!_tensor_alloc_plan->isValid())
     _tensor_alloc_plan->build(*this);
 
   EventNotifier *event_notifier = _owning_module->getEventNotifier();
@@ -173,12 +458,19 @@ void RuntimeGraph::execute() const
       event_notifier->preOperatorExecute(kernel.get());
     }
 
-    // TODO The `configure` method should only be called if the outputs of an operator need to be
-    //  resized.
-    kernel->configure();
-
     // Preallocate outputs in advance instead of relying on automatic allocation
-    _tensor_alloc_plan->allocate(index);
+    if (_static_plan)
+    {
+      _static_plan->configure(index, kernel.get());
+      _static_plan->allocate(index);
+    }
+    else
+    {
+      // TODO The `configure` method should only be called if the outputs of an operator need to
+      //  be resized.
+      kernel->configure();
+      _tensor_alloc_plan->allocate(index);
+    }
 
     kernel->execute();
 
@@ -194,7 +486,10 @@ void RuntimeGraph::execute() const
         event_notifier->postTensorWrite(tensor);
       }
     }
-    _tensor_alloc_plan->deallocate(index);
+    if (_static_plan)
+      _static_plan->deallocate(index);
+    else
+      _tensor_alloc_plan->deallocate(index);
   }
 }
 
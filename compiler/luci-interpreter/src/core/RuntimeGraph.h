@@ -34,6 +34,8 @@ class RuntimeGraph
 private:
   class TensorAllocPlan;
   friend class TensorAllocPlan;
+  class StaticPlan;
+  friend class StaticPlan;
 
 public:
   explicit RuntimeGraph(RuntimeModule *owning_module, IMemoryManager *memory_manager);
@@ -51,6 +53,11 @@ public:
 
   void addKernel(std::unique_ptr<Kernel> &&kernel);
 
+  // Configure kernels once and keep their outputs in a single arena between runs.
+  // A kernel is configured again only if its inputs change. Not for graphs with control flow,
+  // whose kernels allocate outputs by themselves.
+  void enableStaticPlan();
+
   void execute() const;
 
 private:
@@ -64,6 +71,8 @@ private:
   std::vector<std::unique_ptr<Kernel>> _kernels;
   // Tensors that are not used anymore after given op
   std::unique_ptr<TensorAllocPlan> _tensor_alloc_plan;
+  // Used instead of _tensor_alloc_plan if the static plan is enabled
+  std::unique_ptr<StaticPlan> _static_plan;
 };
 
 } // namespace luci_interpreter
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/RuntimeGraph.h"
+#include "core/RuntimeModule.h"
+#include "luci_interpreter/SimpleMemoryManager.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace luci_interpreter;
+
+namespace
+{
+
+// output = input + 1, counts configure() calls
+class AddOneKernel : public Kernel
+{
+public:
+  AddOneKernel(const Tensor *input, Tensor *output, int *configure_count)
+    : Kernel({input}, {output}), _configure_count(configure_count)
+  {
+  }
+
+  void configure() override
+  {
+    ++*_configure_count;
+    _outputs[0]->resize(_inputs[0]->shape());
+  }
+
+  void execute() const override
+  {
+    const float *input = _inputs[0]->data<float>();
+    float *output = _outputs[0]->data<float>();
+    for (int i = 0; i < _inputs[0]->shape().num_elements(); ++i)
+      output[i] = input[i] + 1.f;
+  }
+
+private:
+  int *_configure_count;
+};
+
+// output = input[0:count], where count is a value of the second input
+class SliceKernel : public Kernel
+{
+public:
+  SliceKernel(const Tensor *input, const Tensor *count, Tensor *output, int *configure_count)
+    : Kernel({input, count}, {output}), _configure_count(configure_count)
+  {
+  }
+
+  void configure() override
+  {
+    ++*_configure_count;
+    _outputs[0]->resize({_inputs[1]->data<int32_t>()[0]});
+  }
+
+  void execute() const override
+  {
+    const float *input = _inputs[0]->data<float>();
+    float *output = _outputs[0]->data<float>();
+    for (int i = 0; i < _outputs[0]->shape().num_elements(); ++i)
+      output[i] = input[i];
+  }
+
+private:
+  int *_configure_count;
+};
+
+class CountingMemoryManager : public IMemoryManager
+{
+public:
+  void allocate_memory(Tensor &tensor) override
+  {
+    ++allocations;
+    _impl.allocate_memory(tensor);
+  }
+  void release_memory(Tensor &tensor) override { _impl.release_memory(tensor); }
+
+  int allocations = 0;
+
+private:
+  SimpleMemoryManager _impl;
+};
+
+class RuntimeGraphTest : public ::testing::Test
+{
+protected:
+  Tensor *addTensor(DataType element_type, Shape shape)
+  {
+    return _graph.addTensor(
+      std::make_unique<Tensor>(element_type, std::move(shape), AffineQuantization{}, ""));
+  }
+
+  void writeInput(Tensor *tensor, const std::vector<float> &data)
+  {
+    tensor->resize({static_cast<int32_t>(data.size())});
+    _memory_manager.allocate_memory(*tensor);
+    tensor->writeData(data.data(), data.size() * sizeof(float));
+  }
+
+  std::vector<float> readOutput(const Tensor *tensor)
+  {
+    std::vector<float> data(tensor->shape().num_elements());
+    tensor->readData(data.data(), data.size() * sizeof(float));
+    return data;
+  }
+
+  CountingMemoryManager _memory_manager;
+  RuntimeModule _module{nullptr};
+  RuntimeGraph _graph{&_module, &_memory_manager};
+};
+
+} // namespace
+
+TEST_F(RuntimeGraphTest, StaticPlan)
+{
+  // input -> t1 -> t2 -> output, t1 and output do not live at the same time
+  Tensor *input = addTensor(DataType::FLOAT32, Shape{3});
+  Tensor *t1 = addTensor(DataType::FLOAT32, Shape{});
+  Tensor *t2 = addTensor(DataType::FLOAT32, Shape{});
+  Tensor *output = addTensor(DataType::FLOAT32, Shape{});
+  int configure_count = 0;
+  _graph.addKernel(std::make_unique<AddOneKernel>(input, t1, &configure_count));
+  _graph.addKernel(std::make_unique<AddOneKernel>(t1, t2, &configure_count));
+  _graph.addKernel(std::make_unique<AddOneKernel>(t2, output, &configure_count));
+  _graph.setInputTensors({input});
+  _graph.setOutputTensors({output});
+  _graph.enableStaticPlan();
+
+  writeInput(input, {1.f, 2.f, 3.f});
+  _graph.execute();
+  const int allocations = _memory_manager.allocations;
+  for (int run = 0; run < 3; ++run)
+  {
+    _graph.execute();
+    EXPECT_EQ(readOutput(output), std::vector<float>({4.f, 5.f, 6.f}));
+    // Intermediate tensors are released after execution
+    EXPECT_FALSE(t1->is_data_allocated());
+    EXPECT_FALSE(t2->is_data_allocated());
+  }
+  EXPECT_EQ(configure_count, 3);
+  // Outputs are in the arena after the first run
+  EXPECT_EQ(_memory_manager.allocations, allocations);
+
+  // Kernels are configured again if the input changes in shape
+  writeInput(input, {1.f, 2.f, 3.f, 4.f, 5.f});
+  for (int run = 0; run < 2; ++run)
+  {
+    _graph.execute();
+    EXPECT_EQ(readOutput(output), std::vector<float>({4.f, 5.f, 6.f, 7.f, 8.f}));
+  }
+  EXPECT_EQ(configure_count, 6);
+}
+
+TEST_F(RuntimeGraphTest, StaticPlanValueChange)
+{
+  Tensor *input = addTensor(DataType::FLOAT32, Shape{4});
+  Tensor *count = addTensor(DataType::S32, Shape{1});
+  Tensor *t1 = addTensor(DataType::FLOAT32, Shape{});
+  Tensor *output = addTensor(DataType::FLOAT32, Shape{});
+  int configure_count = 0;
+  _graph.addKernel(std::make_unique<SliceKernel>(input, count, t1, &configure_count));
+  _graph.addKernel(std::make_unique<AddOneKernel>(t1, output, &configure_count));
+  _graph.setInputTensors({input, count});
+  _graph.setOutputTensors({output});
+  _graph.enableStaticPlan();
+
+  writeInput(input, {1.f, 2.f, 3.f, 4.f});
+  _memory_manager.allocate_memory(*count);
+  int32_t count_value = 2;
+  count->writeData(&count_value, sizeof(count_value));
+  _graph.execute();
+  _graph.execute();
+  EXPECT_EQ(readOutput(output), std::vector<float>({2.f, 3.f}));
+  EXPECT_EQ(configure_count, 2);
+
+  // Output is larger than the place laid out at the previous run
+  count_value = 4;
+  count->writeData(&count_value, sizeof(count_value));
+  _graph.execute();
+  EXPECT_EQ(readOutput(output), std::vector<float>({2.f, 3.f, 4.f, 5.f}));
+  _graph.execute();
+  EXPECT_EQ(readOutput(output), std::vector<float>({2.f, 3.f, 4.f, 5.f}));
+  EXPECT_EQ(configure_count, 4);
+}
+
+TEST_F(RuntimeGraphTest, WithoutStaticPlan)
+{
+  Tensor *input = addTensor(DataType::FLOAT32, Shape{2});
+  Tensor *output = addTensor(DataType::FLOAT32, Shape{});
+  int configure_count = 0;
+  _graph.addKernel(std::make_unique<AddOneKernel>(input, output, &configure_count));
+  _graph.setInputTensors({input});
+  _graph.setOutputTensors({output});
+
+  writeInput(input, {1.f, 2.f});
+  _graph.execute();
+  _graph.execute();
+  EXPECT_EQ(readOutput(output), std::vector<float>({2.f, 3.f}));
+  EXPECT_EQ(configure_count, 2);
+}
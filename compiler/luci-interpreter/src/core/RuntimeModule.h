@@ -46,6 +46,14 @@ public:
     return getMainGraph()->getOutputTensors();
   }
 
+  // Control flow kernels allocate outputs by themselves, so modules with subgraphs are executed
+  // without the static plan
+  void enableStaticPlan()
+  {
+    if (_graphs.size() == 1)
+      getMainGraph()->enableStaticPlan();
+  }
+
   void execute() const { getMainGraph()->execute(); }
 
 private:
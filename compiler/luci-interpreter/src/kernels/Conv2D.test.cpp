@@ -186,6 +186,72 @@ TEST_F(Conv2DTest, FloatCheck)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
 }
 
+// Large enough to be split over threads, with padding at the top and the bottom
+TEST_F(Conv2DTest, FloatManyRows)
+{
+  const int32_t batches = 2, input_height = 33, input_width = 8, input_depth = 8;
+  const int32_t output_height = 17, output_width = 8, output_depth = 16;
+  Shape input_shape{batches, input_height, input_width, input_depth};
+  Shape filter_shape{output_depth, 3, 3, input_depth};
+  Shape bias_shape{output_depth};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> filter_data(filter_shape.num_elements());
+  std::vector<float> bias_data(output_depth);
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 13) - 6.f;
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(i % 7) - 3.f;
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(i);
+  Tensor input_tensor =
+    makeInputTensor<DataType::FLOAT32>(input_shape, input_data, _memory_manager.get());
+  Tensor filter_tensor =
+    makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data, _memory_manager.get());
+  Tensor bias_tensor =
+    makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data, _memory_manager.get());
+  Tensor im2col(DataType::FLOAT32, Shape({}), {}, "");
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  Conv2DParams params{};
+  params.padding = Padding::SAME;
+  params.stride_height = 2;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, &im2col, params);
+  kernel.configure();
+  _memory_manager->allocate_memory(im2col);
+  _memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+
+  // Padding is 1 on each side
+  std::vector<float> ref_output_data;
+  for (int32_t b = 0; b < batches; ++b)
+    for (int32_t oy = 0; oy < output_height; ++oy)
+      for (int32_t ox = 0; ox < output_width; ++ox)
+        for (int32_t oc = 0; oc < output_depth; ++oc)
+        {
+          float sum = bias_data[oc];
+          for (int32_t fy = 0; fy < 3; ++fy)
+            for (int32_t fx = 0; fx < 3; ++fx)
+            {
+              const int32_t iy = oy * 2 - 1 + fy;
+              const int32_t ix = ox - 1 + fx;
+              if (iy < 0 || iy >= input_height || ix < 0 || ix >= input_width)
+                continue;
+              for (int32_t ic = 0; ic < input_depth; ++ic)
+                sum += input_data[((b * input_height + iy) * input_width + ix) * input_depth + ic] *
+                       filter_data[((oc * 3 + fy) * 3 + fx) * input_depth + ic];
+            }
+          ref_output_data.push_back(sum);
+        }
+  std::vector<int32_t> ref_output_shape{batches, output_height, output_width, output_depth};
+  EXPECT_THAT(extractTensorData<float>(output_tensor), FloatArrayNear(ref_output_data));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
+}
+
 TEST_F(Conv2DTest, Uint8)
 {
   std::vector<float> input_data{
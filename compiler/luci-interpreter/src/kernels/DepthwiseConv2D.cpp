@@ -172,7 +172,7 @@ void DepthwiseConv2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
-  tflite::reference_ops::DepthwiseConv(
+  luci_interpreter_pal::DepthwiseConv(
     params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
     getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
     getTensorShape(output()), getTensorData<float>(output()));
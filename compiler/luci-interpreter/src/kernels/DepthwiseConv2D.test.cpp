@@ -86,6 +86,74 @@ TEST_F(DepthwiseConv2DTest, Float)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({1, 2, 1, 4}));
 }
 
+// Large enough to be split over threads, with dilation and padding at the top and the bottom
+TEST_F(DepthwiseConv2DTest, FloatManyRows)
+{
+  const int32_t batches = 2, input_height = 64, input_width = 16, input_depth = 16;
+  const int32_t output_depth = 32;
+  Shape input_shape{batches, input_height, input_width, input_depth};
+  Shape filter_shape{1, 3, 3, output_depth};
+  Shape bias_shape{output_depth};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> filter_data(filter_shape.num_elements());
+  std::vector<float> bias_data(output_depth);
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 13) - 6.f;
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(i % 7) - 3.f;
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(i);
+  Tensor input_tensor =
+    makeInputTensor<DataType::FLOAT32>(input_shape, input_data, _memory_manager.get());
+  Tensor filter_tensor =
+    makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data, _memory_manager.get());
+  Tensor bias_tensor =
+    makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data, _memory_manager.get());
+  Tensor scratchpad(DataType::FLOAT32, Shape({}), {}, "");
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  DepthwiseConv2DParams params{};
+  params.padding = Padding::SAME;
+  params.depth_multiplier = 2;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 2;
+  params.dilation_width_factor = 2;
+  params.activation = Activation::NONE;
+
+  DepthwiseConv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, &scratchpad,
+                         params);
+  kernel.configure();
+  _memory_manager->allocate_memory(scratchpad);
+  _memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+
+  // Padding is 2 on each side
+  std::vector<float> ref_output_data;
+  for (int32_t b = 0; b < batches; ++b)
+    for (int32_t oy = 0; oy < input_height; ++oy)
+      for (int32_t ox = 0; ox < input_width; ++ox)
+        for (int32_t oc = 0; oc < output_depth; ++oc)
+        {
+          float sum = bias_data[oc];
+          for (int32_t fy = 0; fy < 3; ++fy)
+            for (int32_t fx = 0; fx < 3; ++fx)
+            {
+              const int32_t iy = oy - 2 + fy * 2;
+              const int32_t ix = ox - 2 + fx * 2;
+              if (iy < 0 || iy >= input_height || ix < 0 || ix >= input_width)
+                continue;
+              const int32_t ic = oc / params.depth_multiplier;
+              sum += input_data[((b * input_height + iy) * input_width + ix) * input_depth + ic] *
+                     filter_data[(fy * 3 + fx) * output_depth + oc];
+            }
+          ref_output_data.push_back(sum);
+        }
+  EXPECT_THAT(extractTensorData<float>(output_tensor), FloatArrayNear(ref_output_data));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray({batches, input_height, input_width, output_depth}));
+}
+
 TEST_F(DepthwiseConv2DTest, Uint8)
 {
   std::vector<float> input_data{
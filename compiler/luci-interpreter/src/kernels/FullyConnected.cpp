@@ -149,7 +149,7 @@ void FullyConnected::evalFloat() const
   params.float_activation_max = activation_max;
   params.weights_format = tflite::FullyConnectedWeightsFormat::kDefault;
 
-  tflite::reference_ops::FullyConnected(
+  luci_interpreter_pal::FullyConnected(
     params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(weights()),
     getTensorData<float>(weights()), getTensorShape(bias()), getTensorData<float>(bias()),
     getTensorShape(output()), getTensorData<float>(output()));
@@ -276,7 +276,7 @@ void FullyConnected::evalHybridWI4AF32() const
       }
   }
 
-  tflite::reference_ops::FullyConnected(
+  luci_interpreter_pal::FullyConnected(
     params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(scratch()),
     getTensorData<float>(scratch()), getTensorShape(bias()), getTensorData<float>(bias()),
     getTensorShape(output()), getTensorData<float>(output()));
@@ -340,7 +340,7 @@ void FullyConnected::evalHybridWU4AF32() const
       }
   }
 
-  tflite::reference_ops::FullyConnected(
+  luci_interpreter_pal::FullyConnected(
     params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(scratch()),
     getTensorData<float>(scratch()), getTensorShape(bias()), getTensorData<float>(bias()),
     getTensorShape(output()), getTensorData<float>(output()));
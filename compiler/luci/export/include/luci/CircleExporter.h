@@ -22,6 +22,8 @@
 #include <loco.h>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace luci
 {
@@ -44,6 +46,16 @@ public:
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
     virtual bool store(const char *ptr, const size_t size) const = 0;
+
+    // Piece of export data
+    using Chunk = std::pair<const char *, size_t>;
+
+    // Exporter calls storeChunks for export data which is not in one buffer, e.g. model with
+    // extended buffers, whose constants follow flatbuffers area without being copied.
+    // Default implementation concatenates chunks and calls store. Override this to write chunks
+    // as they are, without the whole model in memory.
+    // Notice: Please DO NOT STORE pointers of chunks when implementing this in Client
+    virtual bool storeChunks(const std::vector<Chunk> &chunks) const;
   };
 
 public:
@@ -25,6 +25,7 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 namespace luci
 {
@@ -54,6 +55,20 @@ public:
     return fs.good();
   }
 
+  bool storeChunks(const std::vector<Chunk> &chunks) const final
+  {
+    std::ofstream fs(_filepath, std::ofstream::binary);
+    for (const auto &chunk : chunks)
+    {
+      if (!chunk.first && chunk.second > 0)
+        INTERNAL_EXN("Graph was not serialized by FlatBuffer for some reason");
+
+      fs.write(chunk.first, chunk.second);
+    }
+
+    return fs.good();
+  }
+
 private:
   luci::Module *_module;
   const std::string _filepath;
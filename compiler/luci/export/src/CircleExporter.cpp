@@ -22,10 +22,28 @@
 
 #include <fstream>
 #include <memory>
+#include <vector>
 
 namespace luci
 {
 
+bool CircleExporter::Contract::storeChunks(const std::vector<Chunk> &chunks) const
+{
+  if (chunks.size() == 1)
+    return store(chunks[0].first, chunks[0].second);
+
+  size_t size = 0;
+  for (const auto &chunk : chunks)
+    size += chunk.second;
+
+  std::vector<char> data;
+  data.reserve(size);
+  for (const auto &chunk : chunks)
+    data.insert(data.end(), chunk.first, chunk.first + chunk.second);
+
+  return store(data.data(), data.size());
+}
+
 CircleExporter::CircleExporter()
 {
   // NOTHING TO DO
@@ -38,11 +56,8 @@ bool CircleExporter::invoke(Contract *contract) const
   {
     CircleExporterImpl impl(module);
 
-    const char *ptr = impl.getBufferPointer();
-    const size_t size = impl.getBufferSize();
-
     // we just send one time
-    return contract->store(ptr, size);
+    return contract->storeChunks(impl.getChunks());
   }
 
   // NOTE some unit tests calls with nullptr module, cannot add assert here
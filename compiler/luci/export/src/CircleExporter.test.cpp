@@ -17,6 +17,8 @@
 #include "luci/CircleExporter.h"
 
 #include <luci/Plan/CircleNodeExecutionPlan.h>
+#include <luci/IR/Nodes/CircleAdd.h>
+#include <luci/IR/Nodes/CircleConst.h>
 #include <luci/IR/Nodes/CircleInput.h>
 #include <luci/IR/Nodes/CircleOutput.h>
 #include <luci/IR/Nodes/CircleRelu.h>
@@ -138,3 +140,106 @@ TEST(CircleExport, export_execution_plan_nosetting_NEG)
   ASSERT_NE(model.get(), nullptr);
   ASSERT_EQ(model->metadata.size(), 0);
 }
+
+namespace
+{
+
+class ExtBufferGraphContract : public luci::CircleExporter::Contract
+{
+public:
+  ExtBufferGraphContract()
+  {
+    auto g = loco::make_graph();
+    auto graph_input = g->inputs()->create();
+    auto graph_output = g->outputs()->create();
+    auto input_node = g->nodes()->create<luci::CircleInput>();
+    auto output_node = g->nodes()->create<luci::CircleOutput>();
+    auto add_node = g->nodes()->create<luci::CircleAdd>();
+    const_node = g->nodes()->create<luci::CircleConst>();
+
+    const_node->dtype(loco::DataType::FLOAT32);
+    const_node->shape({5});
+    const_node->size<loco::DataType::FLOAT32>(5);
+    for (uint32_t i = 0; i < 5; ++i)
+      const_node->at<loco::DataType::FLOAT32>(i) = static_cast<float>(i);
+
+    add_node->x(input_node);
+    add_node->y(const_node);
+    add_node->fusedActivationFunction(luci::FusedActFunc::NONE);
+    output_node->from(add_node);
+    input_node->index(graph_input->index());
+    output_node->index(graph_output->index());
+
+    input_node->name("input");
+    output_node->name("output");
+    add_node->name("add");
+    const_node->name("const");
+    input_node->dtype(loco::DataType::FLOAT32);
+    input_node->shape({5});
+
+    graph_input->shape({5});
+    graph_input->dtype(loco::DataType::FLOAT32);
+    graph_output->shape({5});
+    graph_output->dtype(loco::DataType::FLOAT32);
+
+    _m = std::make_unique<luci::Module>();
+    _m->add(std::move(g));
+    _m->ext_buffer(true);
+  }
+
+  luci::Module *module(void) const override { return _m.get(); }
+
+public:
+  bool store(const char *ptr, const size_t size) const override
+  {
+    buffer.assign(ptr, ptr + size);
+    return true;
+  }
+
+  bool storeChunks(const std::vector<Chunk> &chunks) const override
+  {
+    num_chunks = chunks.size();
+    return luci::CircleExporter::Contract::storeChunks(chunks);
+  }
+
+public:
+  luci::CircleConst *const_node = nullptr;
+  mutable std::vector<char> buffer;
+  mutable size_t num_chunks = 0;
+
+private:
+  std::unique_ptr<luci::Module> _m;
+};
+
+} // namespace
+
+TEST(CircleExport, export_ext_buffer)
+{
+  ExtBufferGraphContract contract;
+  luci::CircleExporter exporter;
+
+  ASSERT_TRUE(exporter.invoke(&contract));
+
+  // Constant follows flatbuffers area as a separate chunk
+  EXPECT_LT(1, contract.num_chunks);
+  ASSERT_FALSE(contract.buffer.empty());
+  EXPECT_EQ(0, contract.buffer.size() % 16);
+
+  auto model = circle::GetModel(contract.buffer.data());
+  ASSERT_NE(model, nullptr);
+  uint32_t num_ext_buffers = 0;
+  for (auto buffer : *model->buffers())
+  {
+    if (buffer->offset() <= 1)
+      continue;
+
+    ++num_ext_buffers;
+    EXPECT_EQ(0, buffer->offset() % 16);
+    ASSERT_EQ(5 * sizeof(float), buffer->size());
+    ASSERT_LE(buffer->offset() + buffer->size(), contract.buffer.size());
+    auto values = reinterpret_cast<const float *>(contract.buffer.data() + buffer->offset());
+    for (uint32_t i = 0; i < 5; ++i)
+      EXPECT_FLOAT_EQ(static_cast<float>(i), values[i]);
+  }
+  EXPECT_EQ(1, num_ext_buffers);
+}
@@ -160,12 +160,15 @@ void CircleExporterImpl::exportModule(Module *module)
   prepareModelData(_builder, md);
 
   // if source is extended buffer mode, force export to use extended buffer
-  md._ext_buffer = module->ext_buffer();
+  // buffer placement is decided before serialization not to export twice
+  md._ext_buffer = module->ext_buffer() || require_ext_buffer(module);
 
   if (!exportModuleData(module, md) && md._require_ext_buffer)
   {
     assert(md._ext_buffer == false);
 
+    // NOTE this happens only if data other than constants is too large
+
     // do some cleanups for re-run
     _builder.Clear();
     for (size_t g = 0; g < module->size(); ++g)
@@ -249,77 +252,45 @@ bool CircleExporterImpl::exportModuleData(Module *module, SerializedModelData &m
 
 void CircleExporterImpl::finalizeWithExtendedBuffer(SerializedModelData &md)
 {
-  _ext_buffer = md._ext_buffer;
-  if (!_ext_buffer)
-    return;
-
-  _fb_data_with_ext.clear();
-
-  auto align16 = [](size_t &v) {
-    while (v % 16 != 0)
-      v++;
-  };
+  const char *buff_ptr = reinterpret_cast<const char *>(_builder.GetBufferPointer());
 
-  // get total memory for flatbuffer + all buffer_data
-  size_t result_size = _builder.GetSize();
-  align16(result_size);
-  for (auto &it : md._buffer_data_map)
-  {
-    SerializedModelData::BufferData &buffer_data = it.second;
-    result_size += buffer_data.size();
-    align16(result_size);
-  }
-  align16(result_size);
-  result_size += 16; // for safety
+  _chunks.clear();
+  _chunks.emplace_back(buff_ptr, _builder.GetSize());
+  if (!md._ext_buffer)
+    return;
 
-  std::string result;
-  const char *buff_ptr = reinterpret_cast<const char *>(_builder.GetBufferPointer());
+  static const char zeros[16] = {0};
 
-  auto padalign16 = [](std::string &str) {
-    while (str.size() % 16 != 0)
-      str += '\0';
+  // pad to be 16 bytes aligned
+  uint64_t result_size = _builder.GetSize();
+  auto padalign16 = [this, &result_size]() {
+    const uint64_t padding = (16 - result_size % 16) % 16;
+    if (padding > 0)
+      _chunks.emplace_back(zeros, padding);
+    result_size += padding;
   };
 
-  result.reserve(result_size);
-  result.append(buff_ptr, _builder.GetSize());
-
-  auto mutable_model = circle::GetMutableModel(result.data());
+  // offsets of buffers are written in place
+  auto mutable_model = circle::GetMutableModel(_builder.GetBufferPointer());
   auto mutable_buffers = mutable_model->mutable_buffers();
 
-  // pad to be 16 bytes aligned
-  padalign16(result);
+  padalign16();
   for (auto &it : md._buffer_data_map)
   {
     int32_t buffer_index = it.first;
-    SerializedModelData::BufferData &buffer_data = it.second;
-    uint64_t offset = result.size();
-    uint64_t size = buffer_data.size();
+    const SerializedModelData::BufferData &buffer_data = it.second;
+    uint64_t offset = result_size;
+    uint64_t size = buffer_data.size;
 
     circle::Buffer *mutable_buffer = mutable_buffers->GetMutableObject(buffer_index);
     mutable_buffer->mutate_offset(offset);
     mutable_buffer->mutate_size(size);
 
-    result.append(buffer_data.begin(), buffer_data.end());
-    padalign16(result);
+    if (size > 0)
+      _chunks.emplace_back(reinterpret_cast<const char *>(buffer_data.data), size);
+    result_size += size;
+    padalign16();
   }
-  padalign16(result);
-
-  // use final result
-  _fb_data_with_ext = result;
-}
-
-const char *CircleExporterImpl::getBufferPointer() const
-{
-  if (_ext_buffer)
-    return reinterpret_cast<const char *>(_fb_data_with_ext.data());
-  return reinterpret_cast<const char *>(_builder.GetBufferPointer());
-}
-
-size_t CircleExporterImpl::getBufferSize() const
-{
-  if (_ext_buffer)
-    return _fb_data_with_ext.size();
-  return _builder.GetSize();
 }
 
 } // namespace luci
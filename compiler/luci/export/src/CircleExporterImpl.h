@@ -26,6 +26,8 @@
 
 #include <loco.h>
 
+#include <vector>
+
 namespace luci
 {
 
@@ -41,14 +43,10 @@ public:
   explicit CircleExporterImpl(Module *module);
 
   /**
-   * @return pointer to buffer with serialized graph
-   */
-  const char *getBufferPointer() const;
-
-  /**
-   * @return size of buffer with serialized graph
+   * @return chunks of serialized model, flatbuffers area followed by extended buffers if any
+   * @note   chunks refer to internal buffer and constants of module
    */
-  size_t getBufferSize() const;
+  const std::vector<CircleExporter::Contract::Chunk> &getChunks() const { return _chunks; }
 
 private:
   /**
@@ -70,14 +68,13 @@ private:
   bool exportModuleData(Module *module, SerializedModelData &md);
 
   /**
-   * @brief finalizes file stream with extended buffer from internal buffer
+   * @brief finalizes chunks with extended buffers after internal buffer
    */
   void finalizeWithExtendedBuffer(SerializedModelData &md);
 
 private:
   flatbuffers::FlatBufferBuilder _builder;
-  bool _ext_buffer = false;
-  std::string _fb_data_with_ext;
+  std::vector<CircleExporter::Contract::Chunk> _chunks;
 };
 
 } // namespace luci
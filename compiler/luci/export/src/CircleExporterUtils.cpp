@@ -17,6 +17,7 @@
 #include "CircleExporterUtils.h"
 #include "CircleBuiltinTypesMappingRule.h"
 
+#include <luci/IR/DataTypeHelper.h>
 #include <oops/InternalExn.h>
 
 #include <cassert>
@@ -318,4 +319,28 @@ CircleTensorIndex get_tensor_index(loco::Node *node)
   return node->annot<CircleTensorIndexAnnotation>()->index();
 }
 
+bool require_ext_buffer(const luci::Module *module)
+{
+  uint64_t const_size = 0;
+  for (size_t g = 0; g < module->size(); ++g)
+  {
+    for (auto node : loco::all_nodes(module->graph(g)))
+    {
+      auto const_node = dynamic_cast<luci::CircleConst *>(node);
+      if (const_node == nullptr || const_node->dtype() == loco::DataType::STRING)
+        continue;
+
+      uint64_t num_elements = 1;
+      for (uint32_t i = 0; i < const_node->rank(); ++i)
+      {
+        if (const_node->dim(i).known())
+          num_elements *= const_node->dim(i).value();
+      }
+      const_size += num_elements * luci::size(const_node->dtype());
+    }
+  }
+
+  return FLATBUFFERS_SIZE_MAX < const_size + FLATBUFFERS_SIZE_RESERVED;
+}
+
 } // namespace luci
@@ -20,6 +20,7 @@
 #include "SerializedData.h"
 
 #include <luci/IR/CircleNodes.h>
+#include <luci/IR/Module.h>
 #include <luci/Service/ShapeDescription.h>
 
 #include <loco.h>
@@ -28,6 +29,8 @@
 
 // limitation of current flatbuffers file size
 inline constexpr uint64_t FLATBUFFERS_SIZE_MAX = 2147483648UL; // 2GB
+// size reserved for flatbuffers area other than constants
+inline constexpr uint64_t FLATBUFFERS_SIZE_RESERVED = 67108864UL; // 64MB
 
 namespace luci
 {
@@ -70,6 +73,9 @@ inline bool check_size_limit(const flatbuffers::FlatBufferBuilder &fb, const uin
   return FLATBUFFERS_SIZE_MAX < data_size + fb.GetSize();
 }
 
+// check if constants of module cannot be held in flatbuffers area with other data
+bool require_ext_buffer(const luci::Module *module);
+
 } // namespace luci
 
 #endif // __CIRCLE_EXPORTER_UTILS_H__
@@ -352,21 +352,17 @@ encodeOpBufferByDType(FlatBufferBuilder &builder, SerializedModelData &md, luci:
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
-  std::vector<NativeType> raw_data;
+  // Values are stored contiguously in CircleConst
   const uint32_t size = c->size<DT>();
-  raw_data.reserve(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    raw_data.push_back(c->at<DT>(i));
-  }
   const size_t raw_size = size * sizeof(NativeType);
+  const uint8_t *raw_data = size > 0 ? reinterpret_cast<const uint8_t *>(&c->at<DT>(0)) : nullptr;
 
   if (md._ext_buffer)
   {
-    // TODO optimize this if this operation takes long or much memory
+    // Data is written after flatbuffers area when the module is stored
     SerializedModelData::BufferData buffer_data;
-    buffer_data.resize(raw_size);
-    std::memcpy(buffer_data.data(), raw_data.data(), raw_size);
+    buffer_data.data = raw_data;
+    buffer_data.size = raw_size;
 
     int32_t buffer_index = md._buffers.size();
     md._buffer_data_map.emplace(buffer_index, buffer_data);
@@ -380,7 +376,7 @@ encodeOpBufferByDType(FlatBufferBuilder &builder, SerializedModelData &md, luci:
     return md._empty_buffer;
   }
 
-  auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
+  auto array_offset = builder.CreateVector(raw_data, raw_size);
   return CreateBuffer(builder, array_offset);
 }
 
@@ -81,7 +81,9 @@ int entry(const int argc, char **argv)
     .help("Hyperparameter (C) to compute moving average (default: 0.1). Update equation: avg <- "
           "avg + C * (curr_batch_avg - avg)");
 
-  arser.add_argument("--mode").help("Record mode. percentile (default) or moving_average");
+  arser.add_argument("--mode").help(
+    "Record mode. percentile (default), moving_average or entropy. entropy clips min/max to the "
+    "threshold minimizing KL divergence between histograms of activations and quantized ones");
 
   arser.add_argument("--input_data_format")
     .help("Input data format. h5/hdf5 (default) or list/filelist");
@@ -122,7 +124,7 @@ int entry(const int argc, char **argv)
   std::string mode = ::get_values_from<std::string>(arser, "--mode", "percentile");
   uint32_t moving_avg_batch = ::get_values_from<int>(arser, "--moving_avg_batch", 16);
   float moving_avg_const = ::get_values_from<float>(arser, "--moving_avg_const", 0.1);
-  if (mode != "percentile" && mode != "moving_average")
+  if (mode != "percentile" && mode != "moving_average" && mode != "entropy")
     throw std::runtime_error("Unsupported mode");
   std::string input_data_format =
     ::get_values_from<std::string>(arser, "--input_data_format", "h5");
@@ -139,6 +141,11 @@ int entry(const int argc, char **argv)
     {
       computer = make_moving_avg_computer(moving_avg_batch, moving_avg_const);
     }
+    else if (mode == "entropy")
+    {
+      // Absolute values are quantized to half of 8 bit levels
+      computer = make_entropy_computer(128);
+    }
     else
     {
       assert(false);
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_HISTOGRAM_H__
+#define __RECORD_MINMAX_HISTOGRAM_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Histogram of absolute values, which grows its range as values come
+ *
+ * The range is always a power of 2. When a value is out of the range, the range is doubled and
+ * adjacent bins are merged. So histograms built from different values share bin edges, and they
+ * are merged exactly after the smaller one is grown to the larger range.
+ */
+class Histogram
+{
+public:
+  explicit Histogram(uint32_t num_bins = 2048);
+
+public:
+  // Add values whose absolute values are not larger than abs_max
+  void add(const float *values, uint32_t num_values, float abs_max);
+
+  void merge(const Histogram &other);
+
+  bool empty() const { return _count == 0; }
+
+  uint32_t numBins() const { return _num_bins; }
+
+  float range() const { return _range; }
+
+  const std::vector<uint64_t> &bins() const { return _bins; }
+
+  /**
+   * @brief Return the threshold of absolute values which loses the least information
+   *
+   * Values over the threshold are clipped and the others are quantized to num_quantized_bins
+   * levels. The threshold minimizes KL divergence between the histogram and the quantized one.
+   */
+  float entropyThreshold(uint32_t num_quantized_bins) const;
+
+private:
+  void grow(float abs_max);
+
+private:
+  uint32_t _num_bins;
+  std::vector<uint64_t> _bins;
+  // Upper edge of the last bin, 0 if every value was 0
+  float _range = 0.0f;
+  uint64_t _count = 0;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_HISTOGRAM_H__
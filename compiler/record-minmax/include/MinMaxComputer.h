@@ -40,6 +40,9 @@ public:
   // Child class must implement this
   virtual void
   update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map) = 0;
+
+  // Statistics which should be recorded for update_qparam
+  virtual StatType stat_type() const = 0;
 };
 
 class PercentileComputer : public MinMaxComputer
@@ -53,6 +56,8 @@ public:
   virtual void
   update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
 
+  virtual StatType stat_type() const { return StatType::QUANTILE_SKETCH; }
+
 private:
   float _min_percentile = 0.0;
   float _max_percentile = 0.0;
@@ -69,17 +74,42 @@ public:
   virtual void
   update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
 
+  // Moving average depends on the order of records
+  virtual StatType stat_type() const { return StatType::MINMAX_VECTORS; }
+
 private:
   uint32_t _batch_size = 0;
   float _update_const = 0.0;
 };
 
+/**
+ * @brief Clip min/max to the threshold of absolute values which minimizes KL divergence between
+ *        the histogram of values and its quantized one
+ */
+class EntropyComputer : public MinMaxComputer
+{
+public:
+  explicit EntropyComputer(uint32_t num_quantized_bins) : _num_quantized_bins(num_quantized_bins)
+  {
+  }
+
+  virtual void
+  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
+
+  virtual StatType stat_type() const { return StatType::HISTOGRAM; }
+
+private:
+  uint32_t _num_quantized_bins = 0;
+};
+
 std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile,
                                                          float max_percentile);
 
 std::unique_ptr<MinMaxComputer> make_moving_avg_computer(uint32_t batch_size,
                                                          float moving_avg_const);
 
+std::unique_ptr<MinMaxComputer> make_entropy_computer(uint32_t num_quantized_bins);
+
 } // namespace record_minmax
 
 #endif // __RECORD_MINMAX_MINMAXCOMPUTER_H__
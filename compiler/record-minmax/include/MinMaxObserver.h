@@ -22,6 +22,7 @@
 
 #include "MinMaxVectors.h"
 
+#include <cassert>
 #include <vector>
 #include <unordered_map>
 
@@ -31,21 +32,50 @@ namespace record_minmax
 class MinMaxMap
 {
 public:
+  explicit MinMaxMap(StatType stat_type = StatType::MINMAX_VECTORS) : _stat_type(stat_type) {}
+
+  StatType statType() const { return _stat_type; }
+
   // Record min/max of node
   void recordMinMax(const luci::CircleNode *node, float min, float max)
   {
     MinMaxVectors &vectors = _minmax_map[node];
-    vectors.min_vector.push_back(min);
-    vectors.max_vector.push_back(max);
+    if (_stat_type == StatType::MINMAX_VECTORS)
+    {
+      vectors.min_vector.push_back(min);
+      vectors.max_vector.push_back(max);
+    }
+    else
+    {
+      vectors.min_sketch.add(min);
+      vectors.max_sketch.add(max);
+    }
   }
 
-  void appendMinMaxVector(const luci::CircleNode *node, const MinMaxVectors &minmax_vector)
+  // Record values of node, whose absolute values are not larger than abs_max
+  void recordHistogram(const luci::CircleNode *node, const float *values, uint32_t num_values,
+                       float abs_max)
   {
-    MinMaxVectors &vectors = _minmax_map[node];
-    vectors.min_vector.insert(vectors.min_vector.end(), minmax_vector.min_vector.begin(),
-                              minmax_vector.min_vector.end());
-    vectors.max_vector.insert(vectors.max_vector.end(), minmax_vector.max_vector.begin(),
-                              minmax_vector.max_vector.end());
+    assert(_stat_type == StatType::HISTOGRAM);
+    _minmax_map[node].histogram.add(values, num_values, abs_max);
+  }
+
+  // Append min/max vectors of other after this, or merge sketches and histograms
+  void merge(const MinMaxMap &other)
+  {
+    assert(_stat_type == other._stat_type);
+    for (const auto &iter : other._minmax_map)
+    {
+      MinMaxVectors &vectors = _minmax_map[iter.first];
+      const MinMaxVectors &minmax = iter.second;
+      vectors.min_vector.insert(vectors.min_vector.end(), minmax.min_vector.begin(),
+                                minmax.min_vector.end());
+      vectors.max_vector.insert(vectors.max_vector.end(), minmax.max_vector.begin(),
+                                minmax.max_vector.end());
+      vectors.min_sketch.merge(minmax.min_sketch);
+      vectors.max_sketch.merge(minmax.max_sketch);
+      vectors.histogram.merge(minmax.histogram);
+    }
   }
 
   const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *getMap() const
@@ -54,13 +84,14 @@ public:
   }
 
 private:
+  StatType _stat_type;
   std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
 };
 
 class MinMaxObserver : public luci_interpreter::ExecutionObserver
 {
 public:
-  MinMaxObserver()
+  explicit MinMaxObserver(StatType stat_type = StatType::MINMAX_VECTORS) : _minmax_data(stat_type)
   {
     // Do nothing
   }
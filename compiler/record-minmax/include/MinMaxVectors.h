@@ -17,15 +17,32 @@
 #ifndef __RECORD_MINMAX_MINMAXVECTORS_H__
 #define __RECORD_MINMAX_MINMAXVECTORS_H__
 
+#include "Histogram.h"
+#include "QuantileSketch.h"
+
 #include <vector>
 
 namespace record_minmax
 {
 
+// Statistics recorded for each node
+enum class StatType
+{
+  // min/max of every record in order
+  MINMAX_VECTORS,
+  // Sketches of min/max, whose memory does not grow with the number of records
+  QUANTILE_SKETCH,
+  // Sketches of min/max and a histogram of values
+  HISTOGRAM,
+};
+
 struct MinMaxVectors
 {
   std::vector<float> min_vector;
   std::vector<float> max_vector;
+  QuantileSketch min_sketch;
+  QuantileSketch max_sketch;
+  Histogram histogram;
 };
 
 } // namespace record_minmax
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_QUANTILE_SKETCH_H__
+#define __RECORD_MINMAX_QUANTILE_SKETCH_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Mergeable quantile sketch whose memory is bounded regardless of the number of values
+ *
+ * Values are kept in levels, and a value in level h stands for 2^h values. When a level is full,
+ * it is sorted and every other value is promoted to the next level (KLL). Lower levels get smaller
+ * capacities, so the whole sketch holds about 3 * capacity values and the rank error is about
+ * 1 / capacity. Compaction alternates the kept half per level instead of random choice, so results
+ * are reproducible.
+ *
+ * Until the first compaction the sketch is exact, and percentile() is the same as
+ * getNthPercentile(). The smallest and the largest values are always exact.
+ */
+class QuantileSketch
+{
+public:
+  explicit QuantileSketch(uint32_t capacity = 2048);
+
+public:
+  void add(float value);
+
+  void merge(const QuantileSketch &other);
+
+  uint64_t count() const { return _count; }
+
+  bool empty() const { return _count == 0; }
+
+  // Return the n'th percentile with linear interpolation between values
+  float percentile(float percentile) const;
+
+private:
+  uint32_t levelCapacity(uint32_t level) const;
+  uint64_t numStored() const;
+  uint64_t maxStored() const;
+  void compact();
+
+private:
+  uint32_t _capacity;
+  std::vector<std::vector<float>> _levels;
+  // Which half of a level is promoted by its next compaction
+  std::vector<bool> _odd;
+  uint64_t _count = 0;
+  float _min = 0.0f;
+  float _max = 0.0f;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_QUANTILE_SKETCH_H__
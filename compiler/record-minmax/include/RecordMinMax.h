@@ -29,10 +29,6 @@
 namespace record_minmax
 {
 
-using Buffer = std::vector<char>;
-using Output = std::vector<Buffer>;
-using WholeOutput = std::vector<Output>;
-
 class RecordMinMax
 {
 public:
@@ -71,8 +67,6 @@ private:
     return _observers[0].get();
   }
 
-  WholeOutput importH5Data(const std::string &input_data_path);
-
   std::unique_ptr<luci::Module> _module;
 
   // Multiple interpreters are used for parallel execution
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Histogram.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+// Candidates of threshold are limited to this number for a histogram
+const uint32_t max_candidates = 256;
+
+// Probability of a quantized bin which is empty but should not be
+const double empty_probability = 1e-10;
+
+} // namespace
+
+namespace record_minmax
+{
+
+Histogram::Histogram(uint32_t num_bins) : _num_bins(num_bins)
+{
+  if (_num_bins < 2 || _num_bins % 2 != 0)
+    throw std::runtime_error("Number of histogram bins must be a positive even number");
+}
+
+// Double the range until abs_max is in it
+void Histogram::grow(float abs_max)
+{
+  if (abs_max == 0.0f)
+    return;
+
+  if (_range == 0.0f)
+  {
+    _range = std::exp2(std::ceil(std::log2(abs_max)));
+    // log2 may be rounded down
+    if (_range < abs_max)
+      _range *= 2.0f;
+    return;
+  }
+
+  while (_range < abs_max)
+  {
+    for (uint32_t i = 0; i < _num_bins / 2; ++i)
+      _bins[i] = _bins[2 * i] + _bins[2 * i + 1];
+    std::fill(_bins.begin() + _num_bins / 2, _bins.end(), 0);
+    _range *= 2.0f;
+  }
+}
+
+void Histogram::add(const float *values, uint32_t num_values, float abs_max)
+{
+  if (_bins.empty())
+    _bins.resize(_num_bins, 0);
+
+  grow(abs_max);
+
+  for (uint32_t i = 0; i < num_values; ++i)
+  {
+    const float value = values[i];
+    // Same values as min/max recording are skipped
+    if (std::isnan(value) || value == std::numeric_limits<float>::lowest())
+      continue;
+
+    uint32_t index = 0;
+    if (_range > 0.0f)
+    {
+      const float scaled = std::abs(value) / _range * _num_bins;
+      index = std::min(_num_bins - 1, static_cast<uint32_t>(scaled));
+    }
+    _bins[index]++;
+    _count++;
+  }
+}
+
+void Histogram::merge(const Histogram &other)
+{
+  if (other.empty())
+    return;
+
+  if (_num_bins != other._num_bins)
+    throw std::runtime_error("Histograms with different number of bins cannot be merged");
+
+  if (_bins.empty())
+    _bins.resize(_num_bins, 0);
+
+  grow(other._range);
+
+  // Both ranges are powers of 2, so a bin of other falls into a bin of this
+  const double ratio = other._range == 0.0f ? 0.0 : static_cast<double>(_range) / other._range;
+  for (uint32_t i = 0; i < _num_bins; ++i)
+  {
+    const bool first_bin = ratio == 0.0 || ratio >= _num_bins;
+    _bins[first_bin ? 0 : static_cast<uint32_t>(i / ratio)] += other._bins[i];
+  }
+  _count += other._count;
+}
+
+float Histogram::entropyThreshold(uint32_t num_quantized_bins) const
+{
+  if (num_quantized_bins == 0)
+    throw std::runtime_error("Number of quantized bins must be positive");
+
+  if (empty() || _range == 0.0f)
+    return 0.0f;
+
+  const float bin_width = _range / _num_bins;
+  uint32_t num_used = _num_bins;
+  while (_bins[num_used - 1] == 0)
+    num_used--;
+
+  // Nothing is lost if every used bin has its own level
+  if (num_used <= num_quantized_bins)
+    return num_used * bin_width;
+
+  // outliers[i] is the number of values in bins [i, num_used)
+  std::vector<uint64_t> outliers(num_used + 1, 0);
+  for (uint32_t i = num_used; i > 0; --i)
+    outliers[i - 1] = outliers[i] + _bins[i - 1];
+
+  // The last candidate keeps every used bin
+  const uint32_t step = std::max(1u, (num_used - num_quantized_bins) / max_candidates);
+  std::vector<uint32_t> candidates;
+  for (uint32_t num_kept = num_quantized_bins; num_kept < num_used; num_kept += step)
+    candidates.push_back(num_kept);
+  candidates.push_back(num_used);
+
+  double best_divergence = std::numeric_limits<double>::max();
+  uint32_t best_bins = num_used;
+  std::vector<double> quantized(num_used);
+  for (const auto num_kept : candidates)
+  {
+    // Values over the kept bins are clipped to the last kept bin
+    const double total = static_cast<double>(outliers[0]);
+
+    // Each level spreads its count evenly over its non-empty bins
+    for (uint32_t level = 0; level < num_quantized_bins; ++level)
+    {
+      const uint32_t begin = static_cast<uint64_t>(level) * num_kept / num_quantized_bins;
+      const uint32_t end = static_cast<uint64_t>(level + 1) * num_kept / num_quantized_bins;
+      uint64_t sum = 0;
+      uint32_t non_empty = 0;
+      for (uint32_t i = begin; i < end; ++i)
+      {
+        sum += _bins[i];
+        non_empty += _bins[i] != 0 ? 1 : 0;
+      }
+      for (uint32_t i = begin; i < end; ++i)
+        quantized[i] = _bins[i] != 0 ? static_cast<double>(sum) / non_empty : 0.0;
+    }
+    const double quantized_total = static_cast<double>(outliers[0] - outliers[num_kept]);
+
+    double divergence = 0.0;
+    for (uint32_t i = 0; i < num_kept; ++i)
+    {
+      const uint64_t count = i + 1 == num_kept ? _bins[i] + outliers[num_kept] : _bins[i];
+      if (count == 0)
+        continue;
+      const double p = count / total;
+      const double q = std::max(quantized[i] / quantized_total, empty_probability);
+      divergence += p * std::log(p / q);
+    }
+
+    if (divergence < best_divergence)
+    {
+      best_divergence = divergence;
+      best_bins = num_kept;
+    }
+  }
+
+  return best_bins * bin_width;
+}
+
+} // namespace record_minmax
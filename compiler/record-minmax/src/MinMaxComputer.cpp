@@ -19,6 +19,8 @@
 
 #include <luci/IR/CircleQuantParam.h>
 
+#include <algorithm>
+
 namespace record_minmax
 {
 
@@ -31,10 +33,10 @@ void PercentileComputer::update_qparam(
   for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
   {
     auto node = iter->first;
-    auto minmax = iter->second;
+    const auto &minmax = iter->second;
 
-    auto min = getNthPercentile(minmax.min_vector, _min_percentile);
-    auto max = getNthPercentile(minmax.max_vector, _max_percentile);
+    auto min = minmax.min_sketch.percentile(_min_percentile);
+    auto max = minmax.max_sketch.percentile(_max_percentile);
 
     auto quantparam = std::make_unique<luci::CircleQuantParam>();
     quantparam->min.push_back(min);
@@ -56,7 +58,7 @@ void MovingAvgComputer::update_qparam(
   for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
   {
     auto node = iter->first;
-    auto minmax = iter->second;
+    const auto &minmax = iter->second;
 
     auto min = getMovingAverage(minmax.min_vector, 1 - _update_const, _batch_size, true);
     auto max = getMovingAverage(minmax.max_vector, 1 - _update_const, _batch_size, false);
@@ -72,6 +74,32 @@ void MovingAvgComputer::update_qparam(
   }
 }
 
+void EntropyComputer::update_qparam(
+  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map)
+{
+  if (minmax_map == nullptr)
+    throw std::invalid_argument("minmax_map is nullptr");
+
+  for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
+  {
+    auto node = iter->first;
+    const auto &minmax = iter->second;
+
+    const auto threshold = minmax.histogram.entropyThreshold(_num_quantized_bins);
+    auto min = std::max(minmax.min_sketch.percentile(0.0f), -threshold);
+    auto max = std::min(minmax.max_sketch.percentile(100.0f), threshold);
+
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    quantparam->min.push_back(min);
+    quantparam->max.push_back(max);
+
+    assert(node->quantparam() == nullptr);
+
+    auto mutable_node = const_cast<luci::CircleNode *>(node);
+    mutable_node->quantparam(std::move(quantparam));
+  }
+}
+
 std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile, float max_percentile)
 {
   return std::make_unique<PercentileComputer>(min_percentile, max_percentile);
@@ -83,4 +111,9 @@ std::unique_ptr<MinMaxComputer> make_moving_avg_computer(uint32_t batch_size,
   return std::make_unique<MovingAvgComputer>(batch_size, moving_avg_const);
 }
 
+std::unique_ptr<MinMaxComputer> make_entropy_computer(uint32_t num_quantized_bins)
+{
+  return std::make_unique<EntropyComputer>(num_quantized_bins);
+}
+
 } // namespace record_minmax
@@ -18,6 +18,8 @@
 
 #include <luci/IR/CircleOpcode.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <math.h>
 
@@ -83,14 +85,13 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   const auto data = tensor->data<float>();
   const auto num_elements = tensor->shape().num_elements();
 
-  std::vector<float> buf(data, data + num_elements);
-
   float max = std::numeric_limits<float>::lowest();
   float min = std::numeric_limits<float>::max();
 
   bool all_nan = true;
-  for (auto number : buf)
+  for (int32_t i = 0; i < num_elements; ++i)
   {
+    const auto number = data[i];
     if (isnan(number))
       continue;
 
@@ -111,6 +112,12 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
     throw std::runtime_error("All values are NaN(Not a Number)");
 
   _minmax_data.recordMinMax(node, min, max);
+
+  if (_minmax_data.statType() == StatType::HISTOGRAM)
+  {
+    const auto abs_max = std::max(std::abs(min), std::abs(max));
+    _minmax_data.recordHistogram(node, data, num_elements, abs_max);
+  }
 }
 
 } // namespace record_minmax
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QuantileSketch.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace record_minmax
+{
+
+QuantileSketch::QuantileSketch(uint32_t capacity) : _capacity(capacity)
+{
+  if (_capacity < 2)
+    throw std::runtime_error("Capacity of a quantile sketch must be 2 or more");
+}
+
+// Capacity shrinks by 2/3 per level below the top level
+uint32_t QuantileSketch::levelCapacity(uint32_t level) const
+{
+  assert(level < _levels.size());
+  const auto depth = static_cast<double>(_levels.size() - 1 - level);
+  const auto capacity = std::ceil(_capacity * std::pow(2.0 / 3.0, depth));
+  return std::max(2u, static_cast<uint32_t>(capacity));
+}
+
+uint64_t QuantileSketch::numStored() const
+{
+  uint64_t res = 0;
+  for (const auto &level : _levels)
+    res += level.size();
+  return res;
+}
+
+uint64_t QuantileSketch::maxStored() const
+{
+  uint64_t res = 0;
+  for (uint32_t level = 0; level < _levels.size(); ++level)
+    res += levelCapacity(level);
+  return res;
+}
+
+// Promote half of the lowest full level to the next level
+void QuantileSketch::compact()
+{
+  uint32_t level = 0;
+  while (_levels[level].size() < levelCapacity(level))
+  {
+    ++level;
+    assert(level < _levels.size()); // FIX_CALLER_UNLESS
+  }
+
+  if (level + 1 == _levels.size())
+  {
+    _levels.emplace_back();
+    _odd.push_back(false);
+  }
+
+  auto &items = _levels[level];
+  std::sort(items.begin(), items.end());
+
+  // An odd item is left in this level
+  const auto num_pairs = items.size() / 2;
+  auto &next = _levels[level + 1];
+  const size_t offset = _odd[level] ? 1 : 0;
+  for (size_t i = 0; i < num_pairs; ++i)
+    next.push_back(items[2 * i + offset]);
+  _odd[level] = not _odd[level];
+
+  if (items.size() % 2 == 1)
+    items.front() = items.back();
+  items.resize(items.size() % 2);
+}
+
+void QuantileSketch::add(float value)
+{
+  if (_levels.empty())
+  {
+    _levels.emplace_back();
+    _odd.push_back(false);
+    _min = value;
+    _max = value;
+  }
+
+  _levels[0].push_back(value);
+  _min = std::min(_min, value);
+  _max = std::max(_max, value);
+  ++_count;
+
+  if (numStored() > maxStored())
+    compact();
+}
+
+void QuantileSketch::merge(const QuantileSketch &other)
+{
+  if (other.empty())
+    return;
+
+  if (empty())
+  {
+    _min = other._min;
+    _max = other._max;
+  }
+
+  while (_levels.size() < other._levels.size())
+  {
+    _levels.emplace_back();
+    _odd.push_back(false);
+  }
+  for (uint32_t level = 0; level < other._levels.size(); ++level)
+  {
+    const auto &items = other._levels[level];
+    _levels[level].insert(_levels[level].end(), items.begin(), items.end());
+  }
+  _min = std::min(_min, other._min);
+  _max = std::max(_max, other._max);
+  _count += other._count;
+
+  while (numStored() > maxStored())
+    compact();
+}
+
+float QuantileSketch::percentile(float percentile) const
+{
+  if (percentile < 0 || percentile > 100)
+    throw std::runtime_error("Percentile must be ranged from 0 to 100");
+
+  if (empty())
+    throw std::runtime_error("Percentile must take a non-empty sketch");
+
+  // (value, weight) of stored items in ascending order
+  std::vector<std::pair<float, uint64_t>> items;
+  items.reserve(numStored());
+  for (uint32_t level = 0; level < _levels.size(); ++level)
+  {
+    for (auto value : _levels[level])
+      items.emplace_back(value, uint64_t{1} << level);
+  }
+  std::sort(items.begin(), items.end());
+
+  // An item of weight w covers ranks [begin, begin + w), and stands at the center of them.
+  // The smallest and the largest values stand at the first and the last ranks.
+  const double rank = (_count - 1) * static_cast<double>(percentile) / 100.0;
+  double prev_rank = 0.0;
+  float prev_value = _min;
+  uint64_t begin = 0;
+  for (const auto &item : items)
+  {
+    const double center = begin + (item.second - 1) / 2.0;
+    if (rank <= center)
+    {
+      if (center == prev_rank)
+        return item.first;
+      const double fraction = (rank - prev_rank) / (center - prev_rank);
+      return static_cast<float>(prev_value + fraction * (item.first - prev_value));
+    }
+    prev_rank = center;
+    prev_value = item.first;
+    begin += item.second;
+  }
+
+  const double last = static_cast<double>(_count - 1);
+  if (last == prev_rank)
+    return _max;
+  const double fraction = (rank - prev_rank) / (last - prev_rank);
+  return static_cast<float>(prev_value + fraction * (_max - prev_value));
+}
+
+} // namespace record_minmax
@@ -27,11 +27,13 @@
 
 #include <dirent.h>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <fstream>
 #include <numeric>
 #include <stdexcept>
 #include <iostream>
+#include <mutex>
 #include <random>
 
 using Shape = std::vector<loco::Dimension>;
@@ -70,17 +72,6 @@ std::vector<std::string> parse_line(const std::string &line)
   return res;
 }
 
-// Max h5 file size for parallel recording in bytes = 1 GB
-const long h5_max_size_bytes = 1000000000;
-
-long getH5FileSize(const std::string &input_data_path)
-{
-  std::ifstream in_file(input_data_path, std::ios::binary);
-  in_file.seekg(0, std::ios::end);
-
-  return in_file.tellg();
-}
-
 uint32_t numElements(const luci::CircleNode *node)
 {
   uint32_t num_elements = 1;
@@ -198,7 +189,9 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   for (uint32_t thread_idx = 0; thread_idx < _threads_size; ++thread_idx)
   {
     auto interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
-    auto observer = std::make_unique<MinMaxObserver>();
+    // Same model is interpreted for every record
+    interpreter->enableStaticPlan();
+    auto observer = std::make_unique<MinMaxObserver>(_minmax_computer->stat_type());
 
     interpreter->attachObserver(observer.get());
 
@@ -369,64 +362,6 @@ void RecordMinMax::profileRawData(const std::string &input_data_path)
   _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
 }
 
-WholeOutput RecordMinMax::importH5Data(const std::string &input_data_path)
-{
-  try
-  {
-    dio::hdf5::HDF5Importer importer(input_data_path);
-    importer.importGroup("value");
-
-    bool is_raw_data = importer.isRawData();
-
-    const auto num_records = importer.numData();
-    if (num_records == 0)
-      throw std::runtime_error("The input data file does not contain any record.");
-
-    const auto input_nodes = loco::input_nodes(_module->graph());
-    const auto num_inputs = input_nodes.size();
-
-    WholeOutput whole_output(num_records);
-
-    // Read inputs to whole_output
-    for (int i = 0; i < num_records; ++i)
-    {
-      if (num_inputs != static_cast<uint32_t>(importer.numInputs(i)))
-        throw std::runtime_error("Wrong number of inputs.");
-
-      for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
-      {
-        const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-        assert(input_node->index() == input_idx);
-        checkInputDimension(input_node);
-        Buffer input_data(getTensorSize(input_node));
-
-        if (!is_raw_data)
-        {
-          DataType dtype;
-          Shape shape;
-          importer.readTensor(i, input_idx, &dtype, &shape, input_data.data(), input_data.size());
-
-          // Check the type and the shape of the input data is valid
-          verifyTypeShape(input_node, dtype, shape);
-        }
-        else
-        {
-          // Skip type/shape check for raw data
-          importer.readTensor(i, input_idx, input_data.data(), input_data.size());
-        }
-        whole_output[i].emplace_back(std::move(input_data));
-      }
-    }
-
-    return whole_output;
-  }
-  catch (const H5::Exception &e)
-  {
-    H5::Exception::printErrorStack();
-    throw std::runtime_error("HDF5 error occurred.");
-  }
-}
-
 void RecordMinMax::profileData(const std::string &input_data_path)
 {
   try
@@ -499,79 +434,132 @@ void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
   assert(_interpreters.size() == _threads_size);
   assert(_observers.size() == _threads_size);
 
-  const long h5_file_size = getH5FileSize(input_data_path);
-
-  if (h5_file_size > h5_max_size_bytes)
-    throw std::runtime_error("H5 file size is too large for parallel recording");
+  const auto input_nodes = loco::input_nodes(_module->graph());
+  const auto num_inputs = input_nodes.size();
+  for (auto input : input_nodes)
+    checkInputDimension(loco::must_cast<const luci::CircleInput *>(input));
 
-  WholeOutput whole_output;
+  uint32_t num_records = 0;
   try
   {
-    whole_output = importH5Data(input_data_path);
-  }
-  catch (const std::bad_alloc &e)
-  {
-    throw std::runtime_error("Out of memory during h5 data load.");
-  }
+    // Records are read when they are interpreted, so memory does not depend on the file size
+    dio::hdf5::HDF5Importer importer(input_data_path);
+    importer.importGroup("value");
 
-  const auto num_records = whole_output.size();
-  const auto input_nodes = loco::input_nodes(_module->graph());
+    const bool is_raw_data = importer.isRawData();
+
+    num_records = static_cast<uint32_t>(importer.numData());
+    if (num_records == 0)
+      throw std::runtime_error("The input data file does not contain any record.");
 
-  // Start parallel part
-  INFO(l) << _threads_size << " concurrent threads are supported." << std::endl;
+    // Start parallel part
+    INFO(l) << _threads_size << " concurrent threads are supported." << std::endl;
 
-  const auto run_threads = num_records < _threads_size ? num_records : _threads_size;
+    const auto run_threads = std::min(num_records, _threads_size);
 
-  const auto records_batch = static_cast<uint32_t>(num_records / run_threads);
+    const auto records_batch = num_records / run_threads;
 
-  auto interpret_batch = [&whole_output, &input_nodes](int first_record, int last_record,
-                                                       luci_interpreter::Interpreter *interpreter) {
-    for (int record_index = first_record; record_index < last_record; ++record_index)
-    {
-      for (uint32_t input_idx = 0; input_idx < input_nodes.size(); input_idx++)
+    // HDF5 library is not thread-safe
+    std::mutex importer_mutex;
+    std::atomic<bool> failed(false);
+    std::vector<std::exception_ptr> errors(run_threads);
+
+    // Each thread takes consecutive records, so min/max vectors keep the order of records
+    auto interpret_batch = [&](uint32_t thread_idx, uint32_t first_record, uint32_t last_record) {
+      auto interpreter = _interpreters[thread_idx].get();
+      try
       {
-        const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+        // Buffers are reused for every record
+        std::vector<std::vector<char>> input_data(num_inputs);
+        for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+        {
+          const auto *input_node =
+            loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+          input_data[input_idx].resize(getTensorSize(input_node));
+        }
 
-        const auto &cur_input_data = whole_output[record_index][input_idx];
-        interpreter->writeInputTensor(input_node, cur_input_data.data(), cur_input_data.size());
+        for (uint32_t record_idx = first_record; record_idx < last_record; ++record_idx)
+        {
+          if (failed)
+            return;
+
+          {
+            std::lock_guard<std::mutex> lock(importer_mutex);
+            if (num_inputs != static_cast<uint32_t>(importer.numInputs(record_idx)))
+              throw std::runtime_error("Wrong number of inputs.");
+
+            for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+            {
+              const auto *input_node =
+                loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+              assert(input_node->index() == input_idx);
+              auto &buffer = input_data[input_idx];
+
+              if (!is_raw_data)
+              {
+                DataType dtype;
+                Shape shape;
+                importer.readTensor(record_idx, input_idx, &dtype, &shape, buffer.data(),
+                                    buffer.size());
+
+                // Check the type and the shape of the input data is valid
+                verifyTypeShape(input_node, dtype, shape);
+              }
+              else
+              {
+                // Skip type/shape check for raw data
+                importer.readTensor(record_idx, input_idx, buffer.data(), buffer.size());
+              }
+            }
+          }
+
+          for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+          {
+            const auto *input_node =
+              loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+            const auto &buffer = input_data[input_idx];
+            interpreter->writeInputTensor(input_node, buffer.data(), buffer.size());
+          }
+          interpreter->interpret();
+        }
       }
-      interpreter->interpret();
-    }
-  };
+      catch (...)
+      {
+        // Rethrown by the main thread
+        errors[thread_idx] = std::current_exception();
+        failed = true;
+      }
+    };
 
-  std::vector<std::thread> threads;
-  for (uint32_t t = 0; t < run_threads; ++t)
-  {
-    if (t < run_threads - 1)
-    {
-      threads.emplace_back(interpret_batch, records_batch * t, records_batch * (t + 1),
-                           _interpreters[t].get());
-    }
-    else
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < run_threads; ++t)
     {
-      threads.emplace_back(interpret_batch, records_batch * t, num_records, _interpreters[t].get());
+      const auto last_record = t < run_threads - 1 ? records_batch * (t + 1) : num_records;
+      threads.emplace_back(interpret_batch, t, records_batch * t, last_record);
     }
-  }
-
-  for (uint32_t i = 0; i < run_threads; ++i)
-    threads.at(i).join();
 
-  // End parallel part
+    for (uint32_t i = 0; i < run_threads; ++i)
+      threads.at(i).join();
 
-  // Copy all min, max values to one min/max map
-  MinMaxMap main_min_max_map;
+    // End parallel part
 
-  for (const auto &obs : _observers)
-  {
-    const auto cur_minmax_map = obs->minMaxData()->getMap();
-    for (auto &iter : *cur_minmax_map)
+    for (const auto &error : errors)
     {
-      const auto node = iter.first;
-      const auto &minmax = iter.second;
-
-      main_min_max_map.appendMinMaxVector(node, minmax);
+      if (error)
+        std::rethrow_exception(error);
     }
   }
+  catch (const H5::Exception &e)
+  {
+    H5::Exception::printErrorStack();
+    throw std::runtime_error("HDF5 error occurred.");
+  }
+
+  // Merge min/max of all threads to one min/max map
+  MinMaxMap main_min_max_map(_minmax_computer->stat_type());
+
+  for (const auto &obs : _observers)
+    main_min_max_map.merge(*obs->minMaxData());
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Histogram.h"
+
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace record_minmax
+{
+
+TEST(HistogramTest, Add)
+{
+  Histogram histogram(8);
+  std::vector<float> values{0.0f, -0.3f, 0.6f, 3.0f, std::numeric_limits<float>::quiet_NaN()};
+  histogram.add(values.data(), values.size(), 3.0f);
+
+  // NaN is skipped and the range is rounded up to a power of 2
+  EXPECT_FLOAT_EQ(4.0f, histogram.range());
+  const std::vector<uint64_t> expected{2, 1, 0, 0, 0, 0, 1, 0};
+  EXPECT_EQ(expected, histogram.bins());
+}
+
+TEST(HistogramTest, Grow)
+{
+  Histogram histogram(8);
+  std::vector<float> small{0.1f, 0.6f, 0.9f};
+  histogram.add(small.data(), small.size(), 0.9f);
+  EXPECT_FLOAT_EQ(1.0f, histogram.range());
+
+  std::vector<float> large{3.5f};
+  histogram.add(large.data(), large.size(), 3.5f);
+  EXPECT_FLOAT_EQ(4.0f, histogram.range());
+  const std::vector<uint64_t> expected{1, 2, 0, 0, 0, 0, 0, 1};
+  EXPECT_EQ(expected, histogram.bins());
+}
+
+TEST(HistogramTest, Merge)
+{
+  std::vector<float> first{0.1f, -0.6f, 0.9f, 0.0f};
+  std::vector<float> second{3.5f, -1.2f};
+
+  Histogram whole(8);
+  whole.add(first.data(), first.size(), 0.9f);
+  whole.add(second.data(), second.size(), 3.5f);
+
+  Histogram a(8), b(8);
+  a.add(first.data(), first.size(), 0.9f);
+  b.add(second.data(), second.size(), 3.5f);
+  b.merge(a);
+
+  EXPECT_FLOAT_EQ(whole.range(), b.range());
+  EXPECT_EQ(whole.bins(), b.bins());
+}
+
+TEST(HistogramTest, EntropyThreshold)
+{
+  Histogram histogram(2048);
+  std::vector<float> values;
+  for (int i = 0; i < 100000; ++i)
+    values.push_back(static_cast<float>(i % 1001 - 500) / 500.0f);
+  values.push_back(64.0f);
+  histogram.add(values.data(), values.size(), 64.0f);
+
+  // A single outlier is clipped
+  const auto threshold = histogram.entropyThreshold(128);
+  EXPECT_LE(1.0f, threshold);
+  EXPECT_GT(64.0f, threshold);
+}
+
+TEST(HistogramTest, EntropyThresholdFewBins)
+{
+  Histogram histogram(2048);
+  std::vector<float> values{0.5f, 1.0f};
+  histogram.add(values.data(), values.size(), 1.0f);
+
+  // Every value has its own level, so nothing is clipped
+  EXPECT_LE(1.0f, histogram.entropyThreshold(128));
+}
+
+TEST(HistogramTest, NumBins_NEG)
+{
+  EXPECT_ANY_THROW(Histogram histogram(0));
+  EXPECT_ANY_THROW(Histogram histogram(7));
+}
+
+TEST(HistogramTest, MergeNumBins_NEG)
+{
+  std::vector<float> values{1.0f};
+  Histogram a(8), b(16);
+  b.add(values.data(), values.size(), 1.0f);
+
+  EXPECT_ANY_THROW(a.merge(b));
+}
+
+} // namespace record_minmax
@@ -31,15 +31,30 @@ TEST(MinMaxComputerTest, percentile)
   luci::CircleAdd node;
   MinMaxVectors minmax;
   {
-    minmax.min_vector = {1.0, 2.0, 3.0};
-    minmax.max_vector = {4.0, 5.0, 6.0};
+    for (float value : {1.0, 2.0, 3.0})
+      minmax.min_sketch.add(value);
+    for (float value : {4.0, 5.0, 6.0})
+      minmax.max_sketch.add(value);
   }
   std::unordered_map<const luci::CircleNode *, MinMaxVectors> min_max_map;
   min_max_map.insert({&node, minmax});
 
   computer->update_qparam(&min_max_map);
 
-  EXPECT_TRUE(node.quantparam() != nullptr);
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  EXPECT_FLOAT_EQ(1.0, node.quantparam()->min[0]);
+  EXPECT_FLOAT_EQ(6.0, node.quantparam()->max[0]);
+}
+
+TEST(MinMaxComputerTest, percentile_empty_NEG)
+{
+  auto computer = make_percentile_computer(0.0, 100.0);
+
+  luci::CircleAdd node;
+  std::unordered_map<const luci::CircleNode *, MinMaxVectors> min_max_map;
+  min_max_map.insert({&node, MinMaxVectors()});
+
+  EXPECT_ANY_THROW(computer->update_qparam(&min_max_map));
 }
 
 TEST(MinMaxComputerTest, percentile_nullptr_NEG)
@@ -73,3 +88,40 @@ TEST(MinMaxComputerTest, moving_avg_nullptr_NEG)
 
   EXPECT_ANY_THROW(computer->update_qparam(nullptr));
 }
+
+TEST(MinMaxComputerTest, entropy)
+{
+  auto computer = make_entropy_computer(128);
+
+  luci::CircleAdd node;
+  MinMaxVectors minmax;
+  {
+    // Most values are in [-1, 1] and a few outliers reach 100
+    std::vector<float> values;
+    for (int i = 0; i < 10000; ++i)
+      values.push_back(static_cast<float>(i % 201 - 100) / 100.0f);
+    values.push_back(-100.0f);
+    values.push_back(100.0f);
+    minmax.histogram.add(values.data(), values.size(), 100.0f);
+    minmax.min_sketch.add(-100.0f);
+    minmax.max_sketch.add(100.0f);
+  }
+  std::unordered_map<const luci::CircleNode *, MinMaxVectors> min_max_map;
+  min_max_map.insert({&node, minmax});
+
+  computer->update_qparam(&min_max_map);
+
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  // Outliers are clipped
+  EXPECT_GE(-1.0, node.quantparam()->min[0]);
+  EXPECT_LT(-100.0, node.quantparam()->min[0]);
+  EXPECT_LE(1.0, node.quantparam()->max[0]);
+  EXPECT_GT(100.0, node.quantparam()->max[0]);
+}
+
+TEST(MinMaxComputerTest, entropy_nullptr_NEG)
+{
+  auto computer = make_entropy_computer(128);
+
+  EXPECT_ANY_THROW(computer->update_qparam(nullptr));
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QuantileSketch.h"
+#include "RecordFunction.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace record_minmax
+{
+
+TEST(QuantileSketchTest, Exact)
+{
+  std::vector<float> input{5, 3, 9, 0, 1, 8, 2, 7, 4, 6};
+
+  QuantileSketch sketch;
+  for (auto value : input)
+    sketch.add(value);
+
+  EXPECT_EQ(10, sketch.count());
+  for (float percentile : {0.0f, 12.5f, 33.3f, 50.0f, 99.0f, 100.0f})
+  {
+    auto copied = input;
+    EXPECT_NEAR(getNthPercentile(copied, percentile), sketch.percentile(percentile), 1e-5);
+  }
+}
+
+TEST(QuantileSketchTest, Bounded)
+{
+  QuantileSketch sketch(256);
+  const uint32_t num_values = 1000000;
+  for (uint32_t i = 0; i < num_values; ++i)
+    sketch.add(static_cast<float>((i * 7919) % num_values));
+
+  EXPECT_EQ(num_values, sketch.count());
+  EXPECT_FLOAT_EQ(0.0f, sketch.percentile(0));
+  EXPECT_FLOAT_EQ(num_values - 1, sketch.percentile(100));
+  // Rank error is about 1 / capacity
+  for (float percentile : {1.0f, 25.0f, 50.0f, 75.0f, 99.0f})
+    EXPECT_NEAR(percentile / 100.0f * num_values, sketch.percentile(percentile),
+                0.02f * num_values);
+}
+
+TEST(QuantileSketchTest, Merge)
+{
+  QuantileSketch whole(128);
+  std::vector<QuantileSketch> parts(4, QuantileSketch(128));
+  for (uint32_t i = 0; i < 100000; ++i)
+  {
+    const float value = std::sin(static_cast<float>(i));
+    whole.add(value);
+    parts[i % 4].add(value);
+  }
+
+  QuantileSketch merged(128);
+  for (const auto &part : parts)
+    merged.merge(part);
+
+  EXPECT_EQ(whole.count(), merged.count());
+  EXPECT_FLOAT_EQ(whole.percentile(0), merged.percentile(0));
+  EXPECT_FLOAT_EQ(whole.percentile(100), merged.percentile(100));
+  for (float percentile : {1.0f, 50.0f, 99.0f})
+    EXPECT_NEAR(whole.percentile(percentile), merged.percentile(percentile), 0.1f);
+}
+
+TEST(QuantileSketchTest, Empty_NEG)
+{
+  QuantileSketch sketch;
+
+  EXPECT_ANY_THROW(sketch.percentile(50));
+}
+
+TEST(QuantileSketchTest, OutOfRange_NEG)
+{
+  QuantileSketch sketch;
+  sketch.add(1.0f);
+
+  EXPECT_ANY_THROW(sketch.percentile(-1));
+  EXPECT_ANY_THROW(sketch.percentile(101));
+}
+
+TEST(QuantileSketchTest, Capacity_NEG) { EXPECT_ANY_THROW(QuantileSketch sketch(1)); }
+
+} // namespace record_minmax
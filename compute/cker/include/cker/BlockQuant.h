@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BLOCK_QUANT_H__
+#define __NNFW_CKER_BLOCK_QUANT_H__
+
+#include <cstdint>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Blocks of 32 values sharing a fp16 scale, same layouts as Q4_0 and Q8_0 of ggml
+ *
+ * Q4_0 keeps value j in the low nibble of quants[j] and value j + 16 in the high nibble, which
+ * is dequantized as (nibble - 8) * scale. Q8_0 is dequantized as quants[j] * scale.
+ */
+constexpr int kBlockQuantSize = 32;
+
+struct BlockQ4_0
+{
+  uint16_t scale;
+  uint8_t quants[kBlockQuantSize / 2];
+};
+
+struct BlockQ8_0
+{
+  uint16_t scale;
+  int8_t quants[kBlockQuantSize];
+};
+
+static_assert(sizeof(BlockQ4_0) == 18, "BlockQ4_0 should be packed as ggml block_q4_0");
+static_assert(sizeof(BlockQ8_0) == 34, "BlockQ8_0 should be packed as ggml block_q8_0");
+
+// IEEE half precision bits to float
+inline float Fp16ToFloat(uint16_t h)
+{
+  const uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+  const uint32_t exponent = (h >> 10) & 0x1f;
+  const uint32_t mantissa = h & 0x3ff;
+  uint32_t bits;
+  if (exponent == 0x1f)
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  else if (exponent != 0)
+    bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+  else
+  {
+    // Zero or subnormal, mantissa * 2^-24
+    const float value = mantissa * (1.f / 16777216.f);
+    return sign ? -value : value;
+  }
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+inline void DequantizeBlock(const BlockQ4_0 &block, float *output)
+{
+  const float scale = Fp16ToFloat(block.scale);
+  for (int j = 0; j < kBlockQuantSize / 2; ++j)
+  {
+    output[j] = ((block.quants[j] & 0xf) - 8) * scale;
+    output[j + kBlockQuantSize / 2] = ((block.quants[j] >> 4) - 8) * scale;
+  }
+}
+
+inline void DequantizeBlock(const BlockQ8_0 &block, float *output)
+{
+  const float scale = Fp16ToFloat(block.scale);
+  for (int j = 0; j < kBlockQuantSize; ++j)
+    output[j] = block.quants[j] * scale;
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BLOCK_QUANT_H__
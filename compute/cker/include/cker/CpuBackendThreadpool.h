@@ -21,7 +21,11 @@
 #include <ruy/context.h>     // from @ruy
 #include <ruy/thread_pool.h> // from @ruy
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <stdexcept>
+#include <vector>
 
 namespace nnfw
 {
@@ -44,6 +48,51 @@ void Execute(int tasks_count, TaskType *tasks, ruy::Context *ruy_context)
   ruy_context->mutable_thread_pool()->Execute(tasks_count, tasks);
 }
 
+template <typename Fn> struct RangeTask : Task
+{
+  RangeTask(const Fn &fn, int start, int end) : fn_(fn), start_(start), end_(end) {}
+
+  void Run() override { fn_(start_, end_); }
+
+private:
+  const Fn &fn_;
+  int start_;
+  int end_;
+};
+
+/**
+ * @brief Run fn(start, end) on contiguous ranges of [0, units) over the thread pool of ruy_context
+ *
+ * A unit costs unit_cost and a range costs at least min_task_cost, as a smaller task is not worth
+ * waking up a thread. There is a range per thread at most, and fn(0, units) runs on the caller
+ * thread if ruy_context is null or the work is too small for two ranges.
+ */
+template <typename Fn>
+void ExecuteRanges(int units, int64_t unit_cost, int64_t min_task_cost, const Fn &fn,
+                   ruy::Context *ruy_context)
+{
+  int thread_count = ruy_context ? std::min(ruy_context->max_num_threads(), units) : 1;
+  if (min_task_cost > 0)
+    thread_count = static_cast<int>(std::min<int64_t>(
+      thread_count, static_cast<int64_t>(units) * unit_cost / min_task_cost));
+  if (thread_count <= 1)
+  {
+    fn(0, units);
+    return;
+  }
+
+  std::vector<RangeTask<Fn>> tasks;
+  tasks.reserve(thread_count);
+  int start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int end = start + (units - start) / (thread_count - i);
+    tasks.emplace_back(fn, start, end);
+    start = end;
+  }
+  Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
 } // namespace cpu_backend_threadpool
 } // namespace cker
 } // namespace nnfw
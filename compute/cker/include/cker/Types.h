@@ -269,6 +269,22 @@ struct FullyConnectedParams
   // FullyConnectedWeightsFormat weights_format;
 };
 
+struct BatchMatMulParams
+{
+  bool adj_x;
+  bool adj_y;
+  // quantized inference params.
+  int32_t lhs_zero_point;
+  int32_t rhs_zero_point;
+  int32_t output_zero_point;
+  int32_t output_multiplier;
+  int output_shift;
+  int32_t quantized_activation_min;
+  int32_t quantized_activation_max;
+  // Mark rhs as cacheable if it is unchanging, e.g. weights.
+  bool rhs_cacheable;
+};
+
 struct L2NormParams
 {
   // uint8 inference params.
@@ -321,6 +337,14 @@ struct RmsNormParams
   float epsilon;
 };
 
+struct AttentionParams
+{
+  // Scale of query-key products, e.g. 1 / sqrt(depth)
+  float scale;
+  // Mask keys after the position of each query, queries are aligned to the last keys
+  bool causal;
+};
+
 struct TransposeConvParams
 {
   PaddingType padding_type;
@@ -99,6 +99,25 @@ inline int32_t MultiplyByQuantizedMultiplier(int32_t x, int32_t quantized_multip
     right_shift);
 }
 
+// From tensorflow/lite/kernels/internal/common.h, for accumulators wider than 32 bits
+inline int32_t MultiplyByQuantizedMultiplierInt64(int64_t x, int32_t quantized_multiplier,
+                                                  int shift)
+{
+  // Inputs:
+  // - quantized_multiplier has fixed point at bit 31
+  // - shift is -31 to +7 (negative for right shift)
+  assert(quantized_multiplier >= 0);
+  assert(shift >= -31 && shift < 8);
+  assert(x >= -(static_cast<int64_t>(1) << 47) && x < (static_cast<int64_t>(1) << 47));
+
+  const int32_t reduced_multiplier =
+    (quantized_multiplier < 0x7FFF0000) ? ((quantized_multiplier + (1 << 15)) >> 16) : 0x7FFF;
+  const int total_shift = 15 - shift;
+  x = (x * static_cast<int64_t>(reduced_multiplier)) +
+      (static_cast<int64_t>(1) << (total_shift - 1));
+  return static_cast<int32_t>(x >> total_shift);
+}
+
 inline int32_t MultiplyByQuantizedMultiplierGreaterThanOne(int32_t x, int32_t quantized_multiplier,
                                                            int left_shift)
 {
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_ATTENTION_H__
+#define __NNFW_CKER_ATTENTION_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/eigen/Utils.h"
+
+#include <Eigen/Core>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Queries and keys in a tile, scores of a tile fit in L1 for usual depths
+constexpr int kAttentionQueryTile = 32;
+constexpr int kAttentionKeyTile = 128;
+
+struct AttentionGeometry
+{
+  int batches;
+  int heads;
+  int kv_heads;
+  int q_len;
+  int kv_len;
+  int depth;
+  int value_depth;
+  // Dims of mask extended to rank 4, whose batches and heads are 1 to be broadcast
+  int mask_batches;
+  int mask_heads;
+};
+
+/**
+ * @brief Attention of queries [q_start, q_end) of a head
+ *
+ * Key tiles are folded into an online softmax. Running max and sum of exponentials are kept per
+ * query, and the accumulated output is rescaled whenever the max grows.
+ * scores should hold kAttentionKeyTile x kAttentionQueryTile floats and acc
+ * value_depth x kAttentionQueryTile floats.
+ */
+inline void AttentionQueryTile(const AttentionParams &params, const AttentionGeometry &geo,
+                               const float *query, const float *key, const float *value,
+                               const float *mask, int q_start, int q_end, float *output,
+                               float *scores, float *acc)
+{
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+  const int rows = q_end - q_start;
+  // Position of the first query among keys
+  const int offset = geo.kv_len - geo.q_len;
+
+  MatrixMap<const float> q(query + q_start * geo.depth, geo.depth, rows);
+  MatrixMap<float> acc_mat(acc, geo.value_depth, rows);
+  acc_mat.setZero();
+  float max[kAttentionQueryTile];
+  float sum[kAttentionQueryTile];
+  std::fill(max, max + rows, -kInf);
+  std::fill(sum, sum + rows, 0.f);
+
+  // Keys after the last query are never seen with causal mask
+  const int k_limit =
+    params.causal ? std::max(0, std::min(geo.kv_len, offset + q_end)) : geo.kv_len;
+  for (int k_start = 0; k_start < k_limit; k_start += kAttentionKeyTile)
+  {
+    const int cols = std::min(kAttentionKeyTile, k_limit - k_start);
+    MatrixMap<const float> k(key + k_start * geo.depth, geo.depth, cols);
+    MatrixMap<float> s(scores, cols, rows);
+    s.noalias() = params.scale * (k.transpose() * q);
+
+    for (int r = 0; r < rows; ++r)
+    {
+      float *col = scores + r * cols;
+      // Keys [0, valid) of the tile are visible to the query
+      int valid = cols;
+      if (params.causal)
+        valid = std::max(0, std::min(cols, offset + q_start + r + 1 - k_start));
+      if (mask)
+      {
+        const float *mask_row = mask + (q_start + r) * geo.kv_len + k_start;
+        for (int c = 0; c < valid; ++c)
+          col[c] += mask_row[c];
+      }
+
+      const float tile_max = valid > 0 ? *std::max_element(col, col + valid) : -kInf;
+      if (tile_max == -kInf)
+      {
+        // Nothing to attend in this tile
+        std::fill(col, col + cols, 0.f);
+        continue;
+      }
+
+      const float new_max = std::max(max[r], tile_max);
+      const float correction = std::exp(max[r] - new_max);
+      Eigen::Map<Eigen::ArrayXf> p(col, valid);
+      p = (p - new_max).exp();
+      std::fill(col + valid, col + cols, 0.f);
+      sum[r] = sum[r] * correction + p.sum();
+      acc_mat.col(r) *= correction;
+      max[r] = new_max;
+    }
+
+    MatrixMap<const float> v(value + k_start * geo.value_depth, geo.value_depth, cols);
+    acc_mat.noalias() += v * s;
+  }
+
+  MatrixMap<float> out(output + q_start * geo.value_depth, geo.value_depth, rows);
+  for (int r = 0; r < rows; ++r)
+  {
+    // A query which sees no key has zero output
+    if (sum[r] > 0.f)
+      out.col(r) = acc_mat.col(r) / sum[r];
+    else
+      out.col(r).setZero();
+  }
+}
+
+} // namespace optimized
+
+/**
+ * @brief Attention, softmax(scale * query x key^T + mask) x value
+ *
+ * query is [batches, heads, q_len, depth], key is [batches, kv_heads, kv_len, depth] and value
+ * is [batches, kv_heads, kv_len, value_depth]. heads should be a multiple of kv_heads, and each
+ * key/value head is shared by heads / kv_heads query heads. mask is optional and added to scores.
+ * Its last dims are [q_len, kv_len] and the other dims are 1 or the same as batches and heads.
+ *
+ * Keys are visited in tiles with an online softmax, so scores of a head are not materialized.
+ * A task keeps only a tile of scores, which makes memory O(q_len) instead of O(q_len * kv_len).
+ * Tiles of queries are split over the thread pool of ruy_context if it is given.
+ */
+inline void Attention(const AttentionParams &params, const Shape &query_shape,
+                      const float *query_data, const Shape &key_shape, const float *key_data,
+                      const Shape &value_shape, const float *value_data, const Shape &mask_shape,
+                      const float *mask_data, const Shape &output_shape, float *output_data,
+                      ruy::Context *ruy_context = nullptr)
+{
+  if (query_shape.DimensionsCount() != 4 || key_shape.DimensionsCount() != 4 ||
+      value_shape.DimensionsCount() != 4)
+    throw std::runtime_error("cker::Attention: query, key and value should be rank 4");
+
+  optimized::AttentionGeometry geo;
+  geo.batches = query_shape.Dims(0);
+  geo.heads = query_shape.Dims(1);
+  geo.kv_heads = key_shape.Dims(1);
+  geo.q_len = query_shape.Dims(2);
+  geo.kv_len = key_shape.Dims(2);
+  geo.depth = query_shape.Dims(3);
+  geo.value_depth = value_shape.Dims(3);
+  if (key_shape.Dims(0) != geo.batches || value_shape.Dims(0) != geo.batches ||
+      value_shape.Dims(1) != geo.kv_heads || value_shape.Dims(2) != geo.kv_len ||
+      key_shape.Dims(3) != geo.depth)
+    throw std::runtime_error("cker::Attention: key and value do not match query");
+  if (geo.kv_heads == 0 || geo.heads % geo.kv_heads != 0)
+    throw std::runtime_error("cker::Attention: heads should be a multiple of kv_heads");
+  if (output_shape.FlatSize() != geo.batches * geo.heads * geo.q_len * geo.value_depth)
+    throw std::runtime_error("cker::Attention: invalid output shape");
+
+  geo.mask_batches = 1;
+  geo.mask_heads = 1;
+  if (mask_data)
+  {
+    const Shape extended = Shape::ExtendedShape(4, mask_shape);
+    geo.mask_batches = extended.Dims(0);
+    geo.mask_heads = extended.Dims(1);
+    if ((geo.mask_batches != 1 && geo.mask_batches != geo.batches) ||
+        (geo.mask_heads != 1 && geo.mask_heads != geo.heads) || extended.Dims(2) != geo.q_len ||
+        extended.Dims(3) != geo.kv_len)
+      throw std::runtime_error("cker::Attention: mask is not broadcastable to scores");
+  }
+
+  // A unit is a tile of queries of a head
+  const int q_tiles = (geo.q_len + optimized::kAttentionQueryTile - 1) /
+                      optimized::kAttentionQueryTile;
+  const int units = geo.batches * geo.heads * q_tiles;
+  const int group = geo.heads / std::max(geo.kv_heads, 1);
+  auto fn = [&](int start, int end) {
+    std::vector<float> scores(optimized::kAttentionKeyTile * optimized::kAttentionQueryTile);
+    std::vector<float> acc(geo.value_depth * optimized::kAttentionQueryTile);
+    for (int unit = start; unit < end; ++unit)
+    {
+      const int head_index = unit / q_tiles;
+      const int tile = unit % q_tiles;
+      const int b = head_index / geo.heads;
+      const int h = head_index % geo.heads;
+      const int kv_index = b * geo.kv_heads + h / group;
+      const float *mask = nullptr;
+      if (mask_data)
+      {
+        const int mb = geo.mask_batches == 1 ? 0 : b;
+        const int mh = geo.mask_heads == 1 ? 0 : h;
+        mask = mask_data + (mb * geo.mask_heads + mh) * geo.q_len * geo.kv_len;
+      }
+      const int q_start = tile * optimized::kAttentionQueryTile;
+      const int q_end = std::min(geo.q_len, q_start + optimized::kAttentionQueryTile);
+      optimized::AttentionQueryTile(
+        params, geo, query_data + head_index * geo.q_len * geo.depth,
+        key_data + kv_index * geo.kv_len * geo.depth,
+        value_data + kv_index * geo.kv_len * geo.value_depth, mask, q_start, q_end,
+        output_data + head_index * geo.q_len * geo.value_depth, scores.data(), acc.data());
+    }
+  };
+
+  // Small attentions are not worth waking up threads
+  constexpr int64_t kMinMacsPerTask = 65536;
+  const int64_t macs_per_unit = static_cast<int64_t>(optimized::kAttentionQueryTile) *
+                                geo.kv_len * (geo.depth + geo.value_depth);
+  cpu_backend_threadpool::ExecuteRanges(units, macs_per_unit, kMinMacsPerTask, fn, ruy_context);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_ATTENTION_H__
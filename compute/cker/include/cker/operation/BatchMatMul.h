@@ -18,13 +18,14 @@
 #ifndef __NNFW_CKER_BATCH_MATMUL_H__
 #define __NNFW_CKER_BATCH_MATMUL_H__
 
-#include "Transpose.h"
-
 #include "cker/Types.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
-#include "cker/operation/reference/BatchMatMul.h"
+#include "cker/operation/optimized/BatchMatMul.h"
+
+#include <ruy/context.h>
 
+#include <memory>
 #include <vector>
 
 namespace nnfw
@@ -41,103 +42,62 @@ public:
   }
 
   /**
-   * @brief   Prepare temporary area for calculation
+   * @brief   Prepare for calculation
+   * @note    adj_x and adj_y are handled by strides, so no temporary area is needed.
+   *          If rhs is constant, ruy caches its packed form at the first run.
    */
-  void prepare(const Shape &lhs_shape, const Shape &rhs_shape, bool adj_x, bool adj_y)
+  void prepare(const Shape &, const Shape &, bool, bool, bool rhs_const = false)
   {
-    if (adj_x)
-    {
-      int32_t rank = lhs_shape.DimensionsCount();
-      _temp_lhs_shape.Resize(rank);
-
-      for (int32_t i = 0; i < rank - 2; i++)
-      {
-        _temp_lhs_shape.SetDim(i, lhs_shape.Dims(i));
-      }
-      _temp_lhs_shape.SetDim(rank - 2, lhs_shape.Dims(rank - 1));
-      _temp_lhs_shape.SetDim(rank - 1, lhs_shape.Dims(rank - 2));
-
-      _temp_lhs.resize(_temp_lhs_shape.FlatSize());
-    }
-
-    if (!adj_y)
-    {
-      int32_t rank = rhs_shape.DimensionsCount();
-      _temp_rhs_shape.Resize(rank);
-
-      for (int32_t i = 0; i < rank - 2; i++)
-      {
-        _temp_rhs_shape.SetDim(i, rhs_shape.Dims(i));
-      }
-      _temp_rhs_shape.SetDim(rank - 2, rhs_shape.Dims(rank - 1));
-      _temp_rhs_shape.SetDim(rank - 1, rhs_shape.Dims(rank - 2));
-
-      _temp_rhs.resize(_temp_rhs_shape.FlatSize());
-    }
+    _rhs_cacheable = rhs_const;
   }
 
+  /**
+   * @brief   Calculate float BatchMatMul
+   * @param[in] ruy_context  Context whose thread pool runs batch slices in parallel.
+   *                         If nullptr, it runs on the calling thread only.
+   */
   void operator()(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_shape,
                   const float *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
-                  float *output_data)
+                  float *output_data, ruy::Context *ruy_context = nullptr)
   {
-    // Assume lhs and rhs is not constant
-    // TODO Handle constant input
-
-    if (!adj_y)
-    {
-      transposeRowsCols(rhs_shape, rhs_data, _temp_rhs_shape, _temp_rhs.data());
-    }
-
-    if (adj_x)
-    {
-      transposeRowsCols(lhs_shape, lhs_data, _temp_lhs_shape, _temp_lhs.data());
-    }
-
-    Shape new_lhs_shape = adj_x ? lhs_shape : swapRowColDims(lhs_shape);
-    Shape new_rhs_shape = adj_y ? rhs_shape : swapRowColDims(rhs_shape);
-    const float *new_lhs_data = adj_x ? _temp_lhs.data() : lhs_data;
-    const float *new_rhs_data = adj_y ? rhs_data : _temp_rhs.data();
-
-    // Note we pass RHS args first, LHS args second
-    // Check accumulative dimensions of lhs and rhs of are equal
-    assert(Shape::ExtendedShape(5, new_rhs_shape).Dims(4) ==
-           Shape::ExtendedShape(5, new_lhs_shape).Dims(3));
-    reference::BatchMatMul(new_rhs_shape, new_rhs_data, new_lhs_shape, new_lhs_data, output_shape,
-                           output_data);
-  }
-
-private:
-  Shape swapRowColDims(const Shape &shape)
-  {
-    Shape swapped_shape(shape);
-    const uint32_t dims = shape.DimensionsCount();
-    swapped_shape.SetDim(dims - 2, shape.Dims(dims - 1));
-    swapped_shape.SetDim(dims - 1, shape.Dims(dims - 2));
-
-    return swapped_shape;
+    const optimized::BatchMatMulGeometry geo(lhs_shape, rhs_shape, adj_x, adj_y);
+    assert(output_shape.FlatSize() == geo.batches * geo.rows * geo.cols);
+    UNUSED_RELEASE(output_shape);
+
+    const bool rhs_cacheable = _rhs_cacheable;
+    auto slice_fn = [&](int batch, ruy::Context *context) {
+      optimized::BatchMatMulSlice(geo, rhs_cacheable, lhs_data, rhs_data, output_data, batch,
+                                  context);
+    };
+    optimized::RunBatchMatMulSlices(geo.batches, slice_fn, ruy_context, _task_contexts);
   }
 
-  void transposeRowsCols(const Shape &input_shape, const float *input_data,
-                         const Shape &output_shape, float *output_data)
+  /**
+   * @brief   Calculate quantized BatchMatMul
+   * @note    uint8/int8 are asymmetric and run on ruy, int16 is symmetric
+   */
+  template <typename T>
+  void operator()(const BatchMatMulParams &params, const Shape &lhs_shape, const T *lhs_data,
+                  const Shape &rhs_shape, const T *rhs_data, const Shape &output_shape,
+                  T *output_data, ruy::Context *ruy_context = nullptr)
   {
-    TransposeParams params;
-    int rank = input_shape.DimensionsCount();
-    params.perm_count = rank;
-    for (int i = 0; i < 2; i++)
-    {
-      params.perm[i] = i;
-    }
-    params.perm[rank - 2] = rank - 1;
-    params.perm[rank - 1] = rank - 2;
-
-    Transpose<float>(params, input_shape, input_data, output_shape, output_data);
+    static_assert(std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value ||
+                    std::is_same<T, int16_t>::value,
+                  "BatchMatMul: unsupported quantized type");
+    const optimized::BatchMatMulGeometry geo(lhs_shape, rhs_shape, params.adj_x, params.adj_y);
+    assert(output_shape.FlatSize() == geo.batches * geo.rows * geo.cols);
+    UNUSED_RELEASE(output_shape);
+
+    auto slice_fn = [&](int batch, ruy::Context *context) {
+      optimized::BatchMatMulSlice(geo, params, lhs_data, rhs_data, output_data, batch, context);
+    };
+    optimized::RunBatchMatMulSlices(geo.batches, slice_fn, ruy_context, _task_contexts);
   }
 
 private:
-  std::vector<float> _temp_lhs;
-  Shape _temp_lhs_shape;
-  std::vector<float> _temp_rhs;
-  Shape _temp_rhs_shape;
+  bool _rhs_cacheable = false;
+  // Single threaded contexts for tasks running batch slices in parallel
+  std::vector<std::unique_ptr<ruy::Context>> _task_contexts;
 };
 
 } // namespace cker
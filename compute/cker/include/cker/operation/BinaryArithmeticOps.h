@@ -20,6 +20,7 @@
 
 #include <functional>
 #include <stdexcept>
+#include "cker/operation/ParallelElementwise.h"
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
@@ -362,6 +363,93 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
   }
 }
 
+/**
+ * @brief BinaryArithmeticOp of inputs in the same shape, split over the thread pool of ruy_context
+ *
+ * Ranges of flat tensors are computed as rank 1 tensors.
+ */
+template <BinaryArithmeticOpType op_type, typename T>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const T *input1_data, const Shape &input2_shape,
+                               const T *input2_data, const Shape &output_shape, T *output_data,
+                               ruy::Context *ruy_context)
+{
+  const int size = output_shape.FlatSize();
+  ParallelElementwise(size, 1, ruy_context, [&](int start, int end) {
+    if (start == 0 && end == size)
+    {
+      BinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape, input2_data,
+                                  output_shape, output_data);
+      return;
+    }
+    const Shape shape{end - start};
+    BinaryArithmeticOp<op_type>(params, shape, input1_data + start, shape, input2_data + start,
+                                shape, output_data + start);
+  });
+}
+
+/**
+ * @brief BroadcastBinaryArithmeticOp split over the thread pool of ruy_context
+ *
+ * Output is split along its outermost axis whose dim is not 1, so a range of the axis is
+ * contiguous in output and in inputs which are not broadcast along the axis. Each range is
+ * computed with broadcast params of its own shapes.
+ */
+template <BinaryArithmeticOpType op_type, typename T>
+inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                        const T *input1_data, const Shape &input2_shape,
+                                        const T *input2_data, const Shape &output_shape,
+                                        T *output_data, ruy::Context *ruy_context)
+{
+  const int rank = output_shape.DimensionsCount();
+  const int size = output_shape.FlatSize();
+  if (rank == 0 || size == 0)
+  {
+    BroadcastBinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape,
+                                         input2_data, output_shape, output_data);
+    return;
+  }
+
+  int axis = 0;
+  while (axis < rank - 1 && output_shape.Dims(axis) == 1)
+    ++axis;
+  const Shape shape1 = Shape::ExtendedShape(rank, input1_shape);
+  const Shape shape2 = Shape::ExtendedShape(rank, input2_shape);
+  const int units = output_shape.Dims(axis);
+  const int unit_size = size / units;
+  // Inputs broadcast along the axis stay as they are
+  const int stride1 = shape1.Dims(axis) == 1 ? 0 : shape1.FlatSize() / shape1.Dims(axis);
+  const int stride2 = shape2.Dims(axis) == 1 ? 0 : shape2.FlatSize() / shape2.Dims(axis);
+
+  ParallelElementwise(units, unit_size, ruy_context, [&](int start, int end) {
+    if (start == 0 && end == units)
+    {
+      BroadcastBinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape,
+                                           input2_data, output_shape, output_data);
+      return;
+    }
+    Shape range1(shape1);
+    Shape range2(shape2);
+    Shape range_output(output_shape);
+    if (stride1 != 0)
+      range1.SetDim(axis, end - start);
+    if (stride2 != 0)
+      range2.SetDim(axis, end - start);
+    range_output.SetDim(axis, end - start);
+
+    BinaryArithmeticOpParam range_params = params;
+    const T *range1_data = input1_data + start * stride1;
+    const T *range2_data = input2_data + start * stride2;
+    T *range_output_data = output_data + start * unit_size;
+    if (ProcessBroadcastShapes(range1, range2, &range_params))
+      BroadcastBinaryArithmeticOp<op_type>(range_params, range1, range1_data, range2, range2_data,
+                                           range_output, range_output_data);
+    else
+      BinaryArithmeticOp<op_type>(range_params, range1, range1_data, range2, range2_data,
+                                  range_output, range_output_data);
+  });
+}
+
 } // namespace cker
 } // namespace nnfw
 
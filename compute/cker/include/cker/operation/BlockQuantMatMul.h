@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BLOCK_QUANT_MATMUL_H__
+#define __NNFW_CKER_BLOCK_QUANT_MATMUL_H__
+
+#include "cker/BlockQuant.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/neon/neon_check.h"
+#include "cker/operation/optimized/BatchMatMul.h"
+#include "cker/x86/BlockQuant.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// output_data[r * output_stride] = dot(row, input_data + r * depth)
+inline void DotRows(const float *row, int depth, const float *input_data, int rows,
+                    float *output_data, int output_stride)
+{
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::DotRows(row, depth, input_data, rows, output_data, output_stride);
+    return;
+  }
+#endif // USE_X86_SIMD
+
+  for (int r = 0; r < rows; ++r)
+  {
+    const float *in = input_data + r * depth;
+#ifdef USE_NEON
+    float32x4_t sum0 = vdupq_n_f32(0.f);
+    float32x4_t sum1 = vdupq_n_f32(0.f);
+    for (int c = 0; c < depth; c += 8)
+    {
+      sum0 = vmlaq_f32(sum0, vld1q_f32(row + c), vld1q_f32(in + c));
+      sum1 = vmlaq_f32(sum1, vld1q_f32(row + c + 4), vld1q_f32(in + c + 4));
+    }
+    const float32x4_t sum = vaddq_f32(sum0, sum1);
+    const float32x2_t half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    output_data[r * output_stride] = vget_lane_f32(vpadd_f32(half, half), 0);
+#else
+    float sum[4] = {0.f, 0.f, 0.f, 0.f};
+    for (int c = 0; c < depth; c += 4)
+      for (int i = 0; i < 4; ++i)
+        sum[i] += row[c + i] * in[c + i];
+    output_data[r * output_stride] = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+#endif // USE_NEON
+  }
+}
+
+template <typename Block>
+inline void DequantizeBlocks(const Block *blocks, int count, float *output_data)
+{
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::DequantizeBlocks(blocks, count, output_data);
+    return;
+  }
+#endif // USE_X86_SIMD
+
+  for (int b = 0; b < count; ++b)
+    DequantizeBlock(blocks[b], output_data + b * kBlockQuantSize);
+}
+
+/**
+ * @brief Columns [col_start, col_end) of input * weights^T, clamped after adding bias
+ *
+ * input is [rows x depth] and weights is [cols x depth] in blocks. A weights row is dequantized
+ * into row_buffer of depth floats, and multiplied with input rows while it stays in L1. Input
+ * rows are visited in chunks which stay in L2, so weights are dequantized once per chunk.
+ */
+template <typename Block>
+void BlockQuantMatMulCols(const float *input_data, int rows, int depth, const Block *weights_data,
+                          const float *bias_data, float clamp_min, float clamp_max, int col_start,
+                          int col_end, float *output_data, int output_stride, float *row_buffer)
+{
+  constexpr int kInputChunkSize = 32768;
+  const int chunk_rows = std::max(1, kInputChunkSize / depth);
+  const int blocks_per_row = depth / kBlockQuantSize;
+  for (int r = 0; r < rows; r += chunk_rows)
+  {
+    const int chunk = std::min(chunk_rows, rows - r);
+    const float *input_chunk = input_data + r * depth;
+    float *output_chunk = output_data + r * output_stride;
+#ifdef USE_X86_SIMD
+    // A single input row is multiplied with blocks dequantized in registers
+    if (chunk == 1 && GetX86SimdLevel() != X86SimdLevel::kNone)
+    {
+      for (int c = col_start; c < col_end; ++c)
+        output_chunk[c] = x86::DotBlocks(weights_data + c * blocks_per_row, blocks_per_row,
+                                         input_chunk);
+      continue;
+    }
+#endif // USE_X86_SIMD
+    for (int c = col_start; c < col_end; ++c)
+    {
+      DequantizeBlocks(weights_data + c * blocks_per_row, blocks_per_row, row_buffer);
+      DotRows(row_buffer, depth, input_chunk, chunk, output_chunk + c, output_stride);
+    }
+  }
+
+  for (int r = 0; r < rows; ++r)
+  {
+    float *out = output_data + r * output_stride;
+    for (int c = col_start; c < col_end; ++c)
+    {
+      const float value = bias_data ? out[c] + bias_data[c] : out[c];
+      out[c] = std::min(std::max(value, clamp_min), clamp_max);
+    }
+  }
+}
+
+// Small products are not worth waking up threads
+constexpr int64_t kMinBlockQuantMacsPerTask = 65536;
+
+} // namespace optimized
+
+/**
+ * @brief FullyConnected of float input and block quantized weights
+ *
+ * Block is BlockQ4_0 or BlockQ8_0. weights is [output_depth x depth] and depth should be
+ * a multiple of kBlockQuantSize. Weights are dequantized on the fly, a row at a time, so they
+ * stay quantized in memory. Output units are split over threads.
+ */
+template <typename Block>
+void FullyConnectedBlockQuant(const FullyConnectedParams &params, const Shape &input_shape,
+                              const float *input_data, const Shape &weights_shape,
+                              const Block *weights_data, const Shape &, const float *bias_data,
+                              const Shape &output_shape, float *output_data,
+                              ruy::Context *ruy_context = nullptr)
+{
+  const int dims_count = weights_shape.DimensionsCount();
+  const int depth = weights_shape.Dims(dims_count - 1);
+  const int output_depth = weights_shape.Dims(dims_count - 2);
+  const int batches = input_shape.FlatSize() / depth;
+  assert(output_shape.FlatSize() == batches * output_depth);
+  UNUSED_RELEASE(output_shape);
+  if (depth % kBlockQuantSize != 0)
+    throw std::runtime_error("cker::FullyConnectedBlockQuant: depth should be a multiple of 32");
+
+  auto fn = [&](int start, int end) {
+    std::vector<float> row_buffer(depth);
+    optimized::BlockQuantMatMulCols(input_data, batches, depth, weights_data, bias_data,
+                                    params.float_activation_min, params.float_activation_max,
+                                    start, end, output_data, output_depth, row_buffer.data());
+  };
+  cpu_backend_threadpool::ExecuteRanges(output_depth, static_cast<int64_t>(batches) * depth,
+                                        optimized::kMinBlockQuantMacsPerTask, fn, ruy_context);
+}
+
+/**
+ * @brief BatchMatMul of float lhs and block quantized rhs
+ *
+ * rhs is [..., cols x depth] in blocks, so only adj_y is supported, which reads rows of rhs as
+ * FullyConnected reads rows of weights. Batch dimensions are broadcast as in BatchMatMul.
+ */
+template <typename Block>
+void BatchMatMulBlockQuant(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_shape,
+                           const Block *rhs_data, bool adj_x, bool adj_y,
+                           const Shape &output_shape, float *output_data,
+                           ruy::Context *ruy_context = nullptr)
+{
+  if (adj_x || !adj_y)
+    throw std::runtime_error("cker::BatchMatMulBlockQuant: only adj_y of rhs is supported");
+
+  const optimized::BatchMatMulGeometry geo(lhs_shape, rhs_shape, adj_x, adj_y);
+  assert(output_shape.FlatSize() == geo.batches * geo.rows * geo.cols);
+  UNUSED_RELEASE(output_shape);
+  if (geo.depth % kBlockQuantSize != 0)
+    throw std::runtime_error("cker::BatchMatMulBlockQuant: depth should be a multiple of 32");
+
+  // A unit is a column of an output slice
+  const int cols = geo.cols;
+  auto fn = [&](int start, int end) {
+    std::vector<float> row_buffer(geo.depth);
+    for (int unit = start; unit < end;)
+    {
+      const int batch = unit / cols;
+      const int col_start = unit % cols;
+      const int col_end = std::min(cols, col_start + (end - unit));
+      optimized::BlockQuantMatMulCols(
+        lhs_data + geo.lhsOffset(batch), geo.rows, geo.depth,
+        rhs_data + geo.rhsOffset(batch) / kBlockQuantSize, nullptr,
+        std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max(), col_start, col_end,
+        output_data + geo.outputOffset(batch), cols, row_buffer.data());
+      unit += col_end - col_start;
+    }
+  };
+  cpu_backend_threadpool::ExecuteRanges(geo.batches * cols,
+                                        static_cast<int64_t>(geo.rows) * geo.depth,
+                                        optimized::kMinBlockQuantMacsPerTask, fn, ruy_context);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BLOCK_QUANT_MATMUL_H__
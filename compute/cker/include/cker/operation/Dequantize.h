@@ -20,6 +20,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/neon/neon_check.h"
+#include "cker/x86/Quantize.h"
 
 namespace nnfw
 {
@@ -47,6 +48,14 @@ inline void Dequantize(const Shape &input_shape, const uint8_t *input_data,
 {
   const int flat_size = MatchingFlatSize(input_shape, output_shape);
 
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::Dequantize(flat_size, input_data, scale, zero_point, output_data);
+    return;
+  }
+#endif // USE_X86_SIMD
+
   int i = 0;
 #ifdef USE_NEON
   const float32x4_t scale_dup = vdupq_n_f32(static_cast<float>(scale));
@@ -83,6 +92,14 @@ inline void Dequantize(const Shape &input_shape, const int8_t *input_data,
 {
   const int flat_size = MatchingFlatSize(input_shape, output_shape);
 
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::Dequantize(flat_size, input_data, scale, zero_point, output_data);
+    return;
+  }
+#endif // USE_X86_SIMD
+
   int i = 0;
 #ifdef USE_NEON
   const float32x4_t scale_dup = vdupq_n_f32(static_cast<float>(scale));
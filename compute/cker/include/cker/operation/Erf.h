@@ -18,6 +18,7 @@
 #define __NNFW_CKER_ERF_H__
 
 #include "cker/Shape.h"
+#include "cker/x86/Activation.h"
 
 #include <cmath>
 
@@ -30,6 +31,14 @@ inline void Erf(const Shape &input_shape, const float *input_data, const Shape &
                 float *output_data)
 {
   const int size = MatchingFlatSize(input_shape, output_shape);
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::Erf(size, input_data, output_data);
+    return;
+  }
+#endif // USE_X86_SIMD
+
   for (int i = 0; i < size; i++)
   {
     output_data[i] = std::erf(input_data[i]);
@@ -18,19 +18,90 @@
 #ifndef __NNFW_CKER_GATHER_H__
 #define __NNFW_CKER_GATHER_H__
 
+#include "cker/BlockQuant.h"
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/BlockQuantMatMul.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
 
 namespace nnfw
 {
 namespace cker
 {
+namespace optimized
+{
+
+// Rows of indices this far ahead are prefetched, which hides misses on large tables
+constexpr int kGatherPrefetchDistance = 8;
+
+template <typename T> inline void PrefetchRow(const T *row, int size)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  // Only the head lines of a row, later lines are followed by the hardware prefetcher
+  constexpr int kLineSize = 64;
+  const int bytes = std::min<int>(size * sizeof(T), 4 * kLineSize);
+  const char *data = reinterpret_cast<const char *>(row);
+  for (int offset = 0; offset < bytes; offset += kLineSize)
+    __builtin_prefetch(data + offset, 0, 0);
+#else
+  (void)row;
+  (void)size;
+#endif
+}
 
+/**
+ * @brief Gather rows [start, end) of output, which are outer x coords_count rows
+ *
+ * copy_row(src, dst) copies a row of the input to a row of the output.
+ */
+template <typename T, typename CoordsT, typename CopyRow>
+inline void GatherRows(const T *input_data, int axis_size, int input_row_size,
+                       const CoordsT *coords_data, int coords_count, int start, int end,
+                       const CopyRow &copy_row)
+{
+  for (int unit = start; unit < end; ++unit)
+  {
+    // Offsets are in int64_t, as tables may have more than 2^31 elements
+    const int64_t outer = unit / coords_count;
+    const int i = unit % coords_count;
+    const int ahead = unit + kGatherPrefetchDistance;
+    if (ahead < end)
+    {
+      const int64_t ahead_outer = ahead / coords_count;
+      const int64_t ahead_coord = static_cast<int64_t>(coords_data[ahead % coords_count]);
+      PrefetchRow(input_data + (ahead_outer * axis_size + ahead_coord) * input_row_size,
+                  input_row_size);
+    }
+    const int64_t coord = static_cast<int64_t>(coords_data[i]);
+    assert(coord >= 0);
+    assert(coord < axis_size);
+    copy_row(input_data + (outer * axis_size + coord) * input_row_size, unit);
+  }
+}
+
+// Small gathers are not worth waking up threads
+constexpr int64_t kMinGatherBytesPerTask = 65536;
+
+} // namespace optimized
+
+/**
+ * @brief Gather slices of input along axis by coords
+ *
+ * Rows of output are split over the thread pool of ruy_context if it is given, and input rows of
+ * coords ahead are prefetched.
+ */
 template <typename T, typename CoordsT = int32_t>
 inline void Gather(const GatherParams &op_params, const Shape &input_shape, const T *input_data,
                    const Shape &coords_shape, const CoordsT *coords_data, const Shape &,
-                   T *output_data)
+                   T *output_data, ruy::Context *ruy_context = nullptr)
 {
   int axis = op_params.axis;
   if (axis < 0)
@@ -54,17 +125,57 @@ inline void Gather(const GatherParams &op_params, const Shape &input_shape, cons
     inner_size *= input_shape.Dims(i);
   }
 
-  for (int outer = 0; outer < outer_size; ++outer)
+  auto copy_row = [&](const T *row, int unit) {
+    std::memcpy(output_data + static_cast<int64_t>(unit) * inner_size, row,
+                sizeof(T) * inner_size);
+  };
+  auto fn = [&](int start, int end) {
+    optimized::GatherRows(input_data, axis_size, inner_size, coords_data, coords_count, start,
+                          end, copy_row);
+  };
+  cpu_backend_threadpool::ExecuteRanges(outer_size * coords_count,
+                                        static_cast<int64_t>(inner_size) * sizeof(T),
+                                        optimized::kMinGatherBytesPerTask, fn, ruy_context);
+}
+
+/**
+ * @brief Gather rows of a block quantized table into floats
+ *
+ * input is [rows, cols] of Q4_0 or Q8_0 blocks along cols, and gathered along axis 0 like an
+ * embedding lookup. Rows are dequantized as they are copied, so the table stays quantized.
+ */
+template <typename Block, typename CoordsT = int32_t>
+inline void GatherBlockQuant(const Shape &input_shape, const Block *input_data,
+                             const Shape &coords_shape, const CoordsT *coords_data,
+                             const Shape &output_shape, float *output_data,
+                             ruy::Context *ruy_context = nullptr)
+{
+  if (input_shape.DimensionsCount() != 2)
+    throw std::runtime_error("cker::GatherBlockQuant: input should be rank 2");
+  const int axis_size = input_shape.Dims(0);
+  const int cols = input_shape.Dims(1);
+  if (cols % kBlockQuantSize != 0)
+    throw std::runtime_error("cker::GatherBlockQuant: cols should be a multiple of block size");
+  const int coords_count = coords_shape.FlatSize();
+  if (output_shape.FlatSize() != coords_count * cols)
+    throw std::runtime_error("cker::GatherBlockQuant: invalid output shape");
+  for (int i = 0; i < coords_count; ++i)
   {
-    for (int i = 0; i < coords_count; ++i)
-    {
-      assert(coords_data[i] >= 0);
-      assert(coords_data[i] < axis_size);
-      std::memcpy(output_data + (outer * coords_count + i) * inner_size,
-                  input_data + (outer * axis_size + coords_data[i]) * inner_size,
-                  sizeof(T) * inner_size);
-    }
+    if (coords_data[i] < 0 || coords_data[i] >= axis_size)
+      throw std::runtime_error("cker::GatherBlockQuant: coords out of range");
   }
+
+  const int blocks_per_row = cols / kBlockQuantSize;
+  auto copy_row = [&](const Block *row, int unit) {
+    optimized::DequantizeBlocks(row, blocks_per_row,
+                                output_data + static_cast<int64_t>(unit) * cols);
+  };
+  auto fn = [&](int start, int end) {
+    optimized::GatherRows(input_data, axis_size, blocks_per_row, coords_data, coords_count,
+                          start, end, copy_row);
+  };
+  cpu_backend_threadpool::ExecuteRanges(coords_count, static_cast<int64_t>(cols) * sizeof(float),
+                                        optimized::kMinGatherBytesPerTask, fn, ruy_context);
 }
 
 } // namespace cker
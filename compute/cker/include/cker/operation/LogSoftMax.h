@@ -21,9 +21,12 @@
 #include "cker/Utils.h"
 #include "cker/Types.h"
 #include "cker/eigen/Utils.h"
+#include "cker/operation/ParallelElementwise.h"
+#include "cker/x86/SoftMax.h"
 
 #include <Eigen/Core>
 #include <fixedpoint/fixedpoint.h>
+#include <ruy/context.h>
 #include <cmath>
 
 namespace nnfw
@@ -31,8 +34,10 @@ namespace nnfw
 namespace cker
 {
 
+// Outer slices are split over the thread pool of ruy_context if it is given
 inline void LogSoftmax(const SoftmaxParams &params, const Shape &input_shape,
-                       const float *input_data, const Shape &output_shape, float *output_data)
+                       const float *input_data, const Shape &output_shape, float *output_data,
+                       ruy::Context *ruy_context = nullptr)
 {
   const int rank = input_shape.DimensionsCount();
   const int axis = (params.axis < 0) ? params.axis + rank : params.axis;
@@ -51,34 +56,48 @@ inline void LogSoftmax(const SoftmaxParams &params, const Shape &input_shape,
     inner_size *= input_shape.Dims(i);
   }
 
-  for (int i = 0; i < outer_size; ++i)
-  {
-    for (int j = 0; j < inner_size; ++j)
+  auto fn = [&](int start, int end) {
+#ifdef USE_X86_SIMD
+    // Rows are contiguous when axis is the last dimension
+    if (inner_size == 1 && GetX86SimdLevel() != X86SimdLevel::kNone)
     {
-      float max = std::numeric_limits<float>::lowest();
-      for (int c = 0; c < depth; ++c)
-      {
-        max = std::max(max, input_data[(i * depth + c) * inner_size]);
-      }
-
-      float sum = 0.f;
-      for (int c = 0; c < depth; ++c)
-      {
-        sum += std::exp((input_data[(i * depth + c) * inner_size + j] - max) * beta);
-      }
+      x86::LogSoftmax(input_data + start * depth, depth, end - start, params.beta,
+                      output_data + start * depth);
+      return;
+    }
+#endif // USE_X86_SIMD
 
-      const float log_sum = std::log(sum);
-      for (int c = 0; c < depth; ++c)
+    for (int i = start; i < end; ++i)
+    {
+      for (int j = 0; j < inner_size; ++j)
       {
-        output_data[(i * depth + c) * inner_size + j] =
-          (input_data[(i * depth + c) * inner_size + j] - max) * beta - log_sum;
+        float max = std::numeric_limits<float>::lowest();
+        for (int c = 0; c < depth; ++c)
+        {
+          max = std::max(max, input_data[(i * depth + c) * inner_size + j]);
+        }
+
+        float sum = 0.f;
+        for (int c = 0; c < depth; ++c)
+        {
+          sum += std::exp((input_data[(i * depth + c) * inner_size + j] - max) * beta);
+        }
+
+        const float log_sum = std::log(sum);
+        for (int c = 0; c < depth; ++c)
+        {
+          output_data[(i * depth + c) * inner_size + j] =
+            (input_data[(i * depth + c) * inner_size + j] - max) * beta - log_sum;
+        }
       }
     }
-  }
+  };
+  ParallelElementwise(outer_size, depth * inner_size, ruy_context, fn);
 }
 
 inline void LogSoftmax(const SoftmaxParams &params, float input_scale, const Shape &input_shape,
-                       const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data)
+                       const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data,
+                       ruy::Context *ruy_context = nullptr)
 {
   const int rank = input_shape.DimensionsCount();
   const int axis = (params.axis < 0) ? params.axis + rank : params.axis;
@@ -100,37 +119,40 @@ inline void LogSoftmax(const SoftmaxParams &params, float input_scale, const Sha
     inner_size *= input_shape.Dims(i);
   }
 
-  for (int i = 0; i < outer_size; ++i)
-  {
-    for (int j = 0; j < inner_size; ++j)
+  auto fn = [&](int start, int end) {
+    for (int i = start; i < end; ++i)
     {
-      uint8_t max_val = std::numeric_limits<uint8_t>::min();
-      for (int c = 0; c < depth; ++c)
-      {
-        max_val = std::max(max_val, input_data[(i * depth + c) * inner_size]);
-      }
-
-      float sum_exp = 0.0f;
-      const int32_t max_uint8 = std::numeric_limits<uint8_t>::max();
-      const float *table_offset = &params.table[max_uint8 - max_val];
-      for (int c = 0; c < depth; ++c)
+      for (int j = 0; j < inner_size; ++j)
       {
-        sum_exp += table_offset[input_data[(i * depth + c) * inner_size]];
-      }
-      const float log_sum_exp = std::log(sum_exp);
-
-      const float scale = input_scale / params.scale;
-      const float precomputed = (input_scale * max_val * beta + log_sum_exp) / params.scale;
-      for (int c = 0; c < depth; ++c)
-      {
-        const float log_prob =
-          scale * input_data[(i * depth + c) * inner_size] * beta - precomputed;
-        const int32_t prob_quantized = std::rint(log_prob) + params.zero_point;
-        output_data[(i * depth + c) * inner_size] =
-          static_cast<uint8_t>(std::max(std::min(clamp_max, prob_quantized), clamp_min));
+        uint8_t max_val = std::numeric_limits<uint8_t>::min();
+        for (int c = 0; c < depth; ++c)
+        {
+          max_val = std::max(max_val, input_data[(i * depth + c) * inner_size + j]);
+        }
+
+        float sum_exp = 0.0f;
+        const int32_t max_uint8 = std::numeric_limits<uint8_t>::max();
+        const float *table_offset = &params.table[max_uint8 - max_val];
+        for (int c = 0; c < depth; ++c)
+        {
+          sum_exp += table_offset[input_data[(i * depth + c) * inner_size + j]];
+        }
+        const float log_sum_exp = std::log(sum_exp);
+
+        const float scale = input_scale / params.scale;
+        const float precomputed = (input_scale * max_val * beta + log_sum_exp) / params.scale;
+        for (int c = 0; c < depth; ++c)
+        {
+          const float log_prob =
+            scale * input_data[(i * depth + c) * inner_size + j] * beta - precomputed;
+          const int32_t prob_quantized = std::rint(log_prob) + params.zero_point;
+          output_data[(i * depth + c) * inner_size + j] =
+            static_cast<uint8_t>(std::max(std::min(clamp_max, prob_quantized), clamp_min));
+        }
       }
     }
-  }
+  };
+  ParallelElementwise(outer_size, depth * inner_size, ruy_context, fn);
 }
 
 } // namespace cker
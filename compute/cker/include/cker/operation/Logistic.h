@@ -20,6 +20,7 @@
 
 #include "cker/Shape.h"
 #include "cker/eigen/Utils.h"
+#include "cker/x86/Activation.h"
 
 #include <cmath>
 #include <Eigen/Core>
@@ -32,6 +33,14 @@ namespace cker
 inline void Logistic(const Shape &input_shape, const float *input_data, const Shape &output_shape,
                      float *output_data)
 {
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::Logistic(MatchingFlatSize(input_shape, output_shape), input_data, output_data);
+    return;
+  }
+#endif // USE_X86_SIMD
+
   auto input_map = MapAsVector(input_data, input_shape);
   auto output_map = MapAsVector(output_data, output_shape);
 
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NNFW_CKER_PARALLEL_ELEMENTWISE_H__
+#define __NNFW_CKER_PARALLEL_ELEMENTWISE_H__
+
+#include "cker/CpuBackendThreadpool.h"
+
+#include <ruy/context.h>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Elementwise work is bound by memory, so a task should touch enough elements to pay for waking
+// up a thread
+constexpr int kMinElementsPerElementwiseTask = 16384;
+
+} // namespace optimized
+
+/**
+ * @brief Run fn(start, end) on ranges of [0, units) split over the thread pool of ruy_context
+ *
+ * A unit is unit_size elements, e.g. 1 for flat tensors or a slice of the outer axis. Ranges keep
+ * at least kMinElementsPerElementwiseTask elements, and small tensors run on the caller thread.
+ */
+template <typename Fn>
+inline void ParallelElementwise(int units, int unit_size, ruy::Context *ruy_context, const Fn &fn)
+{
+  cpu_backend_threadpool::ExecuteRanges(units, unit_size,
+                                        optimized::kMinElementsPerElementwiseTask, fn, ruy_context);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_PARALLEL_ELEMENTWISE_H__
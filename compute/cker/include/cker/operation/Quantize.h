@@ -22,6 +22,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/x86/Quantize.h"
 #include <cassert>
 #include <iostream>
 #include <stdexcept>
@@ -54,6 +55,14 @@ inline void Quantize(const Shape &input_shape, const float *input_data, const Sh
   static constexpr int32_t min_val = std::numeric_limits<int8_t>::min();
   static constexpr int32_t max_val = std::numeric_limits<int8_t>::max();
 
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::Quantize(flat_size, input_data, scale, zero_point, output_data);
+    return;
+  }
+#endif // USE_X86_SIMD
+
   int i = 0;
 #ifdef USE_NEON
   const float32x4_t reverse_scale_dup = vdupq_n_f32(1.0f / scale);
@@ -107,6 +116,14 @@ inline void Quantize(const Shape &input_shape, const float *input_data, const Sh
   static constexpr int32_t min_val = std::numeric_limits<uint8_t>::min();
   static constexpr int32_t max_val = std::numeric_limits<uint8_t>::max();
 
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::Quantize(flat_size, input_data, scale, zero_point, output_data);
+    return;
+  }
+#endif // USE_X86_SIMD
+
   int i = 0;
 #ifdef USE_NEON
   const float32x4_t reverse_scale_dup = vdupq_n_f32(1.0f / scale);
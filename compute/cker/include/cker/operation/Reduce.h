@@ -22,6 +22,7 @@
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/neon/neon_check.h"
+#include "cker/x86/Reduce.h"
 
 namespace nnfw
 {
@@ -114,6 +115,38 @@ inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape
 }
 #endif // NEON
 
+#ifdef USE_X86_SIMD
+inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape,
+                               float *output_data)
+{
+  const auto input_dims = input_shape.DimsData();
+  const auto input_num_dims = input_shape.DimensionsCount();
+
+  int input_size = 1;
+  for (int idx = 0; idx < input_num_dims - 1; idx++)
+  {
+    input_size *= input_dims[idx];
+  }
+  const int reduce_size = input_dims[input_num_dims - 1];
+
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::ReduceSumRows(input_data, input_size, reduce_size, output_data);
+    return;
+  }
+
+  for (int idx = 0; idx < input_size; idx++)
+  {
+    float sum = 0.f;
+    for (int r_idx = 0; r_idx < reduce_size; r_idx++)
+    {
+      sum += input_data[idx * reduce_size + r_idx];
+    }
+    output_data[idx] = sum;
+  }
+}
+#endif // USE_X86_SIMD
+
 template <typename In, typename Out>
 inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
                        const int *axis, const int num_axis, int *input_iter,
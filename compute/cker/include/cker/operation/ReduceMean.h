@@ -21,6 +21,8 @@
 #include "cker/Shape.h"
 #include "cker/operation/Reduce.h"
 
+#include <type_traits>
+
 namespace nnfw
 {
 namespace cker
@@ -245,6 +247,23 @@ void MeanAxis1And2(const Shape &input_shape, const In *input_data, const Shape &
   const int input_height = input_shape.Dims(1);
   const int input_width = input_shape.Dims(2);
 
+#ifdef USE_X86_SIMD
+  if (std::is_same<In, float>::value && std::is_same<Out, float>::value &&
+      GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    // Sum H * W pixels of each batch over channels
+    const int pixels = input_height * input_width;
+    for (int out_b = 0; out_b < output_batch; ++out_b)
+    {
+      x86::ReduceSumColumns(reinterpret_cast<const float *>(input_data) +
+                              out_b * pixels * output_depth,
+                            pixels, output_depth, static_cast<float>(pixels),
+                            reinterpret_cast<float *>(output_data) + out_b * output_depth);
+    }
+    return;
+  }
+#endif // USE_X86_SIMD
+
   for (int out_b = 0; out_b < output_batch; ++out_b)
   {
     for (int out_d = 0; out_d < output_depth; ++out_d)
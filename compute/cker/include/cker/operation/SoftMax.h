@@ -22,6 +22,8 @@
 #include "cker/Utils.h"
 #include "cker/Types.h"
 #include "cker/eigen/Utils.h"
+#include "cker/operation/ParallelElementwise.h"
+#include "cker/x86/SoftMax.h"
 
 #if __aarch64__ && __clang__
 #define TFLITE_SOFTMAX_USE_UINT16_LUT
@@ -29,6 +31,7 @@
 
 #include <Eigen/Core>
 #include <fixedpoint/fixedpoint.h>
+#include <ruy/context.h>
 #include <cmath>
 
 namespace nnfw
@@ -75,12 +78,60 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
 }
 } // namespace reference
 
+namespace optimized
+{
+
+// Softmax of rows [start, end), each of depth elements
+inline void SoftmaxRows(const float *in, int depth, int start, int end, float beta, float *out)
+{
+  in += start * depth;
+  out += start * depth;
+
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::Softmax(in, depth, end - start, beta, out);
+    return;
+  }
+#endif // USE_X86_SIMD
+
+  MatrixMap<const float> in_mat(in, depth, end - start);
+  MatrixMap<float> out_mat(out, depth, end - start);
+  // Compute the exponential first, removing the max coefficient for numerical
+  // stability.
+  out_mat = (in_mat.rowwise() - in_mat.colwise().maxCoeff()).array() * beta;
+  // We are separating out the exp function so that exp can be vectorized.
+  out_mat = out_mat.array().exp();
+  // Normalize to get the activations.
+  Eigen::Array<float, 1, Eigen::Dynamic> scale = out_mat.array().colwise().sum().inverse();
+  out_mat.array().rowwise() *= scale;
+}
+
+} // namespace optimized
+
 // Performs softmax along the input of size (input_size * batch_size).
+// Batches are split over the thread pool of ruy_context if it is given.
 inline void Softmax(const float *in, const int input_size, const int batch_size, const float beta,
-                    float *out)
+                    float *out, ruy::Context *ruy_context = nullptr)
 {
   assert(input_size > 0);
 
+  if (batch_size > 1 && ruy_context)
+  {
+    ParallelElementwise(batch_size, input_size, ruy_context, [&](int start, int end) {
+      Softmax(in + start * input_size, input_size, end - start, beta, out + start * input_size);
+    });
+    return;
+  }
+
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::Softmax(in, input_size, batch_size, beta, out);
+    return;
+  }
+#endif // USE_X86_SIMD
+
   // For each batch
   for (int b = 0; b < batch_size; b++)
   {
@@ -113,22 +164,21 @@ inline void Softmax(const float *in, const int input_size, const int batch_size,
   }
 }
 
+// Rows along the last dimension are split over the thread pool of ruy_context if it is given
 inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &output_shape, float *output_data)
+                    const Shape &output_shape, float *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   // Validate whether if shapes of input and output are the same
   MatchingFlatSize(input_shape, output_shape);
 
-  const auto in_mat = MapAsMatrixWithLastDimAsRows(input_data, input_shape);
-  auto out_mat = MapAsMatrixWithLastDimAsRows(output_data, output_shape);
-  // Compute the exponential first, removing the max coefficient for numerical
-  // stability.
-  out_mat = (in_mat.rowwise() - in_mat.colwise().maxCoeff()).array() * params.beta;
-  // We are separating out the exp function so that exp can be vectorized.
-  out_mat = out_mat.array().exp();
-  // Normalize to get the activations.
-  Eigen::Array<float, 1, Eigen::Dynamic> scale = out_mat.array().colwise().sum().inverse();
-  out_mat.array().rowwise() *= scale;
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const float beta = params.beta;
+  ParallelElementwise(outer_size, depth, ruy_context, [&](int start, int end) {
+    optimized::SoftmaxRows(input_data, depth, start, end, beta, output_data);
+  });
 }
 
 template <typename T> inline int32_t QuantizeSoftmaxOutput(float prob_rescaled, int32_t zero_point)
@@ -155,14 +205,26 @@ inline void PopulateSoftmaxLookupTable(float *table, float input_scale, float be
   }
 }
 
+// Rows along the last dimension are split over the thread pool of ruy_context if it is given
 template <typename In, typename Out>
 inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const In *input_data,
-                    const Shape &output_shape, Out *output_data)
+                    const Shape &output_shape, Out *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   const int trailing_dim = input_shape.DimensionsCount() - 1;
   const int excluding_last_dim = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
   const int last_dim = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
 
+  if (excluding_last_dim > 1 && ruy_context)
+  {
+    ParallelElementwise(excluding_last_dim, last_dim, ruy_context, [&](int start, int end) {
+      const Shape rows_shape{end - start, last_dim};
+      Softmax(params, rows_shape, input_data + start * last_dim, rows_shape,
+              output_data + start * last_dim);
+    });
+    return;
+  }
+
   const int32_t clamp_max = std::numeric_limits<Out>::max();
   const int32_t clamp_min = std::numeric_limits<Out>::min();
   for (int i = 0; i < excluding_last_dim; ++i)
@@ -285,12 +347,23 @@ inline void StoreValue(int32x4x4_t value_to_store, uint8_t *output)
 
 template <typename In, typename Out>
 inline void SoftmaxInt8LUT(const SoftmaxParams &params, const Shape &input_shape,
-                           const In *input_data, const Shape &output_shape, Out *output_data)
+                           const In *input_data, const Shape &output_shape, Out *output_data,
+                           ruy::Context *ruy_context = nullptr)
 {
   const int trailing_dim = input_shape.DimensionsCount() - 1;
   const int excluding_last_dim = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
   const int last_dim = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
 
+  if (excluding_last_dim > 1 && ruy_context)
+  {
+    ParallelElementwise(excluding_last_dim, last_dim, ruy_context, [&](int start, int end) {
+      const Shape rows_shape{end - start, last_dim};
+      SoftmaxInt8LUT(params, rows_shape, input_data + start * last_dim, rows_shape,
+                     output_data + start * last_dim);
+    });
+    return;
+  }
+
   const int32_t clamp_max = std::numeric_limits<Out>::max();
   const int32_t clamp_min = std::numeric_limits<Out>::min();
 
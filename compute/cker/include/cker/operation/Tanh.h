@@ -21,6 +21,7 @@
 #include "cker/eigen/Utils.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/x86/Activation.h"
 #include <Eigen/Core>
 
 namespace nnfw
@@ -31,6 +32,14 @@ namespace cker
 inline void Tanh(const Shape &input_shape, const float *input_data, const Shape &output_shape,
                  float *output_data)
 {
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::Tanh(MatchingFlatSize(input_shape, output_shape), input_data, output_data);
+    return;
+  }
+#endif // USE_X86_SIMD
+
   auto input_map = MapAsVector(input_data, input_shape);
   auto output_map = MapAsVector(output_data, output_shape);
   output_map.array() = input_map.array().tanh();
@@ -18,92 +18,164 @@
 #ifndef __NNFW_CKER_TRANSPOSE_CONV_H__
 #define __NNFW_CKER_TRANSPOSE_CONV_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/optimized/TransposeConv.h"
+#include "cker/operation/reference/TransposeConv.h"
+
+#include <ruy/context.h>
+
+#include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
 
-inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
-                          const float *input_data, const Shape &filter_shape,
-                          const float *filter_data, const Shape &output_shape, float *output_data)
+/**
+ * @brief TransposeConv as GEMM + col2im
+ *
+ * For each batch, GEMM computes the contribution of every input pixel to every filter tap
+ * and output channel on ruy, and col2im gathers them into output rows in parallel.
+ * Filter is transposed from OHWI into HWOI, once in prepare() if it is constant.
+ */
+class TransposeConv
 {
+public:
+  TransposeConv() : _prepared(false) {}
+
+  template <typename T> void prepare(const Shape &filter_shape, const T *filter_data)
+  {
+    transposeFilter(filter_shape, filter_data);
+    _prepared = true;
+  }
 
-  const int stride_width = params.stride_width;
-  const int stride_height = params.stride_height;
-  const int pad_width = params.padding_values.width;
-  const int pad_height = params.padding_values.height;
-
-  assert(input_shape.DimensionsCount() == 4);
-  assert(filter_shape.DimensionsCount() == 4);
-  assert(output_shape.DimensionsCount() == 4);
-
-  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
-  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
-  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
-  const int input_height = input_shape.Dims(1);
-  const int input_width = input_shape.Dims(2);
-  const int filter_height = filter_shape.Dims(1);
-  const int filter_width = filter_shape.Dims(2);
-  const int output_height = output_shape.Dims(1);
-  const int output_width = output_shape.Dims(2);
-
-  // Although transpose convolution simplifies to convolution with transposed
-  // weights for strides of 1, non-unitary striding complicates matters. To
-  // keep this reference implementation as clear as possible, we use a
-  // "scatter" access pattern, where we loop through all the input elements,
-  // computing their influence on the output, rather than looping through the
-  // output elements in the typical "gather" access pattern of a conv. We
-  // therefore must initialize the output array to zero.
-  const int num_elements = output_shape.FlatSize();
-  for (int i = 0; i < num_elements; i++)
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const float *input_data, const Shape &filter_shape, const float *filter_data,
+                  const Shape &bias_shape, const float *bias_data, const Shape &output_shape,
+                  float *output_data, ruy::Context *ruy_context = nullptr)
   {
-    output_data[i] = 0.0f;
+    assert(!bias_data || bias_shape.FlatSize() == output_shape.Dims(3));
+    UNUSED_RELEASE(bias_shape);
+    if (!_prepared)
+      transposeFilter(filter_shape, filter_data);
+
+    const auto float_min = params.float_activation_min;
+    const auto float_max = params.float_activation_max;
+    auto output_fn = [&](float acc, int oc) {
+      if (bias_data)
+        acc += bias_data[oc];
+      return ActivationFunctionWithMinMax(acc, float_min, float_max);
+    };
+
+    run(params, input_shape, filter_shape, output_shape, output_data, _col_float, ruy_context,
+        [&](int input_pixels, int input_depth, int col_cols, int batch, float *col) {
+          optimized::TransposeConvGemm(input_pixels, input_depth, col_cols,
+                                       input_data + batch * input_pixels * input_depth,
+                                       hwoiFilter<float>(), _prepared, col, ruy_context);
+        },
+        output_fn);
   }
 
-  // Loop through input elements one at a time.
-  for (int batch = 0; batch < batches; ++batch)
+  /**
+   * @note uint8 supports per-tensor quantized filter only, int8 supports per-channel quantized
+   *       symmetric filter. per_channel_output_multiplier() and per_channel_output_shift()
+   *       should be filled for every output channel.
+   */
+  template <typename T>
+  void operator()(const TransposeConvParams &params, const Shape &input_shape, const T *input_data,
+                  const Shape &filter_shape, const T *filter_data, const Shape &bias_shape,
+                  const int32_t *bias_data, const Shape &output_shape, T *output_data,
+                  ruy::Context *ruy_context = nullptr)
   {
-    for (int in_y = 0; in_y < input_height; ++in_y)
+    static_assert(std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value,
+                  "TransposeConv: unsupported quantized type");
+    assert(!bias_data || bias_shape.FlatSize() == output_shape.Dims(3));
+    assert(static_cast<int>(_per_channel_output_multiplier.size()) == output_shape.Dims(3));
+    UNUSED_RELEASE(bias_shape);
+    if (!_prepared)
+      transposeFilter(filter_shape, filter_data);
+
+    const int32_t *multipliers = _per_channel_output_multiplier.data();
+    const int *shifts = _per_channel_output_shift.data();
+    auto output_fn = [&](int32_t acc, int oc) {
+      if (bias_data)
+        acc += bias_data[oc];
+      acc = MultiplyByQuantizedMultiplier(acc, multipliers[oc], shifts[oc]);
+      acc += params.output_offset;
+      acc = std::max(acc, params.quantized_activation_min);
+      acc = std::min(acc, params.quantized_activation_max);
+      return static_cast<T>(acc);
+    };
+
+    const T input_zero_point = static_cast<T>(-params.input_offset);
+    const T filter_zero_point = static_cast<T>(-params.weights_offset);
+    run(params, input_shape, filter_shape, output_shape, output_data, _col_int32, ruy_context,
+        [&](int input_pixels, int input_depth, int col_cols, int batch, int32_t *col) {
+          optimized::TransposeConvGemm(input_pixels, input_depth, col_cols,
+                                       input_data + batch * input_pixels * input_depth,
+                                       input_zero_point, hwoiFilter<T>(), filter_zero_point,
+                                       _prepared, col, ruy_context);
+        },
+        output_fn);
+  }
+
+  std::vector<int32_t> &per_channel_output_multiplier() { return _per_channel_output_multiplier; }
+  std::vector<int> &per_channel_output_shift() { return _per_channel_output_shift; }
+
+private:
+  template <typename AccT, typename OutT, typename GemmFn, typename OutputFn>
+  void run(const TransposeConvParams &params, const Shape &input_shape, const Shape &filter_shape,
+           const Shape &output_shape, OutT *output_data, std::vector<AccT> &col,
+           ruy::Context *ruy_context, const GemmFn &gemm_fn, const OutputFn &output_fn)
+  {
+    assert(input_shape.DimensionsCount() == 4);
+    assert(filter_shape.DimensionsCount() == 4);
+    assert(output_shape.DimensionsCount() == 4);
+
+    const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+    const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+    const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+    const int input_pixels = input_shape.Dims(1) * input_shape.Dims(2);
+    const int output_height = output_shape.Dims(1);
+    const int output_size = output_height * output_shape.Dims(2) * output_depth;
+    const int col_cols = filter_shape.Dims(1) * filter_shape.Dims(2) * output_depth;
+    col.resize(static_cast<size_t>(input_pixels) * col_cols);
+
+    for (int b = 0; b < batches; ++b)
     {
-      for (int in_x = 0; in_x < input_width; ++in_x)
-      {
-        for (int in_channel = 0; in_channel < input_depth; ++in_channel)
-        {
-          // Loop through the output elements it will influence
-          const int out_x_origin = (in_x * stride_width) - pad_width;
-          const int out_y_origin = (in_y * stride_height) - pad_height;
-          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
-          {
-            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
-            {
-              for (int out_channel = 0; out_channel < output_depth; ++out_channel)
-              {
-                // Compute output element location
-                const int out_x = out_x_origin + filter_x;
-                const int out_y = out_y_origin + filter_y;
-                // We cannot accumulate out of bounds
-                if ((out_x >= 0) && (out_x < output_width) && (out_y >= 0) &&
-                    (out_y < output_height))
-                {
-                  float input_value =
-                    input_data[Offset(input_shape, batch, in_y, in_x, in_channel)];
-                  float filter_value =
-                    filter_data[Offset(filter_shape, out_channel, filter_y, filter_x, in_channel)];
-                  output_data[Offset(output_shape, batch, out_y, out_x, out_channel)] +=
-                    input_value * filter_value;
-                }
-              }
-            }
-          }
-        }
-      }
+      gemm_fn(input_pixels, input_depth, col_cols, b, col.data());
+
+      OutT *output_batch = output_data + b * output_size;
+      auto col2im_fn = [&](int row_start, int row_end) {
+        optimized::TransposeConvCol2Im(params, input_shape, filter_shape, output_shape,
+                                       col.data(), output_batch, row_start, row_end, output_fn);
+      };
+      // Split output rows over the thread pool of ruy_context
+      cpu_backend_threadpool::ExecuteRanges(output_height, 1, 0, col2im_fn, ruy_context);
     }
   }
-}
+
+  template <typename T> void transposeFilter(const Shape &filter_shape, const T *filter_data)
+  {
+    _hwoi_filter.resize(filter_shape.FlatSize() * sizeof(T));
+    optimized::TransposeConvFilterToHWOI(filter_shape, filter_data, hwoiFilter<T>());
+  }
+
+  template <typename T> T *hwoiFilter() { return reinterpret_cast<T *>(_hwoi_filter.data()); }
+
+private:
+  bool _prepared;
+  // Filter in HWOI layout, element type depends on the kernel
+  std::vector<uint8_t> _hwoi_filter;
+  std::vector<float> _col_float;
+  std::vector<int32_t> _col_int32;
+  // Per channel output multiplier and shift.
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+};
 
 } // namespace cker
 } // namespace nnfw
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
+#define __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
+#include <ruy/ruy.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+/**
+ * @brief Dimensions of BatchMatMul seen as a batch of [rows x depth] * [depth x cols] products
+ *
+ * Batch dimensions are broadcast as in reference::BatchMatMul. adj_x and adj_y are handled by
+ * reading the operands in column-major order, so no transposed copy is made.
+ */
+struct BatchMatMulGeometry
+{
+  BatchMatMulGeometry(const Shape &lhs_shape, const Shape &rhs_shape, bool adj_x, bool adj_y)
+  {
+    const Shape lhs = Shape::ExtendedShape(5, lhs_shape);
+    const Shape rhs = Shape::ExtendedShape(5, rhs_shape);
+
+    rows = adj_x ? lhs.Dims(4) : lhs.Dims(3);
+    depth = adj_x ? lhs.Dims(3) : lhs.Dims(4);
+    cols = adj_y ? rhs.Dims(3) : rhs.Dims(4);
+    assert(depth == (adj_y ? rhs.Dims(4) : rhs.Dims(3)));
+    lhs_transposed = adj_x;
+    rhs_transposed = adj_y;
+
+    // Stride of each batch dimension, 0 if the dimension is broadcast
+    const int lhs_matrix_size = lhs.Dims(3) * lhs.Dims(4);
+    const int rhs_matrix_size = rhs.Dims(3) * rhs.Dims(4);
+    int lhs_stride = lhs_matrix_size;
+    int rhs_stride = rhs_matrix_size;
+    for (int i = 2; i >= 0; --i)
+    {
+      assert(lhs.Dims(i) == rhs.Dims(i) || lhs.Dims(i) == 1 || rhs.Dims(i) == 1);
+      batch_dims[i] = std::max(lhs.Dims(i), rhs.Dims(i));
+      lhs_strides[i] = lhs.Dims(i) == 1 ? 0 : lhs_stride;
+      rhs_strides[i] = rhs.Dims(i) == 1 ? 0 : rhs_stride;
+      lhs_stride *= lhs.Dims(i);
+      rhs_stride *= rhs.Dims(i);
+    }
+    batches = batch_dims[0] * batch_dims[1] * batch_dims[2];
+  }
+
+  int lhsOffset(int batch) const { return offset(batch, lhs_strides); }
+  int rhsOffset(int batch) const { return offset(batch, rhs_strides); }
+  int outputOffset(int batch) const { return batch * rows * cols; }
+
+  int batches;
+  int rows;
+  int cols;
+  int depth;
+  bool lhs_transposed;
+  bool rhs_transposed;
+
+private:
+  int offset(int batch, const int (&strides)[3]) const
+  {
+    const int b2 = batch % batch_dims[2];
+    const int b1 = (batch / batch_dims[2]) % batch_dims[1];
+    const int b0 = batch / (batch_dims[2] * batch_dims[1]);
+    return b0 * strides[0] + b1 * strides[1] + b2 * strides[2];
+  }
+
+  int batch_dims[3];
+  int lhs_strides[3];
+  int rhs_strides[3];
+};
+
+template <typename T>
+inline void MakeBatchMatMulOperand(int rows, int cols, bool transposed, T zero_point,
+                                   bool cacheable, const T *data, ruy::Matrix<T> *matrix)
+{
+  MatrixParams<T> params;
+  params.order = transposed ? Order::kColMajor : Order::kRowMajor;
+  params.rows = rows;
+  params.cols = cols;
+  params.zero_point = zero_point;
+  params.cache_policy = cacheable ? CachePolicy::kAlwaysCache : CachePolicy::kNeverCache;
+  ruy_support::MakeRuyMatrix(params, data, matrix, cacheable);
+}
+
+inline void BatchMatMulSlice(const BatchMatMulGeometry &geo, bool rhs_cacheable,
+                             const float *lhs_data, const float *rhs_data, float *output_data,
+                             int batch, ruy::Context *ruy_context)
+{
+  ruy::Matrix<float> lhs;
+  ruy::Matrix<float> rhs;
+  ruy::Matrix<float> dst;
+  MakeBatchMatMulOperand(geo.rows, geo.depth, geo.lhs_transposed, 0.f, false,
+                         lhs_data + geo.lhsOffset(batch), &lhs);
+  MakeBatchMatMulOperand(geo.depth, geo.cols, geo.rhs_transposed, 0.f, rhs_cacheable,
+                         rhs_data + geo.rhsOffset(batch), &rhs);
+  ruy::MakeSimpleLayout(geo.rows, geo.cols, ruy::Order::kRowMajor, dst.mutable_layout());
+  dst.set_data(output_data + geo.outputOffset(batch));
+
+  ruy::MulParams<float, float> mul_params;
+  ruy::Mul(lhs, rhs, mul_params, ruy_context, &dst);
+}
+
+// 8-bit asymmetric quantized slice on ruy
+template <typename T>
+inline void BatchMatMulSlice(const BatchMatMulGeometry &geo, const BatchMatMulParams &params,
+                             const T *lhs_data, const T *rhs_data, T *output_data, int batch,
+                             ruy::Context *ruy_context)
+{
+  static_assert(sizeof(T) == 1, "ruy path is for 8-bit types only");
+  ruy::Matrix<T> lhs;
+  ruy::Matrix<T> rhs;
+  ruy::Matrix<T> dst;
+  MakeBatchMatMulOperand(geo.rows, geo.depth, geo.lhs_transposed,
+                         static_cast<T>(params.lhs_zero_point), false,
+                         lhs_data + geo.lhsOffset(batch), &lhs);
+  MakeBatchMatMulOperand(geo.depth, geo.cols, geo.rhs_transposed,
+                         static_cast<T>(params.rhs_zero_point), params.rhs_cacheable,
+                         rhs_data + geo.rhsOffset(batch), &rhs);
+  ruy::MakeSimpleLayout(geo.rows, geo.cols, ruy::Order::kRowMajor, dst.mutable_layout());
+  dst.set_data(output_data + geo.outputOffset(batch));
+  dst.set_zero_point(static_cast<T>(params.output_zero_point));
+
+  GemmParams<int32_t, T> gemm_params;
+  gemm_params.multiplier_fixedpoint = params.output_multiplier;
+  gemm_params.multiplier_exponent = params.output_shift;
+  gemm_params.clamp_min = static_cast<T>(params.quantized_activation_min);
+  gemm_params.clamp_max = static_cast<T>(params.quantized_activation_max);
+  ruy::MulParams<int32_t, T> mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &mul_params);
+  ruy::Mul(lhs, rhs, mul_params, ruy_context, &dst);
+}
+
+// 16-bit symmetric quantized slice
+// ruy has no optimized int16 x int16 path and int32 accumulators may overflow, so accumulate
+// into int64 one output row at a time. Rows of rhs are read contiguously unless adj_y.
+inline void BatchMatMulSlice(const BatchMatMulGeometry &geo, const BatchMatMulParams &params,
+                             const int16_t *lhs_data, const int16_t *rhs_data,
+                             int16_t *output_data, int batch, ruy::Context *)
+{
+  const int16_t *lhs = lhs_data + geo.lhsOffset(batch);
+  const int16_t *rhs = rhs_data + geo.rhsOffset(batch);
+  int16_t *out = output_data + geo.outputOffset(batch);
+  const int lhs_row_stride = geo.lhs_transposed ? 1 : geo.depth;
+  const int lhs_depth_stride = geo.lhs_transposed ? geo.rows : 1;
+
+  std::vector<int64_t> acc(geo.cols);
+  for (int i = 0; i < geo.rows; ++i)
+  {
+    std::fill(acc.begin(), acc.end(), 0);
+    for (int k = 0; k < geo.depth; ++k)
+    {
+      const int64_t lhs_val = lhs[i * lhs_row_stride + k * lhs_depth_stride];
+      if (geo.rhs_transposed)
+      {
+        for (int j = 0; j < geo.cols; ++j)
+          acc[j] += lhs_val * rhs[j * geo.depth + k];
+      }
+      else
+      {
+        const int16_t *rhs_row = rhs + k * geo.cols;
+        for (int j = 0; j < geo.cols; ++j)
+          acc[j] += lhs_val * rhs_row[j];
+      }
+    }
+    for (int j = 0; j < geo.cols; ++j)
+    {
+      int32_t val =
+        MultiplyByQuantizedMultiplierInt64(acc[j], params.output_multiplier, params.output_shift);
+      val = std::min(std::max(val, params.quantized_activation_min),
+                     params.quantized_activation_max);
+      out[i * geo.cols + j] = static_cast<int16_t>(val);
+    }
+  }
+}
+
+/**
+ * @brief Run slice_fn on every batch slice
+ *
+ * If there are at least as many slices as threads, slices are split over the thread pool of
+ * ruy_context and each task multiplies with its own single threaded context in task_contexts.
+ * Otherwise slices run one by one and each ruy::Mul is multi-threaded by ruy_context itself.
+ */
+template <typename SliceFn>
+void RunBatchMatMulSlices(int batches, const SliceFn &slice_fn, ruy::Context *ruy_context,
+                          std::vector<std::unique_ptr<ruy::Context>> &task_contexts)
+{
+  const int thread_count = ruy_context ? ruy_context->max_num_threads() : 1;
+  if (thread_count <= 1 || batches < thread_count)
+  {
+    if (ruy_context == nullptr)
+    {
+      if (task_contexts.empty())
+        task_contexts.emplace_back(std::make_unique<ruy::Context>());
+      ruy_context = task_contexts[0].get();
+    }
+    for (int b = 0; b < batches; ++b)
+      slice_fn(b, ruy_context);
+    return;
+  }
+
+  while (static_cast<int>(task_contexts.size()) < thread_count)
+  {
+    task_contexts.emplace_back(std::make_unique<ruy::Context>());
+    task_contexts.back()->set_max_num_threads(1);
+  }
+
+  // Each range runs once, so ranges take distinct single threaded contexts
+  std::atomic<int> next_context{0};
+  auto range_fn = [&](int batch_start, int batch_end) {
+    ruy::Context *task_context = task_contexts[next_context++].get();
+    for (int b = batch_start; b < batch_end; ++b)
+      slice_fn(b, task_context);
+  };
+  cpu_backend_threadpool::ExecuteRanges(batches, 1, 0, range_fn, ruy_context);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
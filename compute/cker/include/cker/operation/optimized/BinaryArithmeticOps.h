@@ -26,6 +26,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/x86/BinaryArithmeticOps.h"
 #include "fixedpoint/fixedpoint.h"
 
 namespace nnfw
@@ -440,6 +441,12 @@ struct BinaryOpFuncAddFloat
     return vaddq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  template <typename V> static CKER_X86_INLINE void calculate(const V &a, const V &b, V *output)
+  {
+    *output = a + b;
+  }
+#endif // USE_X86_SIMD
   static inline float calculate(const float a, const float b) { return a + b; }
 };
 
@@ -451,6 +458,12 @@ struct BinaryOpFuncSubFloat
     return vsubq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  template <typename V> static CKER_X86_INLINE void calculate(const V &a, const V &b, V *output)
+  {
+    *output = a - b;
+  }
+#endif // USE_X86_SIMD
   static inline float calculate(const float a, const float b) { return a - b; }
 };
 
@@ -462,6 +475,12 @@ struct BinaryOpFuncMulFloat
     return vmulq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  template <typename V> static CKER_X86_INLINE void calculate(const V &a, const V &b, V *output)
+  {
+    *output = a * b;
+  }
+#endif // USE_X86_SIMD
   static inline float calculate(const float a, const float b) { return a * b; }
 };
 
@@ -475,6 +494,12 @@ struct BinaryOpFuncDivFloat
   }
 #endif // __aarch64__
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  template <typename V> static CKER_X86_INLINE void calculate(const V &a, const V &b, V *output)
+  {
+    *output = a / b;
+  }
+#endif // USE_X86_SIMD
   static inline float calculate(const float a, const float b) { return a / b; }
 };
 
@@ -484,6 +509,12 @@ template <class BASEOPERATOR> struct BinaryOpFuncSwapArgs
   {
     return BASEOPERATOR::calculate(b, a);
   }
+#ifdef USE_X86_SIMD
+  template <typename V> static CKER_X86_INLINE void calculate(const V &a, const V &b, V *output)
+  {
+    BASEOPERATOR::calculate(b, a, output);
+  }
+#endif // USE_X86_SIMD
 };
 
 struct BinaryOpActivationFloatNone
@@ -500,6 +531,20 @@ struct BinaryOpActivationFloatNone
     return value;
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  template <typename V>
+  static CKER_X86_INLINE void applyCeiling(const V &value, const V &ceilingParam, V *output)
+  {
+    (void)ceilingParam;
+    *output = value;
+  }
+  template <typename V>
+  static CKER_X86_INLINE void applyFloor(const V &value, const V &floorParam, V *output)
+  {
+    (void)floorParam;
+    *output = value;
+  }
+#endif // USE_X86_SIMD
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     (void)ceilingParam;
@@ -525,6 +570,19 @@ struct BinaryOpActivationFloatMax
     return vmaxq_f32(value, floorParam);
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  template <typename V>
+  static CKER_X86_INLINE void applyCeiling(const V &value, const V &ceilingParam, V *output)
+  {
+    (void)ceilingParam;
+    *output = value;
+  }
+  template <typename V>
+  static CKER_X86_INLINE void applyFloor(const V &value, const V &floorParam, V *output)
+  {
+    *output = value < floorParam ? floorParam : value;
+  }
+#endif // USE_X86_SIMD
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     (void)ceilingParam;
@@ -548,6 +606,18 @@ struct BinaryOpActivationFloatMinMax
     return vmaxq_f32(value, floorParam);
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  template <typename V>
+  static CKER_X86_INLINE void applyCeiling(const V &value, const V &ceilingParam, V *output)
+  {
+    *output = ceilingParam < value ? ceilingParam : value;
+  }
+  template <typename V>
+  static CKER_X86_INLINE void applyFloor(const V &value, const V &floorParam, V *output)
+  {
+    *output = value < floorParam ? floorParam : value;
+  }
+#endif // USE_X86_SIMD
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     return std::min(value, ceilingParam);
@@ -563,6 +633,15 @@ inline void BinaryOpElementwise(int size, const BinaryArithmeticOpParam &params,
                                 const float *input1_data, const float *input2_data,
                                 float *output_data)
 {
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::BinaryOpElementwise<OPERATOR, ACTIVATION>(size, params, input1_data, input2_data,
+                                                   output_data);
+    return;
+  }
+#endif // USE_X86_SIMD
+
   int i = 0;
 
 #ifdef USE_NEON
@@ -621,6 +700,15 @@ inline void BinaryOpScalarBroadcast(int size, const BinaryArithmeticOpParam &par
                                     const float broadcast_value, const float *input2_data,
                                     float *output_data)
 {
+#ifdef USE_X86_SIMD
+  if (GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::BinaryOpScalarBroadcast<OPERATOR, ACTIVATION>(size, params, broadcast_value, input2_data,
+                                                       output_data);
+    return;
+  }
+#endif // USE_X86_SIMD
+
   int i = 0;
 
 #ifdef USE_NEON
@@ -1219,7 +1307,7 @@ inline void Div(const BinaryArithmeticOpParam &params, const Shape &input1_shape
                 const float *input1_data, const Shape &input2_shape, const float *input2_data,
                 const Shape &output_shape, float *output_data)
 {
-#ifdef __aarch64__
+#if defined(__aarch64__) || defined(USE_X86_SIMD)
   const int flat_size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
   auto implFuncs = getBinaryOpWithActivationImplFloat<BinaryOpFuncDivFloat>(params);
   (*implFuncs.first)(flat_size, params, input1_data, input2_data, output_data);
@@ -1228,7 +1316,7 @@ inline void Div(const BinaryArithmeticOpParam &params, const Shape &input1_shape
     [](const float &a, const float &b) -> float { return a / b; };
   reference::BinaryArithmeticOp(params, input1_shape, input1_data, input2_shape, input2_data,
                                 output_shape, output_data, fn);
-#endif // __aarch64__
+#endif // defined(__aarch64__) || defined(USE_X86_SIMD)
 }
 
 inline void BroadcastDivDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
@@ -1236,7 +1324,7 @@ inline void BroadcastDivDispatch(const BinaryArithmeticOpParam &params, const Sh
                                  const float *input2_data, const Shape &output_shape,
                                  float *output_data)
 {
-#ifdef __aarch64__
+#if defined(__aarch64__) || defined(USE_X86_SIMD)
   if (params.broadcast_category == BroadcastableOpCategory::kFirstInputBroadcastsFast)
   {
     auto implFuncs = getBinaryOpWithActivationImplFloat<BinaryOpFuncDivFloat>(params);
@@ -1251,7 +1339,7 @@ inline void BroadcastDivDispatch(const BinaryArithmeticOpParam &params, const Sh
                             output_shape, output_data, implFuncs.first, implFuncs.second);
   }
   else
-#endif // __aarch64__
+#endif // defined(__aarch64__) || defined(USE_X86_SIMD)
   {
     const std::function<float(const float &, const float &)> fn =
       [](const float &a, const float &b) -> float { return a / b; };
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_TRANSPOSE_H__
+#define __NNFW_CKER_OPTIMIZED_TRANSPOSE_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/neon/neon_check.h"
+#include "cker/x86/Transpose.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+/**
+ * @brief Transpose with the fewest axes
+ *
+ * Axes of size 1 are removed, and output axes which are also adjacent in the input are merged.
+ * e.g. NHWC to NCHW becomes [N, HW, C] with perm {0, 2, 1}, and 0213 of [A, B, C, D] becomes
+ * [A, B, C, D] with perm {0, 2, 1, 3}.
+ */
+struct TransposeLayout
+{
+  int rank = 0;
+  int perm[4];
+  // Output dims, and strides of input and output along each output axis
+  int dims[4];
+  int input_strides[4];
+  int output_strides[4];
+};
+
+inline TransposeLayout MakeTransposeLayout(const TransposeParams &params, const Shape &input_shape)
+{
+  const int rank = input_shape.DimensionsCount();
+  assert(rank <= 4);
+  assert(params.perm_count == rank);
+
+  // Drop axes of size 1 and renumber the others
+  int new_axis[4];
+  int input_dims[4];
+  int kept = 0;
+  for (int i = 0; i < rank; ++i)
+  {
+    new_axis[i] = input_shape.Dims(i) == 1 ? -1 : kept;
+    if (input_shape.Dims(i) != 1)
+      input_dims[kept++] = input_shape.Dims(i);
+  }
+
+  // Merge runs of output axes which are consecutive input axes
+  int first_axis[4];
+  int last_axis[4];
+  int group_dims[4];
+  int groups = 0;
+  for (int i = 0; i < rank; ++i)
+  {
+    const int axis = new_axis[params.perm[i]];
+    if (axis < 0)
+      continue;
+    if (groups > 0 && axis == last_axis[groups - 1] + 1)
+    {
+      last_axis[groups - 1] = axis;
+      group_dims[groups - 1] *= input_dims[axis];
+    }
+    else
+    {
+      first_axis[groups] = last_axis[groups] = axis;
+      group_dims[groups] = input_dims[axis];
+      ++groups;
+    }
+  }
+
+  TransposeLayout layout;
+  layout.rank = groups;
+  int merged_input_dims[4];
+  for (int i = 0; i < groups; ++i)
+  {
+    int merged_axis = 0;
+    for (int j = 0; j < groups; ++j)
+      merged_axis += first_axis[j] < first_axis[i] ? 1 : 0;
+    layout.perm[i] = merged_axis;
+    layout.dims[i] = group_dims[i];
+    merged_input_dims[merged_axis] = group_dims[i];
+  }
+
+  int merged_input_strides[4];
+  int stride = 1;
+  for (int i = groups - 1; i >= 0; --i)
+  {
+    merged_input_strides[i] = stride;
+    stride *= merged_input_dims[i];
+  }
+  stride = 1;
+  for (int i = groups - 1; i >= 0; --i)
+  {
+    layout.input_strides[i] = merged_input_strides[layout.perm[i]];
+    layout.output_strides[i] = stride;
+    stride *= layout.dims[i];
+  }
+  return layout;
+}
+
+// Transpose a 8x8 tile, output[c * output_stride + r] = input[r * input_stride + c]
+template <typename T>
+inline void TransposeTile(const T *input, int input_stride, T *output, int output_stride)
+{
+  for (int r = 0; r < 8; ++r)
+    for (int c = 0; c < 8; ++c)
+      output[c * output_stride + r] = input[r * input_stride + c];
+}
+
+#ifdef USE_NEON
+inline void TransposeTile4x4(const int32_t *input, int input_stride, int32_t *output,
+                             int output_stride)
+{
+  const int32x4_t r0 = vld1q_s32(input);
+  const int32x4_t r1 = vld1q_s32(input + input_stride);
+  const int32x4_t r2 = vld1q_s32(input + 2 * input_stride);
+  const int32x4_t r3 = vld1q_s32(input + 3 * input_stride);
+  const int32x4x2_t t01 = vtrnq_s32(r0, r1);
+  const int32x4x2_t t23 = vtrnq_s32(r2, r3);
+  vst1q_s32(output, vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0])));
+  vst1q_s32(output + output_stride,
+            vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1])));
+  vst1q_s32(output + 2 * output_stride,
+            vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0])));
+  vst1q_s32(output + 3 * output_stride,
+            vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1])));
+}
+
+inline void TransposeTile(const int32_t *input, int input_stride, int32_t *output,
+                          int output_stride)
+{
+  for (int r = 0; r < 8; r += 4)
+    for (int c = 0; c < 8; c += 4)
+      TransposeTile4x4(input + r * input_stride + c, input_stride, output + c * output_stride + r,
+                       output_stride);
+}
+#endif // USE_NEON
+
+/**
+ * @brief Transpose a rows x cols block, output[c * output_stride + r] = input[r * input_stride + c]
+ *
+ * The block is walked in 16x16 sub-blocks of 8x8 tiles, which keep the lines they touch in L1
+ * even if strides are powers of 2.
+ */
+template <typename T>
+void TransposeBlock(int rows, int cols, const T *input, int input_stride, T *output,
+                    int output_stride)
+{
+#ifdef USE_X86_SIMD
+  if (std::is_same<T, int32_t>::value && GetX86SimdLevel() != X86SimdLevel::kNone)
+  {
+    x86::TransposeBlock(rows, cols, reinterpret_cast<const int32_t *>(input), input_stride,
+                        reinterpret_cast<int32_t *>(output), output_stride);
+    return;
+  }
+#endif // USE_X86_SIMD
+
+  constexpr int kBlock = 16;
+  constexpr int kTile = 8;
+  for (int rb = 0; rb < rows; rb += kBlock)
+  {
+    const int rb_end = std::min(rb + kBlock, rows);
+    for (int cb = 0; cb < cols; cb += kBlock)
+    {
+      const int cb_end = std::min(cb + kBlock, cols);
+      int r = rb;
+      for (; r <= rb_end - kTile; r += kTile)
+      {
+        int c = cb;
+        for (; c <= cb_end - kTile; c += kTile)
+          TransposeTile(input + r * input_stride + c, input_stride, output + c * output_stride + r,
+                        output_stride);
+        for (; c < cb_end; ++c)
+          for (int i = r; i < r + kTile; ++i)
+            output[c * output_stride + i] = input[i * input_stride + c];
+      }
+      for (; r < rb_end; ++r)
+        for (int c = cb; c < cb_end; ++c)
+          output[c * output_stride + r] = input[r * input_stride + c];
+    }
+  }
+}
+
+/**
+ * @brief Transpose units [start, end) of a layout whose rank is 2 or more
+ *
+ * A unit is a row along the innermost input axis. If the axis stays innermost in the output
+ * (e.g. 0213), the row is copied as a whole. Otherwise consecutive rows are transposed together by
+ * TransposeBlock. The other axes are outer loops.
+ */
+template <typename T>
+void TransposeUnits(const TransposeLayout &layout, const T *input_data, T *output_data, int start,
+                    int end)
+{
+  const int last = layout.rank - 1;
+  // Output axis of the innermost input axis
+  int inner = 0;
+  while (layout.perm[inner] != last)
+    ++inner;
+
+  int outer_axes[4];
+  int outer_count = 0;
+  for (int i = 0; i < last; ++i)
+  {
+    if (i != inner)
+      outer_axes[outer_count++] = i;
+  }
+
+  auto outer_offsets = [&](int index, int *input_offset, int *output_offset) {
+    *input_offset = 0;
+    *output_offset = 0;
+    for (int k = outer_count - 1; k >= 0; --k)
+    {
+      const int axis = outer_axes[k];
+      const int i = index % layout.dims[axis];
+      index /= layout.dims[axis];
+      *input_offset += i * layout.input_strides[axis];
+      *output_offset += i * layout.output_strides[axis];
+    }
+  };
+
+  if (inner == last)
+  {
+    const int row_size = layout.dims[last];
+    for (int unit = start; unit < end; ++unit)
+    {
+      int input_offset, output_offset;
+      outer_offsets(unit, &input_offset, &output_offset);
+      std::memcpy(output_data + output_offset, input_data + input_offset, row_size * sizeof(T));
+    }
+    return;
+  }
+
+  const int rows = layout.dims[last];
+  for (int unit = start; unit < end;)
+  {
+    const int row_start = unit % rows;
+    const int row_end = std::min(rows, row_start + (end - unit));
+    int input_offset, output_offset;
+    outer_offsets(unit / rows, &input_offset, &output_offset);
+    TransposeBlock(row_end - row_start, layout.dims[inner],
+                   input_data + input_offset + row_start * layout.input_strides[last],
+                   layout.input_strides[last], output_data + output_offset + row_start,
+                   layout.output_strides[inner]);
+    unit += row_end - row_start;
+  }
+}
+
+/**
+ * @brief Cache tiled transpose, split over the thread pool of ruy_context if it is given
+ *
+ * T should be one of int8_t, int16_t, int32_t and int64_t, since values are only moved.
+ */
+template <typename T>
+void TransposeTiled(const TransposeParams &params, const Shape &input_shape, const T *input_data,
+                    T *output_data, ruy::Context *ruy_context)
+{
+  const int flat_size = input_shape.FlatSize();
+  if (flat_size == 0)
+    return;
+
+  const TransposeLayout layout = MakeTransposeLayout(params, input_shape);
+  if (layout.rank <= 1)
+  {
+    std::memcpy(output_data, input_data, flat_size * sizeof(T));
+    return;
+  }
+
+  // A unit is a row along the innermost input axis
+  const int last = layout.rank - 1;
+  int inner = 0;
+  while (layout.perm[inner] != last)
+    ++inner;
+  const int units = flat_size / layout.dims[inner];
+
+  // Small transposes are not worth waking up threads
+  constexpr int kMinElementsPerTask = 16384;
+  cpu_backend_threadpool::ExecuteRanges(
+    units, layout.dims[inner], kMinElementsPerTask,
+    [&](int start, int end) { TransposeUnits(layout, input_data, output_data, start, end); },
+    ruy_context);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_TRANSPOSE_H__
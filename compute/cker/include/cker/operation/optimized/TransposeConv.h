@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
+#include <ruy/ruy.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Transpose OHWI filter into HWOI, so that GEMM writes contributions of each filter tap
+// to all output channels contiguously
+template <typename T>
+inline void TransposeConvFilterToHWOI(const Shape &filter_shape, const T *filter_data,
+                                      T *hwoi_data)
+{
+  const int output_depth = filter_shape.Dims(0);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int input_depth = filter_shape.Dims(3);
+  for (int oc = 0; oc < output_depth; ++oc)
+    for (int fy = 0; fy < filter_height; ++fy)
+      for (int fx = 0; fx < filter_width; ++fx)
+      {
+        const T *src = filter_data + Offset(filter_shape, oc, fy, fx, 0);
+        T *dst = hwoi_data + ((fy * filter_width + fx) * output_depth + oc) * input_depth;
+        std::copy(src, src + input_depth, dst);
+      }
+}
+
+/**
+ * @brief GEMM part of TransposeConv for one batch
+ *
+ * col[in_y * in_w + in_x][(fy * filter_w + fx) * out_c + oc] = sum_ic input * filter
+ */
+inline void TransposeConvGemm(int input_pixels, int input_depth, int col_cols,
+                              const float *input_data, const float *hwoi_filter_data,
+                              bool filter_cacheable, float *col_data, ruy::Context *ruy_context)
+{
+  MatrixParams<float> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = input_pixels;
+  lhs_params.cols = input_depth;
+  MatrixParams<float> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = input_depth;
+  rhs_params.cols = col_cols;
+  rhs_params.cache_policy =
+    filter_cacheable ? CachePolicy::kAlwaysCache : CachePolicy::kNeverCache;
+
+  ruy::Matrix<float> lhs;
+  ruy::Matrix<float> rhs;
+  ruy::Matrix<float> dst;
+  ruy_support::MakeRuyMatrix(lhs_params, input_data, &lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, hwoi_filter_data, &rhs, filter_cacheable);
+  ruy::MakeSimpleLayout(input_pixels, col_cols, ruy::Order::kRowMajor, dst.mutable_layout());
+  dst.set_data(col_data);
+
+  ruy::MulParams<float, float> mul_params;
+  ruy::Mul(lhs, rhs, mul_params, ruy_context, &dst);
+}
+
+// Quantized GEMM keeps raw int32 accumulators, zero points are handled by ruy
+template <typename T>
+inline void TransposeConvGemm(int input_pixels, int input_depth, int col_cols,
+                              const T *input_data, T input_zero_point, const T *hwoi_filter_data,
+                              T filter_zero_point, bool filter_cacheable, int32_t *col_data,
+                              ruy::Context *ruy_context)
+{
+  MatrixParams<T> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = input_pixels;
+  lhs_params.cols = input_depth;
+  lhs_params.zero_point = input_zero_point;
+  MatrixParams<T> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = input_depth;
+  rhs_params.cols = col_cols;
+  rhs_params.zero_point = filter_zero_point;
+  rhs_params.cache_policy =
+    filter_cacheable ? CachePolicy::kAlwaysCache : CachePolicy::kNeverCache;
+
+  ruy::Matrix<T> lhs;
+  ruy::Matrix<T> rhs;
+  ruy::Matrix<int32_t> dst;
+  ruy_support::MakeRuyMatrix(lhs_params, input_data, &lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, hwoi_filter_data, &rhs, filter_cacheable);
+  ruy::MakeSimpleLayout(input_pixels, col_cols, ruy::Order::kRowMajor, dst.mutable_layout());
+  dst.set_data(col_data);
+
+  ruy::MulParams<int32_t, int32_t> mul_params;
+  ruy::Mul(lhs, rhs, mul_params, ruy_context, &dst);
+}
+
+/**
+ * @brief col2im part of TransposeConv for output rows [row_start, row_end) of one batch
+ *
+ * Each output element gathers the columns of input pixels and filter taps that reach it,
+ * so tasks on disjoint rows never write to the same element.
+ * OutputFn(acc, oc) converts an accumulator into an output value.
+ */
+template <typename AccT, typename OutT, typename OutputFn>
+void TransposeConvCol2Im(const TransposeConvParams &params, const Shape &input_shape,
+                         const Shape &filter_shape, const Shape &output_shape,
+                         const AccT *col_data, OutT *output_data, int row_start, int row_end,
+                         const OutputFn &output_fn)
+{
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  const int stride_height = params.stride_height;
+  const int stride_width = params.stride_width;
+  const int pad_height = params.padding_values.height;
+  const int pad_width = params.padding_values.width;
+  const int col_cols = filter_height * filter_width * output_depth;
+
+  std::vector<AccT> acc(output_depth);
+  for (int out_y = row_start; out_y < row_end; ++out_y)
+  {
+    for (int out_x = 0; out_x < output_width; ++out_x)
+    {
+      std::fill(acc.begin(), acc.end(), 0);
+      for (int fy = 0; fy < filter_height; ++fy)
+      {
+        const int y = out_y + pad_height - fy;
+        if (y < 0 || y % stride_height != 0 || y / stride_height >= input_height)
+          continue;
+        const int in_y = y / stride_height;
+        for (int fx = 0; fx < filter_width; ++fx)
+        {
+          const int x = out_x + pad_width - fx;
+          if (x < 0 || x % stride_width != 0 || x / stride_width >= input_width)
+            continue;
+          const int in_x = x / stride_width;
+          const AccT *col = col_data + (in_y * input_width + in_x) * col_cols +
+                            (fy * filter_width + fx) * output_depth;
+          for (int oc = 0; oc < output_depth; ++oc)
+            acc[oc] += col[oc];
+        }
+      }
+      OutT *out = output_data + (out_y * output_width + out_x) * output_depth;
+      for (int oc = 0; oc < output_depth; ++oc)
+        out[oc] = output_fn(acc[oc], oc);
+    }
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_ACTIVATION_H__
+#define __NNFW_CKER_X86_ACTIVATION_H__
+
+#include "cker/x86/Utils.h"
+
+#ifdef USE_X86_SIMD
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+template <typename Op>
+CKER_X86_TARGET_AVX2 void MapElementwiseAvx2(int size, const float *input_data, float *output_data)
+{
+  MapElementwise<Avx2, Op>(size, input_data, output_data);
+}
+
+template <typename Op>
+CKER_X86_TARGET_AVX512 void MapElementwiseAvx512(int size, const float *input_data,
+                                                 float *output_data)
+{
+  MapElementwise<Avx512, Op>(size, input_data, output_data);
+}
+
+// Caller should check GetX86SimdLevel() is not kNone
+template <typename Op> void ApplyElementwise(int size, const float *input_data, float *output_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    MapElementwiseAvx512<Op>(size, input_data, output_data);
+  else
+    MapElementwiseAvx2<Op>(size, input_data, output_data);
+}
+
+inline void Logistic(int size, const float *input_data, float *output_data)
+{
+  ApplyElementwise<LogisticOp>(size, input_data, output_data);
+}
+
+inline void Tanh(int size, const float *input_data, float *output_data)
+{
+  ApplyElementwise<TanhOp>(size, input_data, output_data);
+}
+
+inline void Erf(int size, const float *input_data, float *output_data)
+{
+  ApplyElementwise<ErfOp>(size, input_data, output_data);
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_ACTIVATION_H__
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_BINARY_ARITHMETIC_OPS_H__
+#define __NNFW_CKER_X86_BINARY_ARITHMETIC_OPS_H__
+
+#include "cker/Types.h"
+#include "cker/x86/Utils.h"
+
+#ifdef USE_X86_SIMD
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+// OPERATOR and ACTIVATION are the functors of optimized binary ops, which provide templated
+// calculate, applyFloor and applyCeiling for vector types under USE_X86_SIMD
+template <typename VT, class OPERATOR, class ACTIVATION>
+CKER_X86_INLINE void BinaryOpElementwiseImpl(int size, const BinaryArithmeticOpParam &params,
+                                             const float *input1_data, const float *input2_data,
+                                             float *output_data)
+{
+  using Float = typename VT::Float;
+  const Float activation_min = Float{} + params.float_activation_min;
+  const Float activation_max = Float{} + params.float_activation_max;
+  int i = 0;
+  for (; i <= size - 2 * VT::kSize; i += 2 * VT::kSize)
+  {
+    Float a10, a11, a20, a21, x0, x1;
+    Load(input1_data + i, &a10);
+    Load(input1_data + i + VT::kSize, &a11);
+    Load(input2_data + i, &a20);
+    Load(input2_data + i + VT::kSize, &a21);
+    OPERATOR::calculate(a10, a20, &x0);
+    OPERATOR::calculate(a11, a21, &x1);
+    ACTIVATION::applyFloor(x0, activation_min, &x0);
+    ACTIVATION::applyFloor(x1, activation_min, &x1);
+    ACTIVATION::applyCeiling(x0, activation_max, &x0);
+    ACTIVATION::applyCeiling(x1, activation_max, &x1);
+    Store(output_data + i, x0);
+    Store(output_data + i + VT::kSize, x1);
+  }
+  for (; i < size; i += VT::kSize)
+  {
+    // Unused lanes of the last vector are filled with 1 not to divide by zero
+    const int n = size - i < VT::kSize ? size - i : VT::kSize;
+    Float a1, a2, x;
+    LoadPartial(input1_data + i, n, 1.f, &a1);
+    LoadPartial(input2_data + i, n, 1.f, &a2);
+    OPERATOR::calculate(a1, a2, &x);
+    ACTIVATION::applyFloor(x, activation_min, &x);
+    ACTIVATION::applyCeiling(x, activation_max, &x);
+    StorePartial(output_data + i, n, x);
+  }
+}
+
+template <typename VT, class OPERATOR, class ACTIVATION>
+CKER_X86_INLINE void BinaryOpScalarBroadcastImpl(int size, const BinaryArithmeticOpParam &params,
+                                                 const float broadcast_value,
+                                                 const float *input2_data, float *output_data)
+{
+  using Float = typename VT::Float;
+  const Float activation_min = Float{} + params.float_activation_min;
+  const Float activation_max = Float{} + params.float_activation_max;
+  const Float broadcast_value_dup = Float{} + broadcast_value;
+  int i = 0;
+  for (; i <= size - 2 * VT::kSize; i += 2 * VT::kSize)
+  {
+    Float a20, a21, x0, x1;
+    Load(input2_data + i, &a20);
+    Load(input2_data + i + VT::kSize, &a21);
+    OPERATOR::calculate(broadcast_value_dup, a20, &x0);
+    OPERATOR::calculate(broadcast_value_dup, a21, &x1);
+    ACTIVATION::applyFloor(x0, activation_min, &x0);
+    ACTIVATION::applyFloor(x1, activation_min, &x1);
+    ACTIVATION::applyCeiling(x0, activation_max, &x0);
+    ACTIVATION::applyCeiling(x1, activation_max, &x1);
+    Store(output_data + i, x0);
+    Store(output_data + i + VT::kSize, x1);
+  }
+  for (; i < size; i += VT::kSize)
+  {
+    const int n = size - i < VT::kSize ? size - i : VT::kSize;
+    Float a2, x;
+    LoadPartial(input2_data + i, n, 1.f, &a2);
+    OPERATOR::calculate(broadcast_value_dup, a2, &x);
+    ACTIVATION::applyFloor(x, activation_min, &x);
+    ACTIVATION::applyCeiling(x, activation_max, &x);
+    StorePartial(output_data + i, n, x);
+  }
+}
+
+template <class OPERATOR, class ACTIVATION>
+CKER_X86_TARGET_AVX2 void BinaryOpElementwiseAvx2(int size, const BinaryArithmeticOpParam &params,
+                                                  const float *input1_data,
+                                                  const float *input2_data, float *output_data)
+{
+  BinaryOpElementwiseImpl<Avx2, OPERATOR, ACTIVATION>(size, params, input1_data, input2_data,
+                                                      output_data);
+}
+
+template <class OPERATOR, class ACTIVATION>
+CKER_X86_TARGET_AVX512 void BinaryOpElementwiseAvx512(int size,
+                                                      const BinaryArithmeticOpParam &params,
+                                                      const float *input1_data,
+                                                      const float *input2_data, float *output_data)
+{
+  BinaryOpElementwiseImpl<Avx512, OPERATOR, ACTIVATION>(size, params, input1_data, input2_data,
+                                                        output_data);
+}
+
+template <class OPERATOR, class ACTIVATION>
+CKER_X86_TARGET_AVX2 void
+BinaryOpScalarBroadcastAvx2(int size, const BinaryArithmeticOpParam &params,
+                            const float broadcast_value, const float *input2_data,
+                            float *output_data)
+{
+  BinaryOpScalarBroadcastImpl<Avx2, OPERATOR, ACTIVATION>(size, params, broadcast_value,
+                                                          input2_data, output_data);
+}
+
+template <class OPERATOR, class ACTIVATION>
+CKER_X86_TARGET_AVX512 void
+BinaryOpScalarBroadcastAvx512(int size, const BinaryArithmeticOpParam &params,
+                              const float broadcast_value, const float *input2_data,
+                              float *output_data)
+{
+  BinaryOpScalarBroadcastImpl<Avx512, OPERATOR, ACTIVATION>(size, params, broadcast_value,
+                                                            input2_data, output_data);
+}
+
+// Caller should check GetX86SimdLevel() is not kNone
+template <class OPERATOR, class ACTIVATION>
+void BinaryOpElementwise(int size, const BinaryArithmeticOpParam &params,
+                         const float *input1_data, const float *input2_data, float *output_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    BinaryOpElementwiseAvx512<OPERATOR, ACTIVATION>(size, params, input1_data, input2_data,
+                                                    output_data);
+  else
+    BinaryOpElementwiseAvx2<OPERATOR, ACTIVATION>(size, params, input1_data, input2_data,
+                                                  output_data);
+}
+
+template <class OPERATOR, class ACTIVATION>
+void BinaryOpScalarBroadcast(int size, const BinaryArithmeticOpParam &params,
+                             const float broadcast_value, const float *input2_data,
+                             float *output_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    BinaryOpScalarBroadcastAvx512<OPERATOR, ACTIVATION>(size, params, broadcast_value,
+                                                        input2_data, output_data);
+  else
+    BinaryOpScalarBroadcastAvx2<OPERATOR, ACTIVATION>(size, params, broadcast_value, input2_data,
+                                                      output_data);
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_BINARY_ARITHMETIC_OPS_H__
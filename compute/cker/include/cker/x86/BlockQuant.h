@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_BLOCK_QUANT_H__
+#define __NNFW_CKER_X86_BLOCK_QUANT_H__
+
+#include "cker/BlockQuant.h"
+#include "cker/x86/Utils.h"
+
+#ifdef USE_X86_SIMD
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+// Lane l gets byte l of ptr in its highest byte, so bytes are widened by shifts. GCC lowers
+// __builtin_convertvector of loaded bytes lane by lane, which is much slower.
+template <typename VT> CKER_X86_INLINE void LoadBytesHigh(const void *ptr, typename VT::Int32 *v)
+{
+  using Int32 = typename VT::Int32;
+  int32_t words[VT::kSize / 4];
+  __builtin_memcpy(words, ptr, sizeof(words));
+  Int32 shift;
+  for (int l = 0; l < VT::kSize; ++l)
+  {
+    (*v)[l] = words[l / 4];
+    shift[l] = 24 - 8 * (l % 4);
+  }
+  *v = *v << shift;
+}
+
+// Dequantize a block into registers
+template <typename VT>
+CKER_X86_INLINE void DequantizeBlockImpl(const BlockQ4_0 &block,
+                                         typename VT::Float (&output)[kBlockQuantSize / VT::kSize])
+{
+  using Float = typename VT::Float;
+  using Int32 = typename VT::Int32;
+  constexpr int kHalf = kBlockQuantSize / 2;
+  const float scale = Fp16ToFloat(block.scale);
+  for (int i = 0; i < kHalf; i += VT::kSize)
+  {
+    Int32 v;
+    LoadBytesHigh<VT>(block.quants + i, &v);
+    const Int32 lo = ((v >> 24) & 0xf) - 8;
+    const Int32 hi = ((v >> 28) & 0xf) - 8;
+    output[i / VT::kSize] = __builtin_convertvector(lo, Float) * scale;
+    output[(kHalf + i) / VT::kSize] = __builtin_convertvector(hi, Float) * scale;
+  }
+}
+
+template <typename VT>
+CKER_X86_INLINE void DequantizeBlockImpl(const BlockQ8_0 &block,
+                                         typename VT::Float (&output)[kBlockQuantSize / VT::kSize])
+{
+  using Float = typename VT::Float;
+  using Int32 = typename VT::Int32;
+  const float scale = Fp16ToFloat(block.scale);
+  for (int i = 0; i < kBlockQuantSize; i += VT::kSize)
+  {
+    Int32 v;
+    LoadBytesHigh<VT>(block.quants + i, &v);
+    // Arithmetic shift extends the sign of int8
+    output[i / VT::kSize] = __builtin_convertvector(v >> 24, Float) * scale;
+  }
+}
+
+template <typename VT, typename Block>
+CKER_X86_INLINE void DequantizeBlocksImpl(const Block *blocks, int count, float *output_data)
+{
+  using Float = typename VT::Float;
+  constexpr int kVectors = kBlockQuantSize / VT::kSize;
+  for (int b = 0; b < count; ++b)
+  {
+    Float w[kVectors];
+    DequantizeBlockImpl<VT>(blocks[b], w);
+    for (int v = 0; v < kVectors; ++v)
+      Store(output_data + b * kBlockQuantSize + v * VT::kSize, w[v]);
+  }
+}
+
+// dot(blocks, input_data), blocks are dequantized in registers and never written back as floats
+template <typename VT, typename Block>
+CKER_X86_INLINE float DotBlocksImpl(const Block *blocks, int count, const float *input_data)
+{
+  using Float = typename VT::Float;
+  constexpr int kVectors = kBlockQuantSize / VT::kSize;
+  // Two accumulators to hide latency of adds
+  Float acc0 = Float{};
+  Float acc1 = Float{};
+  for (int b = 0; b < count; ++b)
+  {
+    Float w[kVectors];
+    DequantizeBlockImpl<VT>(blocks[b], w);
+    const float *in = input_data + b * kBlockQuantSize;
+    for (int v = 0; v < kVectors; v += 2)
+    {
+      Float x0, x1;
+      Load(in + v * VT::kSize, &x0);
+      Load(in + (v + 1) * VT::kSize, &x1);
+      acc0 += w[v] * x0;
+      acc1 += w[v + 1] * x1;
+    }
+  }
+  return ReduceSum<VT>(Float(acc0 + acc1));
+}
+
+// output_data[r * output_stride] = dot(row, input_data + r * depth), depth is a multiple of 32
+template <typename VT>
+CKER_X86_INLINE void DotRowsImpl(const float *row, int depth, const float *input_data, int rows,
+                                 float *output_data, int output_stride)
+{
+  using Float = typename VT::Float;
+  for (int r = 0; r < rows; ++r)
+  {
+    const float *in = input_data + r * depth;
+    Float acc0 = Float{};
+    Float acc1 = Float{};
+    for (int c = 0; c < depth; c += 2 * VT::kSize)
+    {
+      Float w0, w1, x0, x1;
+      Load(row + c, &w0);
+      Load(row + c + VT::kSize, &w1);
+      Load(in + c, &x0);
+      Load(in + c + VT::kSize, &x1);
+      acc0 += w0 * x0;
+      acc1 += w1 * x1;
+    }
+    output_data[r * output_stride] = ReduceSum<VT>(Float(acc0 + acc1));
+  }
+}
+
+template <typename Block>
+CKER_X86_TARGET_AVX2 void DequantizeBlocksAvx2(const Block *blocks, int count, float *output_data)
+{
+  DequantizeBlocksImpl<Avx2>(blocks, count, output_data);
+}
+
+template <typename Block>
+CKER_X86_TARGET_AVX512 void DequantizeBlocksAvx512(const Block *blocks, int count,
+                                                   float *output_data)
+{
+  DequantizeBlocksImpl<Avx512>(blocks, count, output_data);
+}
+
+template <typename Block>
+CKER_X86_TARGET_AVX2 float DotBlocksAvx2(const Block *blocks, int count, const float *input_data)
+{
+  return DotBlocksImpl<Avx2>(blocks, count, input_data);
+}
+
+template <typename Block>
+CKER_X86_TARGET_AVX512 float DotBlocksAvx512(const Block *blocks, int count,
+                                             const float *input_data)
+{
+  return DotBlocksImpl<Avx512>(blocks, count, input_data);
+}
+
+CKER_X86_TARGET_AVX2 inline void DotRowsAvx2(const float *row, int depth, const float *input_data,
+                                             int rows, float *output_data, int output_stride)
+{
+  DotRowsImpl<Avx2>(row, depth, input_data, rows, output_data, output_stride);
+}
+
+CKER_X86_TARGET_AVX512 inline void DotRowsAvx512(const float *row, int depth,
+                                                 const float *input_data, int rows,
+                                                 float *output_data, int output_stride)
+{
+  DotRowsImpl<Avx512>(row, depth, input_data, rows, output_data, output_stride);
+}
+
+// Caller should check GetX86SimdLevel() is not kNone, Block is BlockQ4_0 or BlockQ8_0
+template <typename Block>
+void DequantizeBlocks(const Block *blocks, int count, float *output_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    DequantizeBlocksAvx512(blocks, count, output_data);
+  else
+    DequantizeBlocksAvx2(blocks, count, output_data);
+}
+
+template <typename Block> float DotBlocks(const Block *blocks, int count, const float *input_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    return DotBlocksAvx512(blocks, count, input_data);
+  return DotBlocksAvx2(blocks, count, input_data);
+}
+
+inline void DotRows(const float *row, int depth, const float *input_data, int rows,
+                    float *output_data, int output_stride)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    DotRowsAvx512(row, depth, input_data, rows, output_data, output_stride);
+  else
+    DotRowsAvx2(row, depth, input_data, rows, output_data, output_stride);
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_BLOCK_QUANT_H__
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_QUANTIZE_H__
+#define __NNFW_CKER_X86_QUANTIZE_H__
+
+#include "cker/x86/Utils.h"
+
+#ifdef USE_X86_SIMD
+
+#include <limits>
+#include <type_traits>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+template <typename VT, typename T>
+using QuantizedVector =
+  typename std::conditional<std::is_same<T, int8_t>::value, typename VT::Int8,
+                            typename VT::Uint8>::type;
+
+// Same as static_cast<int32_t>(round(x / scale)) + zero_point clamped into the range of T
+template <typename VT, typename T>
+CKER_X86_INLINE void QuantizeImpl(int size, const float *input_data, float scale,
+                                  int32_t zero_point, T *output_data)
+{
+  using Float = typename VT::Float;
+  using Int32 = typename VT::Int32;
+  // Floats out of this range are integers already and overflow int32 after rounding
+  constexpr float kLimit = 1 << 30;
+  const Int32 min_val = Int32{} + std::numeric_limits<T>::min();
+  const Int32 max_val = Int32{} + std::numeric_limits<T>::max();
+
+  for (int i = 0; i < size; i += VT::kSize)
+  {
+    const int n = size - i < VT::kSize ? size - i : VT::kSize;
+    Float x;
+    if (n == VT::kSize)
+      Load(input_data + i, &x);
+    else
+      LoadPartial(input_data + i, n, 0.f, &x);
+    Float t = x / scale;
+    t = t < -kLimit ? Float{} - kLimit : t;
+    t = t > kLimit ? Float{} + kLimit : t;
+
+    // Round half away from zero, comparisons give -1 for true lanes
+    Int32 q = __builtin_convertvector(t, Int32);
+    const Float frac = t - __builtin_convertvector(q, Float);
+    q = q - (frac >= 0.5f) + (frac <= -0.5f);
+
+    q += zero_point;
+    q = q < min_val ? min_val : q;
+    q = q > max_val ? max_val : q;
+    QuantizedVector<VT, T> y;
+    Narrow<VT>(q, &y);
+    if (n == VT::kSize)
+      Store(output_data + i, y);
+    else
+      StorePartial(output_data + i, n, y);
+  }
+}
+
+// Same as scale * (x - zero_point)
+template <typename VT, typename T>
+CKER_X86_INLINE void DequantizeImpl(int size, const T *input_data, float scale,
+                                    int32_t zero_point, float *output_data)
+{
+  using Int32 = typename VT::Int32;
+  using Float = typename VT::Float;
+  for (int i = 0; i < size; i += VT::kSize)
+  {
+    const int n = size - i < VT::kSize ? size - i : VT::kSize;
+    QuantizedVector<VT, T> x;
+    if (n == VT::kSize)
+      Load(input_data + i, &x);
+    else
+      LoadPartial(input_data + i, n, T{0}, &x);
+    const Int32 v = __builtin_convertvector(x, Int32) - zero_point;
+    const Float y = __builtin_convertvector(v, Float) * scale;
+    if (n == VT::kSize)
+      Store(output_data + i, y);
+    else
+      StorePartial(output_data + i, n, y);
+  }
+}
+
+template <typename T>
+CKER_X86_TARGET_AVX2 void QuantizeAvx2(int size, const float *input_data, float scale,
+                                       int32_t zero_point, T *output_data)
+{
+  QuantizeImpl<Avx2>(size, input_data, scale, zero_point, output_data);
+}
+
+template <typename T>
+CKER_X86_TARGET_AVX512 void QuantizeAvx512(int size, const float *input_data, float scale,
+                                           int32_t zero_point, T *output_data)
+{
+  QuantizeImpl<Avx512>(size, input_data, scale, zero_point, output_data);
+}
+
+template <typename T>
+CKER_X86_TARGET_AVX2 void DequantizeAvx2(int size, const T *input_data, float scale,
+                                         int32_t zero_point, float *output_data)
+{
+  DequantizeImpl<Avx2>(size, input_data, scale, zero_point, output_data);
+}
+
+template <typename T>
+CKER_X86_TARGET_AVX512 void DequantizeAvx512(int size, const T *input_data, float scale,
+                                             int32_t zero_point, float *output_data)
+{
+  DequantizeImpl<Avx512>(size, input_data, scale, zero_point, output_data);
+}
+
+// Caller should check GetX86SimdLevel() is not kNone, T is int8_t or uint8_t
+template <typename T>
+void Quantize(int size, const float *input_data, float scale, int32_t zero_point, T *output_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    QuantizeAvx512(size, input_data, scale, zero_point, output_data);
+  else
+    QuantizeAvx2(size, input_data, scale, zero_point, output_data);
+}
+
+template <typename T>
+void Dequantize(int size, const T *input_data, float scale, int32_t zero_point,
+                float *output_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    DequantizeAvx512(size, input_data, scale, zero_point, output_data);
+  else
+    DequantizeAvx2(size, input_data, scale, zero_point, output_data);
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_QUANTIZE_H__
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_REDUCE_H__
+#define __NNFW_CKER_X86_REDUCE_H__
+
+#include "cker/x86/Utils.h"
+
+#ifdef USE_X86_SIMD
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+// output[r] = sum of input[r * depth + c] over c
+template <typename VT>
+CKER_X86_INLINE void ReduceSumRowsImpl(const float *input_data, int rows, int depth,
+                                       float *output_data)
+{
+  using Float = typename VT::Float;
+  for (int r = 0; r < rows; ++r)
+  {
+    const float *in = input_data + r * depth;
+    Float sum0 = Float{};
+    Float sum1 = Float{};
+    int c = 0;
+    for (; c <= depth - 2 * VT::kSize; c += 2 * VT::kSize)
+    {
+      Float x0, x1;
+      Load(in + c, &x0);
+      Load(in + c + VT::kSize, &x1);
+      sum0 += x0;
+      sum1 += x1;
+    }
+    if (c <= depth - VT::kSize)
+    {
+      Float x;
+      Load(in + c, &x);
+      sum0 += x;
+      c += VT::kSize;
+    }
+    float result = ReduceSum<VT>(Float(sum0 + sum1));
+    for (; c < depth; ++c)
+      result += in[c];
+    output_data[r] = result;
+  }
+}
+
+// output[d] = sum of input[p * depth + d] over p, i.e. sum over all but the last dimension
+template <typename VT>
+CKER_X86_INLINE void ReduceSumColumnsImpl(const float *input_data, int rows, int depth,
+                                          float divisor, float *output_data)
+{
+  using Float = typename VT::Float;
+  int d = 0;
+  for (; d < depth; d += VT::kSize)
+  {
+    const int n = depth - d < VT::kSize ? depth - d : VT::kSize;
+    Float sum = Float{};
+    for (int r = 0; r < rows; ++r)
+    {
+      Float x;
+      if (n == VT::kSize)
+        Load(input_data + r * depth + d, &x);
+      else
+        LoadPartial(input_data + r * depth + d, n, 0.f, &x);
+      sum += x;
+    }
+    StorePartial(output_data + d, n, Float(sum / divisor));
+  }
+}
+
+CKER_X86_TARGET_AVX2 inline void ReduceSumRowsAvx2(const float *input_data, int rows, int depth,
+                                                   float *output_data)
+{
+  ReduceSumRowsImpl<Avx2>(input_data, rows, depth, output_data);
+}
+
+CKER_X86_TARGET_AVX512 inline void ReduceSumRowsAvx512(const float *input_data, int rows,
+                                                       int depth, float *output_data)
+{
+  ReduceSumRowsImpl<Avx512>(input_data, rows, depth, output_data);
+}
+
+CKER_X86_TARGET_AVX2 inline void ReduceSumColumnsAvx2(const float *input_data, int rows,
+                                                      int depth, float divisor, float *output_data)
+{
+  ReduceSumColumnsImpl<Avx2>(input_data, rows, depth, divisor, output_data);
+}
+
+CKER_X86_TARGET_AVX512 inline void ReduceSumColumnsAvx512(const float *input_data, int rows,
+                                                          int depth, float divisor,
+                                                          float *output_data)
+{
+  ReduceSumColumnsImpl<Avx512>(input_data, rows, depth, divisor, output_data);
+}
+
+// Caller should check GetX86SimdLevel() is not kNone
+inline void ReduceSumRows(const float *input_data, int rows, int depth, float *output_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    ReduceSumRowsAvx512(input_data, rows, depth, output_data);
+  else
+    ReduceSumRowsAvx2(input_data, rows, depth, output_data);
+}
+
+// Sums over rows are divided by divisor, e.g. rows for mean
+inline void ReduceSumColumns(const float *input_data, int rows, int depth, float divisor,
+                             float *output_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    ReduceSumColumnsAvx512(input_data, rows, depth, divisor, output_data);
+  else
+    ReduceSumColumnsAvx2(input_data, rows, depth, divisor, output_data);
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_REDUCE_H__
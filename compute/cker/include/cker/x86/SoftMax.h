@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_SOFTMAX_H__
+#define __NNFW_CKER_X86_SOFTMAX_H__
+
+#include "cker/x86/Utils.h"
+
+#ifdef USE_X86_SIMD
+
+#include <cmath>
+#include <limits>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+template <typename VT> CKER_X86_INLINE float RowMax(const float *row, int depth)
+{
+  using Float = typename VT::Float;
+  Float max = Float{} + std::numeric_limits<float>::lowest();
+  int c = 0;
+  for (; c <= depth - VT::kSize; c += VT::kSize)
+  {
+    Float x;
+    Load(row + c, &x);
+    max = x > max ? x : max;
+  }
+  float result = ReduceMax<VT>(max);
+  for (; c < depth; ++c)
+    result = row[c] > result ? row[c] : result;
+  return result;
+}
+
+// Returns the sum of exp((row[c] - max) * beta), which are also stored into out unless it is null
+template <typename VT>
+CKER_X86_INLINE float RowExpSum(const float *row, int depth, float max, float beta, float *out)
+{
+  using Float = typename VT::Float;
+  Float sum = Float{};
+  int c = 0;
+  for (; c <= depth - VT::kSize; c += VT::kSize)
+  {
+    Float x, e;
+    Load(row + c, &x);
+    Exp<VT>((x - max) * beta, &e);
+    if (out)
+      Store(out + c, e);
+    sum += e;
+  }
+  float result = ReduceSum<VT>(sum);
+  if (c < depth)
+  {
+    Float x, e;
+    LoadPartial(row + c, depth - c, max, &x);
+    Exp<VT>((x - max) * beta, &e);
+    float buf[VT::kSize];
+    Store(buf, e);
+    for (int i = 0; i < depth - c; ++i)
+      result += buf[i];
+    if (out)
+      StorePartial(out + c, depth - c, e);
+  }
+  return result;
+}
+
+// Rows longer than this do not stay in L1 between passes, so they are read twice instead of three
+// times by an online max and sum
+constexpr int kSoftmaxOnlineDepth = 8192;
+
+/**
+ * @brief Max of a row and the sum of exp((row[c] - max) * beta) in a single pass
+ *
+ * Each lane keeps its own running max and sum, and the sum is rescaled whenever the max grows.
+ * Lanes are merged at the end, and the tail is folded in the same way one by one.
+ */
+template <typename VT>
+CKER_X86_INLINE float RowMaxExpSum(const float *row, int depth, float beta, float *max)
+{
+  using Float = typename VT::Float;
+  Float lane_max = Float{} + std::numeric_limits<float>::lowest();
+  Float lane_sum = Float{};
+  int c = 0;
+  for (; c <= depth - VT::kSize; c += VT::kSize)
+  {
+    Float x, correction, e;
+    Load(row + c, &x);
+    const Float new_max = x > lane_max ? x : lane_max;
+    Exp<VT>((lane_max - new_max) * beta, &correction);
+    Exp<VT>((x - new_max) * beta, &e);
+    lane_sum = lane_sum * correction + e;
+    lane_max = new_max;
+  }
+
+  float result_max = ReduceMax<VT>(lane_max);
+  float result_sum = 0.f;
+  if (c > 0)
+  {
+    Float correction;
+    Exp<VT>((lane_max - result_max) * beta, &correction);
+    result_sum = ReduceSum<VT>(Float(lane_sum * correction));
+  }
+  for (; c < depth; ++c)
+  {
+    if (row[c] > result_max)
+    {
+      result_sum = result_sum * std::exp((result_max - row[c]) * beta) + 1.f;
+      result_max = row[c];
+    }
+    else
+    {
+      result_sum += std::exp((row[c] - result_max) * beta);
+    }
+  }
+  *max = result_max;
+  return result_sum;
+}
+
+// Stores exp((row[c] - max) * beta) * scale
+template <typename VT>
+CKER_X86_INLINE void RowScaledExp(const float *row, int depth, float max, float beta, float scale,
+                                  float *out)
+{
+  using Float = typename VT::Float;
+  int c = 0;
+  for (; c <= depth - VT::kSize; c += VT::kSize)
+  {
+    Float x, e;
+    Load(row + c, &x);
+    Exp<VT>((x - max) * beta, &e);
+    Store(out + c, Float(e * scale));
+  }
+  if (c < depth)
+  {
+    Float x, e;
+    LoadPartial(row + c, depth - c, max, &x);
+    Exp<VT>((x - max) * beta, &e);
+    StorePartial(out + c, depth - c, Float(e * scale));
+  }
+}
+
+// Softmax over rows of depth elements, which are the last dimension
+template <typename VT>
+CKER_X86_INLINE void SoftmaxRows(const float *input_data, int depth, int rows, float beta,
+                                 float *output_data)
+{
+  using Float = typename VT::Float;
+  for (int r = 0; r < rows; ++r)
+  {
+    const float *in = input_data + r * depth;
+    float *out = output_data + r * depth;
+    if (depth > kSoftmaxOnlineDepth)
+    {
+      float max;
+      const float sum = RowMaxExpSum<VT>(in, depth, beta, &max);
+      RowScaledExp<VT>(in, depth, max, beta, 1.f / sum, out);
+      continue;
+    }
+
+    const float max = RowMax<VT>(in, depth);
+    const float scale = 1.f / RowExpSum<VT>(in, depth, max, beta, out);
+    int c = 0;
+    for (; c <= depth - VT::kSize; c += VT::kSize)
+    {
+      Float e;
+      Load(out + c, &e);
+      Store(out + c, Float(e * scale));
+    }
+    for (; c < depth; ++c)
+      out[c] *= scale;
+  }
+}
+
+// LogSoftmax over rows, out = (in - max) * beta - log(sum(exp((in - max) * beta)))
+template <typename VT>
+CKER_X86_INLINE void LogSoftmaxRows(const float *input_data, int depth, int rows, float beta,
+                                    float *output_data)
+{
+  using Float = typename VT::Float;
+  for (int r = 0; r < rows; ++r)
+  {
+    const float *in = input_data + r * depth;
+    float *out = output_data + r * depth;
+    float max;
+    float sum;
+    if (depth > kSoftmaxOnlineDepth)
+    {
+      sum = RowMaxExpSum<VT>(in, depth, beta, &max);
+    }
+    else
+    {
+      max = RowMax<VT>(in, depth);
+      sum = RowExpSum<VT>(in, depth, max, beta, nullptr);
+    }
+    const float log_sum = std::log(sum);
+    int c = 0;
+    for (; c <= depth - VT::kSize; c += VT::kSize)
+    {
+      Float x;
+      Load(in + c, &x);
+      Store(out + c, Float((x - max) * beta - log_sum));
+    }
+    for (; c < depth; ++c)
+      out[c] = (in[c] - max) * beta - log_sum;
+  }
+}
+
+CKER_X86_TARGET_AVX2 inline void SoftmaxAvx2(const float *input_data, int depth, int rows,
+                                             float beta, float *output_data)
+{
+  SoftmaxRows<Avx2>(input_data, depth, rows, beta, output_data);
+}
+
+CKER_X86_TARGET_AVX512 inline void SoftmaxAvx512(const float *input_data, int depth, int rows,
+                                                 float beta, float *output_data)
+{
+  SoftmaxRows<Avx512>(input_data, depth, rows, beta, output_data);
+}
+
+CKER_X86_TARGET_AVX2 inline void LogSoftmaxAvx2(const float *input_data, int depth, int rows,
+                                                float beta, float *output_data)
+{
+  LogSoftmaxRows<Avx2>(input_data, depth, rows, beta, output_data);
+}
+
+CKER_X86_TARGET_AVX512 inline void LogSoftmaxAvx512(const float *input_data, int depth, int rows,
+                                                    float beta, float *output_data)
+{
+  LogSoftmaxRows<Avx512>(input_data, depth, rows, beta, output_data);
+}
+
+// Caller should check GetX86SimdLevel() is not kNone
+inline void Softmax(const float *input_data, int depth, int rows, float beta, float *output_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    SoftmaxAvx512(input_data, depth, rows, beta, output_data);
+  else
+    SoftmaxAvx2(input_data, depth, rows, beta, output_data);
+}
+
+inline void LogSoftmax(const float *input_data, int depth, int rows, float beta,
+                       float *output_data)
+{
+  if (GetX86SimdLevel() == X86SimdLevel::kAvx512)
+    LogSoftmaxAvx512(input_data, depth, rows, beta, output_data);
+  else
+    LogSoftmaxAvx2(input_data, depth, rows, beta, output_data);
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_SOFTMAX_H__
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_TRANSPOSE_H__
+#define __NNFW_CKER_X86_TRANSPOSE_H__
+
+#include "cker/x86/Utils.h"
+
+#ifdef USE_X86_SIMD
+
+#include <algorithm>
+#include <cassert>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+// Transpose a 8x8 tile of 32 bit values in registers by three stages of shuffles,
+// which are lowered into unpck, shufps and vperm2f128
+CKER_X86_INLINE void Transpose8x8(const int32_t *input, int input_stride, int32_t *output,
+                                  int output_stride)
+{
+  using Int32 = Avx2::Int32;
+  Int32 r[8];
+  for (int i = 0; i < 8; ++i)
+    Load(input + i * input_stride, &r[i]);
+
+  Int32 t[8];
+  for (int i = 0; i < 8; i += 2)
+  {
+    t[i] = CKER_X86_SHUFFLE(r[i], r[i + 1], 0, 8, 1, 9, 4, 12, 5, 13);
+    t[i + 1] = CKER_X86_SHUFFLE(r[i], r[i + 1], 2, 10, 3, 11, 6, 14, 7, 15);
+  }
+
+  Int32 u[8];
+  for (int i = 0; i < 8; i += 4)
+  {
+    u[i] = CKER_X86_SHUFFLE(t[i], t[i + 2], 0, 1, 8, 9, 4, 5, 12, 13);
+    u[i + 1] = CKER_X86_SHUFFLE(t[i], t[i + 2], 2, 3, 10, 11, 6, 7, 14, 15);
+    u[i + 2] = CKER_X86_SHUFFLE(t[i + 1], t[i + 3], 0, 1, 8, 9, 4, 5, 12, 13);
+    u[i + 3] = CKER_X86_SHUFFLE(t[i + 1], t[i + 3], 2, 3, 10, 11, 6, 7, 14, 15);
+  }
+
+  for (int i = 0; i < 4; ++i)
+  {
+    const Int32 lo = CKER_X86_SHUFFLE(u[i], u[i + 4], 0, 1, 2, 3, 8, 9, 10, 11);
+    const Int32 hi = CKER_X86_SHUFFLE(u[i], u[i + 4], 4, 5, 6, 7, 12, 13, 14, 15);
+    Store(output + i * output_stride, lo);
+    Store(output + (i + 4) * output_stride, hi);
+  }
+}
+
+/**
+ * @brief Transpose a rows x cols block of 32 bit values
+ *
+ * output[c * output_stride + r] = input[r * input_stride + c]
+ * The block is walked in 16x16 sub-blocks with 8x8 tiles in registers. Small sub-blocks keep
+ * the lines they touch in L1 even if strides are powers of 2.
+ * AVX-512 uses the same ymm tiles, since the transpose is bound by memory.
+ */
+CKER_X86_TARGET_AVX2 inline void TransposeBlockAvx2(int rows, int cols, const int32_t *input,
+                                                    int input_stride, int32_t *output,
+                                                    int output_stride)
+{
+  constexpr int kBlock = 16;
+  constexpr int kTile = 8;
+  for (int rb = 0; rb < rows; rb += kBlock)
+  {
+    const int rb_end = std::min(rb + kBlock, rows);
+    for (int cb = 0; cb < cols; cb += kBlock)
+    {
+      const int cb_end = std::min(cb + kBlock, cols);
+      int r = rb;
+      for (; r <= rb_end - kTile; r += kTile)
+      {
+        int c = cb;
+        for (; c <= cb_end - kTile; c += kTile)
+          Transpose8x8(input + r * input_stride + c, input_stride, output + c * output_stride + r,
+                       output_stride);
+        for (; c < cb_end; ++c)
+          for (int i = r; i < r + kTile; ++i)
+            output[c * output_stride + i] = input[i * input_stride + c];
+      }
+      for (; r < rb_end; ++r)
+        for (int c = cb; c < cb_end; ++c)
+          output[c * output_stride + r] = input[r * input_stride + c];
+    }
+  }
+}
+
+inline void TransposeBlock(int rows, int cols, const int32_t *input, int input_stride,
+                           int32_t *output, int output_stride)
+{
+  assert(GetX86SimdLevel() != X86SimdLevel::kNone);
+  TransposeBlockAvx2(rows, cols, input, input_stride, output, output_stride);
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_TRANSPOSE_H__
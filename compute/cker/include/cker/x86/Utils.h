@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_UTILS_H__
+#define __NNFW_CKER_X86_UTILS_H__
+
+#include "cker/x86/x86_check.h"
+
+#ifdef USE_X86_SIMD
+
+#include <cstdint>
+#include <limits>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+/**
+ * @brief Vector types of N lanes
+ *
+ * Kernels are written once with GCC vector extensions and instantiated with Avx2 or Avx512
+ * inside a function of the matching target, which lowers them into ymm or zmm instructions.
+ * Helpers take vectors by reference and return them through pointers, since passing wide
+ * vectors by value from a function of the default target changes the ABI.
+ */
+template <int N> struct VectorTypes
+{
+  static constexpr int kSize = N;
+  typedef float Float __attribute__((vector_size(N * sizeof(float))));
+  typedef int32_t Int32 __attribute__((vector_size(N * sizeof(int32_t))));
+  typedef int8_t Int8 __attribute__((vector_size(N * sizeof(int8_t))));
+  typedef uint8_t Uint8 __attribute__((vector_size(N * sizeof(uint8_t))));
+  // Bytes of Int32, to narrow Int32 by shuffling
+  typedef int8_t Int32Bytes __attribute__((vector_size(N * sizeof(int32_t))));
+};
+
+using Avx2 = VectorTypes<8>;
+using Avx512 = VectorTypes<16>;
+
+// Shuffle lanes of two vectors by constant indices, where lanes of b follow those of a.
+// Clang has only __builtin_shufflevector taking indices, and GCC before 12 has only
+// __builtin_shuffle taking a mask vector of the same lane size.
+#if defined(__clang__)
+#define CKER_X86_SHUFFLE(a, b, ...) __builtin_shufflevector(a, b, __VA_ARGS__)
+#else
+#define CKER_X86_SHUFFLE(a, b, ...) __builtin_shuffle(a, b, __typeof__(a){__VA_ARGS__})
+#endif
+
+template <typename V, typename T> CKER_X86_INLINE void Load(const T *ptr, V *v)
+{
+  __builtin_memcpy(v, ptr, sizeof(V));
+}
+
+template <typename V, typename T> CKER_X86_INLINE void Store(T *ptr, const V &v)
+{
+  __builtin_memcpy(ptr, &v, sizeof(V));
+}
+
+// Load first size elements and fill the other lanes with fill
+template <typename V, typename T>
+CKER_X86_INLINE void LoadPartial(const T *ptr, int size, T fill, V *v)
+{
+  T buf[sizeof(V) / sizeof(T)];
+  for (int i = 0; i < static_cast<int>(sizeof(V) / sizeof(T)); ++i)
+    buf[i] = i < size ? ptr[i] : fill;
+  __builtin_memcpy(v, buf, sizeof(V));
+}
+
+template <typename V, typename T> CKER_X86_INLINE void StorePartial(T *ptr, int size, const V &v)
+{
+  T buf[sizeof(V) / sizeof(T)];
+  __builtin_memcpy(buf, &v, sizeof(V));
+  for (int i = 0; i < size; ++i)
+    ptr[i] = buf[i];
+}
+
+// Narrow Int32 into 8 bit lanes of V, values should be in the range of V already
+template <typename VT, typename V> CKER_X86_INLINE void Narrow(const typename VT::Int32 &v, V *out)
+{
+  if constexpr (VT::kSize == 16)
+  {
+    // AVX-512 has instructions to narrow a whole vector
+    *out = __builtin_convertvector(v, V);
+  }
+  else
+  {
+    static_assert(VT::kSize == 8, "Narrow supports Avx2 and Avx512 only");
+    // Otherwise take the lowest byte of each lane by a shuffle, not to narrow lane by lane
+    using Bytes = typename VT::Int32Bytes;
+    const Bytes &bytes = reinterpret_cast<const Bytes &>(v);
+    const Bytes narrowed =
+      CKER_X86_SHUFFLE(bytes, bytes, 0, 4, 8, 12, 16, 20, 24, 28, 0, 4, 8, 12, 16, 20, 24, 28, 0,
+                       4, 8, 12, 16, 20, 24, 28, 0, 4, 8, 12, 16, 20, 24, 28);
+    __builtin_memcpy(out, &narrowed, sizeof(V));
+  }
+}
+
+template <typename VT> CKER_X86_INLINE float ReduceSum(const typename VT::Float &v)
+{
+  float sum = 0.f;
+  for (int i = 0; i < VT::kSize; ++i)
+    sum += v[i];
+  return sum;
+}
+
+template <typename VT> CKER_X86_INLINE float ReduceMax(const typename VT::Float &v)
+{
+  float max = v[0];
+  for (int i = 1; i < VT::kSize; ++i)
+    max = v[i] > max ? v[i] : max;
+  return max;
+}
+
+// exp(x) from Cephes expf, relative error is about 2 ulp
+template <typename VT> CKER_X86_INLINE void Exp(const typename VT::Float &x, typename VT::Float *y)
+{
+  using Float = typename VT::Float;
+  using Int32 = typename VT::Int32;
+  // exp(kExpLo) is the smallest normal float, exp(kExpHi) is the largest float
+  constexpr float kExpLo = -87.33654475f;
+  constexpr float kExpHi = 88.72283905f;
+
+  Float v = x < kExpLo ? Float{} + kExpLo : x;
+  v = v > kExpHi ? Float{} + kExpHi : v;
+
+  // n = floor(v / ln(2) + 0.5)
+  Float fx = v * 1.44269504088896341f + 0.5f;
+  Float floor_fx = __builtin_convertvector(__builtin_convertvector(fx, Int32), Float);
+  fx = floor_fx > fx ? floor_fx - 1.f : floor_fx;
+
+  // r = v - n * ln(2) in two steps to keep precision
+  Float r = v - fx * 0.693359375f;
+  r = r - fx * -2.12194440e-4f;
+
+  Float p = Float{} + 1.9875691500E-4f;
+  p = p * r + 1.3981999507E-3f;
+  p = p * r + 8.3334519073E-3f;
+  p = p * r + 4.1665795894E-2f;
+  p = p * r + 1.6666665459E-1f;
+  p = p * r + 5.0000001201E-1f;
+  p = p * r * r + r + 1.f;
+
+  // Multiply 2^n as 2^(n/2) * 2^(n - n/2), since 2^n alone may not be a normal float
+  const Int32 n = __builtin_convertvector(fx, Int32);
+  const Int32 n1 = n >> 1;
+  const Int32 n2 = n - n1;
+  const Int32 bits1 = (n1 + 127) << 23;
+  const Int32 bits2 = (n2 + 127) << 23;
+  Float result = p * (Float)bits1 * (Float)bits2;
+
+  result = x < kExpLo ? Float{} : result;
+  *y = x > kExpHi ? Float{} + std::numeric_limits<float>::infinity() : result;
+}
+
+// 1 / (1 + exp(-x))
+template <typename VT>
+CKER_X86_INLINE void Logistic(const typename VT::Float &x, typename VT::Float *y)
+{
+  using Float = typename VT::Float;
+  Float e;
+  Exp<VT>(-x, &e);
+  *y = 1.f / (e + 1.f);
+}
+
+// tanh(x) as a rational function of x, same as the fast tanh of Eigen
+template <typename VT> CKER_X86_INLINE void Tanh(const typename VT::Float &x, typename VT::Float *y)
+{
+  using Float = typename VT::Float;
+  // tanh(x) rounds to 1 beyond the clamp, and to x below tiny
+  constexpr float kClamp = 7.90531110763549805f;
+  constexpr float kTiny = 0.0004f;
+
+  Float v = x < -kClamp ? Float{} - kClamp : x;
+  v = v > kClamp ? Float{} + kClamp : v;
+  const Float z = v * v;
+
+  Float p = Float{} - 2.76076847742355e-16f;
+  p = p * z + 2.00018790482477e-13f;
+  p = p * z - 8.60467152213735e-11f;
+  p = p * z + 5.12229709037114e-08f;
+  p = p * z + 1.48572235717979e-05f;
+  p = p * z + 6.37261928875436e-04f;
+  p = p * z + 4.89352455891786e-03f;
+  p = p * v;
+
+  Float q = Float{} + 1.19825839466702e-06f;
+  q = q * z + 1.18534705686654e-04f;
+  q = q * z + 2.26843463243900e-03f;
+  q = q * z + 4.89352518554385e-03f;
+
+  const Float abs_x = x < 0.f ? -x : x;
+  *y = abs_x < kTiny ? x : p / q;
+}
+
+// erf(x) from Taylor series for small x, Abramowitz and Stegun 7.1.26 otherwise
+template <typename VT> CKER_X86_INLINE void Erf(const typename VT::Float &x, typename VT::Float *y)
+{
+  using Float = typename VT::Float;
+  const Float abs_x = x < 0.f ? -x : x;
+
+  const Float z = x * x;
+  Float small = Float{} + 1.2055293e-4f;
+  small = small * z - 8.5483253e-4f;
+  small = small * z + 5.2239776e-3f;
+  small = small * z - 2.6866171e-2f;
+  small = small * z + 1.1283792e-1f;
+  small = small * z - 3.7612639e-1f;
+  small = small * z + 1.1283792f;
+  small = small * x;
+
+  const Float t = 1.f / (abs_x * 0.3275911f + 1.f);
+  Float poly = Float{} + 1.061405429f;
+  poly = poly * t - 1.453152027f;
+  poly = poly * t + 1.421413741f;
+  poly = poly * t - 0.284496736f;
+  poly = poly * t + 0.254829592f;
+  poly = poly * t;
+  Float e;
+  Exp<VT>(-z, &e);
+  Float large = 1.f - poly * e;
+  large = x < 0.f ? -large : large;
+
+  *y = abs_x < 0.5f ? small : large;
+}
+
+struct LogisticOp
+{
+  template <typename VT>
+  static CKER_X86_INLINE void Run(const typename VT::Float &x, typename VT::Float *y)
+  {
+    Logistic<VT>(x, y);
+  }
+};
+
+struct TanhOp
+{
+  template <typename VT>
+  static CKER_X86_INLINE void Run(const typename VT::Float &x, typename VT::Float *y)
+  {
+    Tanh<VT>(x, y);
+  }
+};
+
+struct ErfOp
+{
+  template <typename VT>
+  static CKER_X86_INLINE void Run(const typename VT::Float &x, typename VT::Float *y)
+  {
+    Erf<VT>(x, y);
+  }
+};
+
+// Apply Op to every element, the tail is computed in a partially filled vector
+template <typename VT, typename Op>
+CKER_X86_INLINE void MapElementwise(int size, const float *input_data, float *output_data)
+{
+  using Float = typename VT::Float;
+  int i = 0;
+  for (; i <= size - VT::kSize; i += VT::kSize)
+  {
+    Float x, y;
+    Load(input_data + i, &x);
+    Op::template Run<VT>(x, &y);
+    Store(output_data + i, y);
+  }
+  if (i < size)
+  {
+    Float x, y;
+    LoadPartial(input_data + i, size - i, 0.f, &x);
+    Op::template Run<VT>(x, &y);
+    StorePartial(output_data + i, size - i, y);
+  }
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_UTILS_H__
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_CHECK_H__
+#define __NNFW_CKER_X86_CHECK_H__
+
+#include <algorithm>
+
+// USE_X86_SIMD enables AVX2 and AVX-512 kernels on x86.
+// Kernels are compiled with function target attributes regardless of compiler flags, and one of
+// them is selected by the cpu features detected at runtime. So a binary built for generic x86-64
+// still runs on cpus without AVX2.
+#if defined(CKER_X86_PLATFORM) && defined(__GNUC__) && !defined(CKER_X86_DISABLE_SIMD)
+#define USE_X86_SIMD
+#define CKER_X86_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define CKER_X86_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+// Helpers handling vector types should be inlined into kernels of the right target
+#define CKER_X86_INLINE __attribute__((always_inline)) inline
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+
+enum class X86SimdLevel
+{
+  kNone = 0,
+  kAvx2,
+  kAvx512,
+};
+
+inline X86SimdLevel DetectX86SimdLevel()
+{
+#ifdef USE_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    return X86SimdLevel::kAvx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return X86SimdLevel::kAvx2;
+#endif // USE_X86_SIMD
+  return X86SimdLevel::kNone;
+}
+
+namespace x86
+{
+inline X86SimdLevel &SimdLevel()
+{
+  static X86SimdLevel level = DetectX86SimdLevel();
+  return level;
+}
+} // namespace x86
+
+// Level of x86 kernels to use, detected once by cpuid
+inline X86SimdLevel GetX86SimdLevel() { return x86::SimdLevel(); }
+
+// Select a lower level, e.g. to compare kernels in tests and benchmarks
+// A level not supported by the cpu falls back to the detected one.
+inline void SetX86SimdLevel(X86SimdLevel level)
+{
+  x86::SimdLevel() = std::min(level, DetectX86SimdLevel());
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_X86_CHECK_H__
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Attention.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::AttentionParams;
+using nnfw::cker::Shape;
+
+std::vector<float> MakeData(int size, int seed)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 37 + seed * 11) % 97 - 48) / 32.f;
+  return data;
+}
+
+// Attention with the whole scores of a query, mask is [q_len, kv_len] or empty
+std::vector<float> ReferenceAttention(const AttentionParams &params, int batches, int heads,
+                                      int kv_heads, int q_len, int kv_len, int depth,
+                                      const std::vector<float> &query,
+                                      const std::vector<float> &key,
+                                      const std::vector<float> &value,
+                                      const std::vector<float> &mask)
+{
+  std::vector<float> output(batches * heads * q_len * depth, 0.f);
+  std::vector<float> scores(kv_len);
+  for (int b = 0; b < batches; ++b)
+    for (int h = 0; h < heads; ++h)
+    {
+      const int kv = b * kv_heads + h / (heads / kv_heads);
+      for (int i = 0; i < q_len; ++i)
+      {
+        const float *q = query.data() + ((b * heads + h) * q_len + i) * depth;
+        const int visible = params.causal ? kv_len - q_len + i + 1 : kv_len;
+        if (visible <= 0)
+          continue;
+        float max = -std::numeric_limits<float>::infinity();
+        for (int j = 0; j < visible; ++j)
+        {
+          const float *k = key.data() + (kv * kv_len + j) * depth;
+          float dot = 0.f;
+          for (int d = 0; d < depth; ++d)
+            dot += q[d] * k[d];
+          scores[j] = params.scale * dot + (mask.empty() ? 0.f : mask[i * kv_len + j]);
+          max = std::max(max, scores[j]);
+        }
+        // A query which sees no key has zero output
+        if (max == -std::numeric_limits<float>::infinity())
+          continue;
+        float sum = 0.f;
+        for (int j = 0; j < visible; ++j)
+        {
+          scores[j] = std::exp(scores[j] - max);
+          sum += scores[j];
+        }
+        float *out = output.data() + ((b * heads + h) * q_len + i) * depth;
+        for (int j = 0; j < visible; ++j)
+          for (int d = 0; d < depth; ++d)
+            out[d] += scores[j] / sum * value[(kv * kv_len + j) * depth + d];
+      }
+    }
+  return output;
+}
+
+void VerifyAttention(const AttentionParams &params, int batches, int heads, int kv_heads,
+                     int q_len, int kv_len, int depth, bool with_mask,
+                     ruy::Context *ruy_context = nullptr)
+{
+  const auto query = MakeData(batches * heads * q_len * depth, 1);
+  const auto key = MakeData(batches * kv_heads * kv_len * depth, 2);
+  const auto value = MakeData(batches * kv_heads * kv_len * depth, 3);
+  std::vector<float> mask;
+  if (with_mask)
+  {
+    mask = MakeData(q_len * kv_len, 4);
+    // Some keys are hidden
+    for (int i = 0; i < q_len * kv_len; i += 7)
+      mask[i] = -std::numeric_limits<float>::infinity();
+  }
+
+  const auto expected = ReferenceAttention(params, batches, heads, kv_heads, q_len, kv_len,
+                                           depth, query, key, value, mask);
+  std::vector<float> output(expected.size());
+  nnfw::cker::Attention(params, Shape{batches, heads, q_len, depth}, query.data(),
+                        Shape{batches, kv_heads, kv_len, depth}, key.data(),
+                        Shape{batches, kv_heads, kv_len, depth}, value.data(),
+                        Shape{q_len, kv_len}, with_mask ? mask.data() : nullptr,
+                        Shape{batches, heads, q_len, depth}, output.data(), ruy_context);
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-4f) << "at " << i;
+}
+
+} // namespace
+
+// Lengths are not multiples of tiles to test edges
+TEST(CKer_Operation, Attention)
+{
+  AttentionParams params;
+  params.scale = 0.125f;
+  params.causal = false;
+  VerifyAttention(params, 1, 2, 2, 1, 1, 16, false);
+  VerifyAttention(params, 2, 3, 3, 37, 301, 24, false);
+  VerifyAttention(params, 1, 2, 2, 45, 130, 16, true);
+}
+
+TEST(CKer_Operation, AttentionCausal)
+{
+  AttentionParams params;
+  params.scale = 0.125f;
+  params.causal = true;
+  // Prefill
+  VerifyAttention(params, 1, 2, 2, 70, 70, 16, false);
+  VerifyAttention(params, 1, 2, 2, 70, 70, 16, true);
+  // Decode with a cache of keys
+  VerifyAttention(params, 1, 4, 4, 1, 257, 32, false);
+  VerifyAttention(params, 2, 2, 2, 3, 150, 8, false);
+}
+
+TEST(CKer_Operation, AttentionGroupedQuery)
+{
+  AttentionParams params;
+  params.scale = 0.25f;
+  params.causal = true;
+  VerifyAttention(params, 2, 8, 2, 33, 40, 16, false);
+}
+
+TEST(CKer_Operation, AttentionMultiThreads)
+{
+  AttentionParams params;
+  params.scale = 0.125f;
+  params.causal = true;
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  VerifyAttention(params, 1, 4, 2, 100, 200, 32, true, &ruy_context);
+}
+
+TEST(CKer_Operation, neg_Attention)
+{
+  AttentionParams params;
+  params.scale = 1.f;
+  params.causal = false;
+  std::vector<float> data(2 * 3 * 4 * 8);
+  std::vector<float> output(data.size());
+  // heads is not a multiple of kv_heads
+  EXPECT_THROW(nnfw::cker::Attention(params, Shape{1, 3, 4, 8}, data.data(), Shape{1, 2, 4, 8},
+                                     data.data(), Shape{1, 2, 4, 8}, data.data(), Shape{}, nullptr,
+                                     Shape{1, 3, 4, 8}, output.data()),
+               std::runtime_error);
+  // Mask is not broadcastable
+  EXPECT_THROW(nnfw::cker::Attention(params, Shape{1, 2, 4, 8}, data.data(), Shape{1, 2, 4, 8},
+                                     data.data(), Shape{1, 2, 4, 8}, data.data(), Shape{4, 3},
+                                     data.data(), Shape{1, 2, 4, 8}, output.data()),
+               std::runtime_error);
+}
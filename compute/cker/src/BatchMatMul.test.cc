@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BatchMatMul.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+// lhs [2, 1, M, K] x rhs [1, 3, K, N] -> output [2, 3, M, N] with broadcast batch dimensions
+class BatchMatMulTest : public ::testing::TestWithParam<std::tuple<bool, bool>>
+{
+protected:
+  static constexpr int M = 3;
+  static constexpr int K = 4;
+  static constexpr int N = 5;
+
+  void SetUp() override
+  {
+    std::tie(_adj_x, _adj_y) = GetParam();
+    _lhs_shape.ReplaceWith(_adj_x ? Shape{2, 1, K, M} : Shape{2, 1, M, K});
+    _rhs_shape.ReplaceWith(_adj_y ? Shape{1, 3, N, K} : Shape{1, 3, K, N});
+    _output_shape.ReplaceWith(Shape{2, 3, M, N});
+
+    _lhs.resize(_lhs_shape.FlatSize());
+    _rhs.resize(_rhs_shape.FlatSize());
+    for (size_t i = 0; i < _lhs.size(); ++i)
+      _lhs[i] = static_cast<int>((i * 7) % 11) - 5;
+    for (size_t i = 0; i < _rhs.size(); ++i)
+      _rhs[i] = static_cast<int>((i * 5) % 13) - 6;
+  }
+
+  std::vector<float> expected() const
+  {
+    std::vector<float> output(_output_shape.FlatSize());
+    for (int b0 = 0; b0 < 2; ++b0)
+      for (int b1 = 0; b1 < 3; ++b1)
+        for (int i = 0; i < M; ++i)
+          for (int j = 0; j < N; ++j)
+          {
+            float acc = 0;
+            for (int k = 0; k < K; ++k)
+            {
+              const float l = _adj_x ? _lhs[(b0 * K + k) * M + i] : _lhs[(b0 * M + i) * K + k];
+              const float r = _adj_y ? _rhs[(b1 * N + j) * K + k] : _rhs[(b1 * K + k) * N + j];
+              acc += l * r;
+            }
+            output[((b0 * 3 + b1) * M + i) * N + j] = acc;
+          }
+    return output;
+  }
+
+  template <typename T> std::vector<T> cast(const std::vector<float> &data) const
+  {
+    return std::vector<T>(data.begin(), data.end());
+  }
+
+  bool _adj_x = false;
+  bool _adj_y = false;
+  Shape _lhs_shape;
+  Shape _rhs_shape;
+  Shape _output_shape;
+  std::vector<float> _lhs;
+  std::vector<float> _rhs;
+};
+
+} // namespace
+
+TEST_P(BatchMatMulTest, Float)
+{
+  nnfw::cker::BatchMatMul kernel;
+  kernel.prepare(_lhs_shape, _rhs_shape, _adj_x, _adj_y);
+  std::vector<float> output(_output_shape.FlatSize());
+  kernel(_lhs_shape, _lhs.data(), _rhs_shape, _rhs.data(), _adj_x, _adj_y, _output_shape,
+         output.data());
+  EXPECT_EQ(output, expected());
+}
+
+TEST_P(BatchMatMulTest, FloatMultiThreadConstRhs)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  nnfw::cker::BatchMatMul kernel;
+  kernel.prepare(_lhs_shape, _rhs_shape, _adj_x, _adj_y, true);
+  // Run twice to use packed rhs cached at the first run
+  for (int run = 0; run < 2; ++run)
+  {
+    std::vector<float> output(_output_shape.FlatSize());
+    kernel(_lhs_shape, _lhs.data(), _rhs_shape, _rhs.data(), _adj_x, _adj_y, _output_shape,
+           output.data(), &ruy_context);
+    EXPECT_EQ(output, expected());
+  }
+}
+
+TEST_P(BatchMatMulTest, Int8)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(2);
+
+  // Shift values by zero points, output scale is 1 and output zero point is 1
+  nnfw::cker::BatchMatMulParams params;
+  params.adj_x = _adj_x;
+  params.adj_y = _adj_y;
+  params.lhs_zero_point = 3;
+  params.rhs_zero_point = -2;
+  params.output_zero_point = 1;
+  params.output_multiplier = 1 << 30;
+  params.output_shift = 1;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+  params.rhs_cacheable = false;
+
+  std::vector<int8_t> lhs = cast<int8_t>(_lhs);
+  std::vector<int8_t> rhs = cast<int8_t>(_rhs);
+  for (auto &v : lhs)
+    v += params.lhs_zero_point;
+  for (auto &v : rhs)
+    v += params.rhs_zero_point;
+
+  nnfw::cker::BatchMatMul kernel;
+  std::vector<int8_t> output(_output_shape.FlatSize());
+  kernel(params, _lhs_shape, lhs.data(), _rhs_shape, rhs.data(), _output_shape, output.data(),
+         &ruy_context);
+
+  std::vector<int8_t> expected_output = cast<int8_t>(expected());
+  for (auto &v : expected_output)
+    v += params.output_zero_point;
+  EXPECT_EQ(output, expected_output);
+}
+
+TEST_P(BatchMatMulTest, Int16)
+{
+  nnfw::cker::BatchMatMulParams params;
+  params.adj_x = _adj_x;
+  params.adj_y = _adj_y;
+  params.lhs_zero_point = 0;
+  params.rhs_zero_point = 0;
+  params.output_zero_point = 0;
+  params.output_multiplier = 1 << 30;
+  params.output_shift = 1;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+  params.rhs_cacheable = false;
+
+  std::vector<int16_t> lhs = cast<int16_t>(_lhs);
+  std::vector<int16_t> rhs = cast<int16_t>(_rhs);
+
+  nnfw::cker::BatchMatMul kernel;
+  std::vector<int16_t> output(_output_shape.FlatSize());
+  kernel(params, _lhs_shape, lhs.data(), _rhs_shape, rhs.data(), _output_shape, output.data());
+  EXPECT_EQ(output, cast<int16_t>(expected()));
+}
+
+INSTANTIATE_TEST_SUITE_P(AdjXY, BatchMatMulTest,
+                         ::testing::Combine(::testing::Bool(), ::testing::Bool()));
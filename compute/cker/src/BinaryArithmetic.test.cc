@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cker/operation/BinaryArithmeticOps.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::BinaryArithmeticOpType;
+using nnfw::cker::Shape;
+
+template <typename T> std::vector<T> MakeData(int size, int seed)
+{
+  std::vector<T> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<T>((i * 37 + seed * 11) % 97 + 1);
+  return data;
+}
+
+// Results split over threads should be the same as the ones on the caller thread
+template <BinaryArithmeticOpType op_type, typename T>
+void VerifyParallel(nnfw::cker::BinaryArithmeticOpParam params, const Shape &input1_shape,
+                    const Shape &input2_shape, const Shape &output_shape)
+{
+  const auto input1 = MakeData<T>(input1_shape.FlatSize(), 1);
+  const auto input2 = MakeData<T>(input2_shape.FlatSize(), 2);
+  std::vector<T> expected(output_shape.FlatSize());
+  std::vector<T> output(output_shape.FlatSize());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  if (nnfw::cker::ProcessBroadcastShapes(input1_shape, input2_shape, &params))
+  {
+    nnfw::cker::BroadcastBinaryArithmeticOp<op_type>(params, input1_shape, input1.data(),
+                                                     input2_shape, input2.data(), output_shape,
+                                                     expected.data());
+    nnfw::cker::BroadcastBinaryArithmeticOp<op_type>(params, input1_shape, input1.data(),
+                                                     input2_shape, input2.data(), output_shape,
+                                                     output.data(), &ruy_context);
+  }
+  else
+  {
+    nnfw::cker::BinaryArithmeticOp<op_type>(params, input1_shape, input1.data(), input2_shape,
+                                            input2.data(), output_shape, expected.data());
+    nnfw::cker::BinaryArithmeticOp<op_type>(params, input1_shape, input1.data(), input2_shape,
+                                            input2.data(), output_shape, output.data(),
+                                            &ruy_context);
+  }
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_EQ(output[i], expected[i]) << "at " << i;
+}
+
+nnfw::cker::BinaryArithmeticOpParam FloatParams()
+{
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  return params;
+}
+
+} // namespace
+
+TEST(CKer_Operation, BinaryArithmeticMultiThreads)
+{
+  VerifyParallel<BinaryArithmeticOpType::ADD, float>(FloatParams(), Shape{1, 64, 64, 33},
+                                                     Shape{1, 64, 64, 33}, Shape{1, 64, 64, 33});
+  VerifyParallel<BinaryArithmeticOpType::DIV, float>(FloatParams(), Shape{100003},
+                                                     Shape{100003}, Shape{100003});
+
+  nnfw::cker::BinaryArithmeticOpParam int_params;
+  int_params.quantized_activation_min = std::numeric_limits<int32_t>::lowest();
+  int_params.quantized_activation_max = std::numeric_limits<int32_t>::max();
+  VerifyParallel<BinaryArithmeticOpType::MUL, int32_t>(int_params, Shape{3, 200, 101},
+                                                       Shape{3, 200, 101}, Shape{3, 200, 101});
+}
+
+TEST(CKer_Operation, BroadcastBinaryArithmeticMultiThreads)
+{
+  // Split along the outermost axis which is not 1, with the second input broadcast along it
+  VerifyParallel<BinaryArithmeticOpType::MUL, float>(FloatParams(), Shape{1, 96, 96, 17},
+                                                     Shape{1, 1, 1, 17}, Shape{1, 96, 96, 17});
+  // First input is broadcast, and ranges of the axis may have the same shapes
+  VerifyParallel<BinaryArithmeticOpType::SUB, float>(FloatParams(), Shape{1, 70, 1},
+                                                     Shape{5, 70, 300}, Shape{5, 70, 300});
+  // Scalar input of lower rank
+  VerifyParallel<BinaryArithmeticOpType::DIV, float>(FloatParams(), Shape{2, 50000}, Shape{1},
+                                                     Shape{2, 50000});
+  // Generic broadcast
+  VerifyParallel<BinaryArithmeticOpType::POW, float>(FloatParams(), Shape{4, 1, 90, 1},
+                                                     Shape{1, 60, 1, 30}, Shape{4, 60, 90, 30});
+
+  nnfw::cker::BinaryArithmeticOpParam int_params;
+  int_params.quantized_activation_min = -1000;
+  int_params.quantized_activation_max = 1000;
+  VerifyParallel<BinaryArithmeticOpType::ADD, int32_t>(int_params, Shape{8, 1, 4000},
+                                                       Shape{8, 3, 4000}, Shape{8, 3, 4000});
+}
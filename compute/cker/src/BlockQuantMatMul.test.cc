@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BlockQuantMatMul.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::BlockQ4_0;
+using nnfw::cker::BlockQ8_0;
+using nnfw::cker::kBlockQuantSize;
+using nnfw::cker::Shape;
+
+// Scales are exact in fp16, 2^-4 to 2^-1
+template <typename Block> std::vector<Block> MakeBlocks(int count)
+{
+  const uint16_t scales[] = {0x2c00, 0x3000, 0x3400, 0x3800};
+  std::vector<Block> blocks(count);
+  for (int b = 0; b < count; ++b)
+  {
+    blocks[b].scale = scales[b % 4];
+    for (size_t j = 0; j < sizeof(blocks[b].quants); ++j)
+    {
+      // Any byte is a valid quant of both Q4_0 and Q8_0
+      const uint8_t value = static_cast<uint8_t>((b * 31 + j * 17) % 256);
+      std::memcpy(&blocks[b].quants[j], &value, 1);
+    }
+  }
+  return blocks;
+}
+
+std::vector<float> MakeInput(int size)
+{
+  std::vector<float> input(size);
+  for (int i = 0; i < size; ++i)
+    input[i] = static_cast<float>((i * 37) % 101 - 50) / 16.f;
+  return input;
+}
+
+// output[r * cols + c] = dot(input row r, dequantized weights row c)
+template <typename Block>
+std::vector<float> ReferenceMatMul(const std::vector<float> &input, int rows, int depth,
+                                   const Block *weights, int cols)
+{
+  std::vector<float> row(depth);
+  std::vector<float> output(rows * cols);
+  for (int c = 0; c < cols; ++c)
+  {
+    for (int b = 0; b < depth / kBlockQuantSize; ++b)
+      nnfw::cker::DequantizeBlock(weights[c * depth / kBlockQuantSize + b],
+                                  row.data() + b * kBlockQuantSize);
+    for (int r = 0; r < rows; ++r)
+    {
+      double sum = 0;
+      for (int k = 0; k < depth; ++k)
+        sum += static_cast<double>(row[k]) * input[r * depth + k];
+      output[r * cols + c] = static_cast<float>(sum);
+    }
+  }
+  return output;
+}
+
+template <typename Block> void VerifyFullyConnected(int batches, int depth, int units,
+                                                    ruy::Context *ruy_context)
+{
+  const auto weights = MakeBlocks<Block>(units * depth / kBlockQuantSize);
+  const auto input = MakeInput(batches * depth);
+  std::vector<float> bias(units);
+  for (int i = 0; i < units; ++i)
+    bias[i] = (i % 7) - 3.f;
+
+  nnfw::cker::FullyConnectedParams params;
+  params.float_activation_min = -20.f;
+  params.float_activation_max = 30.f;
+  std::vector<float> output(batches * units);
+  nnfw::cker::FullyConnectedBlockQuant(params, Shape{batches, depth}, input.data(),
+                                       Shape{units, depth}, weights.data(), Shape{units},
+                                       bias.data(), Shape{batches, units}, output.data(),
+                                       ruy_context);
+
+  const auto expected = ReferenceMatMul(input, batches, depth, weights.data(), units);
+  for (int b = 0; b < batches; ++b)
+    for (int u = 0; u < units; ++u)
+    {
+      const float value = std::min(std::max(expected[b * units + u] + bias[u], -20.f), 30.f);
+      EXPECT_NEAR(output[b * units + u], value, 1e-3f) << "batch " << b << " unit " << u;
+    }
+}
+
+} // namespace
+
+TEST(BlockQuant, Fp16ToFloat)
+{
+  EXPECT_EQ(nnfw::cker::Fp16ToFloat(0x3c00), 1.f);
+  EXPECT_EQ(nnfw::cker::Fp16ToFloat(0xc000), -2.f);
+  EXPECT_EQ(nnfw::cker::Fp16ToFloat(0x7bff), 65504.f);
+  EXPECT_EQ(nnfw::cker::Fp16ToFloat(0x0001), std::ldexp(1.f, -24));
+  EXPECT_EQ(nnfw::cker::Fp16ToFloat(0x8000), 0.f);
+  EXPECT_TRUE(std::isinf(nnfw::cker::Fp16ToFloat(0x7c00)));
+}
+
+TEST(BlockQuant, Dequantize)
+{
+  BlockQ4_0 q4;
+  q4.scale = 0x3800; // 0.5
+  for (int j = 0; j < kBlockQuantSize / 2; ++j)
+    q4.quants[j] = static_cast<uint8_t>(j | ((15 - j) << 4));
+  float output[kBlockQuantSize];
+  nnfw::cker::DequantizeBlock(q4, output);
+  for (int j = 0; j < kBlockQuantSize / 2; ++j)
+  {
+    EXPECT_EQ(output[j], (j - 8) * 0.5f);
+    EXPECT_EQ(output[j + kBlockQuantSize / 2], (7 - j) * 0.5f);
+  }
+
+  BlockQ8_0 q8;
+  q8.scale = 0xc000; // -2
+  for (int j = 0; j < kBlockQuantSize; ++j)
+    q8.quants[j] = static_cast<int8_t>(j * 8 - 128);
+  nnfw::cker::DequantizeBlock(q8, output);
+  for (int j = 0; j < kBlockQuantSize; ++j)
+    EXPECT_EQ(output[j], (j * 8 - 128) * -2.f);
+}
+
+TEST(BlockQuant, FullyConnected)
+{
+  VerifyFullyConnected<BlockQ4_0>(1, 64, 7, nullptr);
+  VerifyFullyConnected<BlockQ4_0>(5, 96, 13, nullptr);
+  VerifyFullyConnected<BlockQ8_0>(1, 64, 7, nullptr);
+  VerifyFullyConnected<BlockQ8_0>(5, 96, 13, nullptr);
+  // Input rows are visited in chunks
+  VerifyFullyConnected<BlockQ4_0>(9, 4096, 3, nullptr);
+}
+
+TEST(BlockQuant, FullyConnectedMultiThreads)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  VerifyFullyConnected<BlockQ4_0>(2, 512, 301, &ruy_context);
+  VerifyFullyConnected<BlockQ8_0>(2, 512, 301, &ruy_context);
+}
+
+TEST(BlockQuant, BatchMatMul)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  // lhs [2, 3, rows, depth] and rhs [1, 3, cols, depth] broadcast over the first dimension
+  constexpr int rows = 4, depth = 128, cols = 67;
+  const auto lhs = MakeInput(2 * 3 * rows * depth);
+  const auto rhs = MakeBlocks<BlockQ4_0>(3 * cols * depth / kBlockQuantSize);
+  std::vector<float> output(2 * 3 * rows * cols);
+  nnfw::cker::BatchMatMulBlockQuant(Shape{2, 3, rows, depth}, lhs.data(), Shape{1, 3, cols, depth},
+                                    rhs.data(), false, true, Shape{2, 3, rows, cols},
+                                    output.data(), &ruy_context);
+
+  for (int b = 0; b < 6; ++b)
+  {
+    const std::vector<float> lhs_slice(lhs.begin() + b * rows * depth,
+                                       lhs.begin() + (b + 1) * rows * depth);
+    const auto expected = ReferenceMatMul(
+      lhs_slice, rows, depth, rhs.data() + (b % 3) * cols * depth / kBlockQuantSize, cols);
+    for (int i = 0; i < rows * cols; ++i)
+      EXPECT_NEAR(output[b * rows * cols + i], expected[i], 1e-3f) << "batch " << b;
+  }
+}
+
+TEST(BlockQuant, neg_BatchMatMul)
+{
+  const auto lhs = MakeInput(64);
+  const auto rhs = MakeBlocks<BlockQ8_0>(2);
+  std::vector<float> output(2);
+  EXPECT_ANY_THROW(nnfw::cker::BatchMatMulBlockQuant(Shape{1, 64}, lhs.data(), Shape{64, 2},
+                                                     rhs.data(), false, false, Shape{1, 2},
+                                                     output.data()));
+  EXPECT_ANY_THROW(nnfw::cker::FullyConnectedBlockQuant(
+    nnfw::cker::FullyConnectedParams{}, Shape{4, 16}, lhs.data(), Shape{4, 16}, rhs.data(),
+    Shape{0}, nullptr, Shape{4, 4}, output.data()));
+}
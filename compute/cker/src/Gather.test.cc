@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cker/operation/Gather.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+template <typename CoordsT>
+void VerifyGather(int axis, const Shape &input_shape, const std::vector<CoordsT> &coords,
+                  ruy::Context *ruy_context = nullptr)
+{
+  std::vector<int32_t> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<int32_t>(i);
+
+  int outer = 1;
+  for (int i = 0; i < axis; ++i)
+    outer *= input_shape.Dims(i);
+  int inner = 1;
+  for (int i = axis + 1; i < input_shape.DimensionsCount(); ++i)
+    inner *= input_shape.Dims(i);
+  const int axis_size = input_shape.Dims(axis);
+  const int count = static_cast<int>(coords.size());
+
+  std::vector<int32_t> output(outer * count * inner);
+  nnfw::cker::GatherParams params;
+  params.axis = axis;
+  nnfw::cker::Gather(params, input_shape, input.data(), Shape{count}, coords.data(),
+                     Shape{static_cast<int>(output.size())}, output.data(), ruy_context);
+  for (int o = 0; o < outer; ++o)
+    for (int i = 0; i < count; ++i)
+      for (int j = 0; j < inner; ++j)
+        EXPECT_EQ(output[(o * count + i) * inner + j],
+                  input[(o * axis_size + coords[i]) * inner + j]);
+}
+
+} // namespace
+
+TEST(CKer_Operation, Gather)
+{
+  VerifyGather<int32_t>(0, Shape{5, 3}, {4, 0, 0, 2});
+  VerifyGather<int64_t>(1, Shape{2, 6, 3}, {5, 1, 3});
+  VerifyGather<int32_t>(2, Shape{3, 2, 7}, {6, 6, 0, 1, 2});
+}
+
+TEST(CKer_Operation, GatherMultiThreads)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  // Large enough to be split into tasks, rows of embeddings
+  std::vector<int32_t> coords(3001);
+  for (size_t i = 0; i < coords.size(); ++i)
+    coords[i] = static_cast<int32_t>((i * 7919) % 1000);
+  VerifyGather(0, Shape{1000, 64}, coords, &ruy_context);
+  VerifyGather(1, Shape{3, 1000, 16}, coords, &ruy_context);
+}
+
+TEST(CKer_Operation, GatherBlockQuant)
+{
+  constexpr int rows = 50;
+  constexpr int cols = 96;
+  constexpr int blocks_per_row = cols / nnfw::cker::kBlockQuantSize;
+  std::vector<nnfw::cker::BlockQ4_0> q4(rows * blocks_per_row);
+  std::vector<nnfw::cker::BlockQ8_0> q8(rows * blocks_per_row);
+  for (int b = 0; b < rows * blocks_per_row; ++b)
+  {
+    q4[b].scale = q8[b].scale = 0x3000 + b; // about 0.125
+    for (int j = 0; j < nnfw::cker::kBlockQuantSize / 2; ++j)
+      q4[b].quants[j] = static_cast<uint8_t>(b * 13 + j * 29);
+    for (int j = 0; j < nnfw::cker::kBlockQuantSize; ++j)
+      q8[b].quants[j] = static_cast<int8_t>(b * 13 + j * 29);
+  }
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  std::vector<int64_t> coords(700);
+  for (size_t i = 0; i < coords.size(); ++i)
+    coords[i] = static_cast<int64_t>((i * 31) % rows);
+  const int count = static_cast<int>(coords.size());
+
+  std::vector<float> q4_output(count * cols);
+  std::vector<float> q8_output(count * cols);
+  nnfw::cker::GatherBlockQuant(Shape{rows, cols}, q4.data(), Shape{count}, coords.data(),
+                               Shape{count, cols}, q4_output.data(), &ruy_context);
+  nnfw::cker::GatherBlockQuant(Shape{rows, cols}, q8.data(), Shape{count}, coords.data(),
+                               Shape{count, cols}, q8_output.data());
+
+  float expected[nnfw::cker::kBlockQuantSize];
+  for (int i = 0; i < count; ++i)
+    for (int b = 0; b < blocks_per_row; ++b)
+    {
+      const int block = coords[i] * blocks_per_row + b;
+      const int offset = i * cols + b * nnfw::cker::kBlockQuantSize;
+      nnfw::cker::DequantizeBlock(q4[block], expected);
+      for (int j = 0; j < nnfw::cker::kBlockQuantSize; ++j)
+        EXPECT_EQ(q4_output[offset + j], expected[j]);
+      nnfw::cker::DequantizeBlock(q8[block], expected);
+      for (int j = 0; j < nnfw::cker::kBlockQuantSize; ++j)
+        EXPECT_EQ(q8_output[offset + j], expected[j]);
+    }
+}
+
+TEST(CKer_Operation, neg_GatherBlockQuant)
+{
+  std::vector<nnfw::cker::BlockQ8_0> table(4);
+  std::vector<float> output(64);
+  // Index is out of range
+  const std::vector<int32_t> coords{0, 4};
+  EXPECT_THROW(nnfw::cker::GatherBlockQuant(Shape{4, 32}, table.data(), Shape{2}, coords.data(),
+                                            Shape{2, 32}, output.data()),
+               std::runtime_error);
+  // Cols is not a multiple of block size
+  const std::vector<int32_t> valid{0, 1};
+  EXPECT_THROW(nnfw::cker::GatherBlockQuant(Shape{8, 16}, table.data(), Shape{2}, valid.data(),
+                                            Shape{2, 16}, output.data()),
+               std::runtime_error);
+}
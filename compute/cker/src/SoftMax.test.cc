@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/LogSoftMax.h>
+#include <cker/operation/SoftMax.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<float> MakeLogits(int size)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 37) % 211 - 105) / 16.f;
+  return data;
+}
+
+} // namespace
+
+TEST(CKer_Operation, SoftmaxMultiThreads)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  const Shape shape{2, 5, 4099};
+  const auto input = MakeLogits(shape.FlatSize());
+  std::vector<float> expected(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.f;
+  params.axis = -1;
+  nnfw::cker::reference::Softmax(params, shape, input.data(), shape, expected.data());
+  nnfw::cker::Softmax(params, shape, input.data(), shape, output.data(), &ruy_context);
+  for (int i = 0; i < shape.FlatSize(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-6f) << "at " << i;
+
+  nnfw::cker::Softmax(input.data(), 4099, 10, 1.f, output.data(), &ruy_context);
+  for (int i = 0; i < shape.FlatSize(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-6f) << "at " << i;
+
+  nnfw::cker::LogSoftmax(params, shape, input.data(), shape, output.data(), &ruy_context);
+  for (int i = 0; i < shape.FlatSize(); ++i)
+    EXPECT_NEAR(output[i], std::log(expected[i]), 1e-4f) << "at " << i;
+}
+
+// Axis is not the last dimension
+TEST(CKer_Operation, LogSoftmaxInnerAxisMultiThreads)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  constexpr int outer = 6, depth = 7, inner = 2003;
+  const Shape shape{outer, depth, inner};
+  const auto input = MakeLogits(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.f;
+  params.axis = 1;
+  nnfw::cker::LogSoftmax(params, shape, input.data(), shape, output.data(), &ruy_context);
+  for (int i = 0; i < outer; ++i)
+    for (int j = 0; j < inner; ++j)
+    {
+      double sum = 0.;
+      for (int c = 0; c < depth; ++c)
+        sum += std::exp(input[(i * depth + c) * inner + j]);
+      for (int c = 0; c < depth; ++c)
+      {
+        const int index = (i * depth + c) * inner + j;
+        EXPECT_NEAR(output[index], input[index] - std::log(sum), 1e-4f) << "at " << index;
+      }
+    }
+}
+
+TEST(CKer_Operation, SoftmaxQuant8MultiThreads)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  constexpr int rows = 8, depth = 4111;
+  const Shape shape{rows, depth};
+  std::vector<uint8_t> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<uint8_t>((i * 37) % 251);
+
+  float table[256];
+  nnfw::cker::SoftmaxParams params;
+  const float input_scale = 0.05f;
+  nnfw::cker::PopulateSoftmaxLookupTable(table, input_scale, 1.f);
+  params.table = table;
+  params.scale = 1.f / 256;
+  params.zero_point = 0;
+
+  std::vector<uint8_t> expected(shape.FlatSize());
+  std::vector<uint8_t> output(shape.FlatSize());
+  nnfw::cker::Softmax<uint8_t, uint8_t>(params, shape, input.data(), shape, expected.data());
+  nnfw::cker::Softmax<uint8_t, uint8_t>(params, shape, input.data(), shape, output.data(),
+                                        &ruy_context);
+  EXPECT_EQ(output, expected);
+
+  for (int r = 0; r < rows; ++r)
+  {
+    const uint8_t *row = input.data() + r * depth;
+    const int max = *std::max_element(row, row + depth);
+    double sum = 0.;
+    for (int c = 0; c < depth; ++c)
+      sum += std::exp(input_scale * (row[c] - max));
+    for (int c = 0; c < depth; ++c)
+    {
+      const double prob = std::exp(input_scale * (row[c] - max)) / sum;
+      EXPECT_NEAR(output[r * depth + c], std::min(prob * 256, 255.), 1.) << "at " << r * depth + c;
+    }
+  }
+
+  // LogSoftmax with the same table
+  params.beta = 1.f;
+  params.axis = -1;
+  params.scale = 16.f / 256;
+  params.zero_point = 255;
+  nnfw::cker::LogSoftmax(params, input_scale, shape, input.data(), shape, expected.data());
+  nnfw::cker::LogSoftmax(params, input_scale, shape, input.data(), shape, output.data(),
+                         &ruy_context);
+  EXPECT_EQ(output, expected);
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+using nnfw::cker::TransposeParams;
+
+std::vector<std::array<int, 4>> AllPermutations()
+{
+  std::vector<std::array<int, 4>> perms;
+  std::array<int, 4> perm{0, 1, 2, 3};
+  do
+  {
+    perms.push_back(perm);
+  } while (std::next_permutation(perm.begin(), perm.end()));
+  return perms;
+}
+
+template <typename T>
+void VerifyTranspose(const Shape &input_shape, const std::vector<int> &perm,
+                     ruy::Context *ruy_context)
+{
+  const int rank = input_shape.DimensionsCount();
+  TransposeParams params;
+  params.perm_count = rank;
+  Shape output_shape(rank);
+  for (int i = 0; i < rank; ++i)
+  {
+    params.perm[i] = perm[i];
+    output_shape.SetDim(i, input_shape.Dims(perm[i]));
+  }
+
+  std::vector<T> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<T>(i * 7 + 3);
+  std::vector<T> expected(input.size());
+  std::vector<T> output(input.size());
+
+  nnfw::cker::reference::Transpose(params, input_shape, input.data(), output_shape,
+                                   expected.data());
+  nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, output.data(),
+                        ruy_context);
+  EXPECT_EQ(output, expected);
+}
+
+class TransposeTest : public ::testing::TestWithParam<std::array<int, 4>>
+{
+};
+
+} // namespace
+
+// Dims are not multiples of tiles to test edges
+TEST_P(TransposeTest, Float)
+{
+  const auto &p = GetParam();
+  const std::vector<int> perm(p.begin(), p.end());
+  VerifyTranspose<float>(Shape{3, 17, 13, 11}, perm, nullptr);
+  VerifyTranspose<float>(Shape{2, 67, 5, 70}, perm, nullptr);
+}
+
+TEST_P(TransposeTest, OtherTypes)
+{
+  const auto &p = GetParam();
+  const std::vector<int> perm(p.begin(), p.end());
+  VerifyTranspose<int8_t>(Shape{3, 17, 13, 11}, perm, nullptr);
+  VerifyTranspose<int16_t>(Shape{3, 17, 13, 11}, perm, nullptr);
+  VerifyTranspose<int64_t>(Shape{3, 17, 13, 11}, perm, nullptr);
+}
+
+TEST_P(TransposeTest, OneSizeDims)
+{
+  const auto &p = GetParam();
+  const std::vector<int> perm(p.begin(), p.end());
+  VerifyTranspose<float>(Shape{1, 19, 1, 23}, perm, nullptr);
+  VerifyTranspose<float>(Shape{9, 1, 1, 10}, perm, nullptr);
+  VerifyTranspose<uint8_t>(Shape{1, 1, 1, 1}, perm, nullptr);
+}
+
+TEST_P(TransposeTest, MultiThreads)
+{
+  const auto &p = GetParam();
+  const std::vector<int> perm(p.begin(), p.end());
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  VerifyTranspose<float>(Shape{2, 37, 29, 19}, perm, &ruy_context);
+  VerifyTranspose<uint8_t>(Shape{2, 37, 29, 19}, perm, &ruy_context);
+}
+
+INSTANTIATE_TEST_SUITE_P(Permutations, TransposeTest, ::testing::ValuesIn(AllPermutations()));
+
+TEST(Transpose, LowerRanks)
+{
+  VerifyTranspose<float>(Shape{45, 77}, {1, 0}, nullptr);
+  VerifyTranspose<float>(Shape{45, 77}, {0, 1}, nullptr);
+  VerifyTranspose<int32_t>(Shape{5, 33, 17}, {0, 2, 1}, nullptr);
+  VerifyTranspose<int32_t>(Shape{5, 33, 17}, {1, 0, 2}, nullptr);
+  VerifyTranspose<int32_t>(Shape{5, 33, 17}, {2, 1, 0}, nullptr);
+  VerifyTranspose<int32_t>(Shape{5, 33, 17}, {1, 2, 0}, nullptr);
+  VerifyTranspose<int8_t>(Shape{130}, {0}, nullptr);
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/TransposeConv.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+// input [2, 5, 4, 3] and filter [4, K, K, 3] with the given (stride, padding, K)
+class TransposeConvTest : public ::testing::TestWithParam<std::tuple<int, int, int>>
+{
+protected:
+  static constexpr int N = 2;
+  static constexpr int IH = 5;
+  static constexpr int IW = 4;
+  static constexpr int IC = 3;
+  static constexpr int OC = 4;
+
+  void SetUp() override
+  {
+    int stride, pad, k;
+    std::tie(stride, pad, k) = GetParam();
+    // Output width has one more column which no input pixel reaches
+    const int OH = (IH - 1) * stride + k - 2 * pad;
+    const int OW = (IW - 1) * stride + k - 2 * pad + 1;
+    ASSERT_GT(OH, 0);
+    ASSERT_GT(OW, 0);
+
+    _input_shape.ReplaceWith(Shape{N, IH, IW, IC});
+    _filter_shape.ReplaceWith(Shape{OC, k, k, IC});
+    _bias_shape.ReplaceWith(Shape{OC});
+    _output_shape.ReplaceWith(Shape{N, OH, OW, OC});
+
+    _params.stride_width = stride;
+    _params.stride_height = stride;
+    _params.padding_values.width = pad;
+    _params.padding_values.height = pad;
+    _params.float_activation_min = std::numeric_limits<float>::lowest();
+    _params.float_activation_max = std::numeric_limits<float>::max();
+
+    _input.resize(_input_shape.FlatSize());
+    _filter.resize(_filter_shape.FlatSize());
+    _bias.resize(OC);
+    for (size_t i = 0; i < _input.size(); ++i)
+      _input[i] = static_cast<int>((i * 7) % 9) - 4;
+    for (size_t i = 0; i < _filter.size(); ++i)
+      _filter[i] = static_cast<int>((i * 5) % 7) - 3;
+    for (size_t i = 0; i < _bias.size(); ++i)
+      _bias[i] = static_cast<int>(i % 5) - 2;
+  }
+
+  std::vector<float> expected() const
+  {
+    std::vector<float> output(_output_shape.FlatSize());
+    nnfw::cker::reference::TransposeConv(_params, _input_shape, _input.data(), _filter_shape,
+                                         _filter.data(), _output_shape, output.data());
+    for (size_t i = 0; i < output.size(); ++i)
+      output[i] += _bias[i % OC];
+    return output;
+  }
+
+  nnfw::cker::TransposeConvParams _params;
+  Shape _input_shape;
+  Shape _filter_shape;
+  Shape _bias_shape;
+  Shape _output_shape;
+  std::vector<float> _input;
+  std::vector<float> _filter;
+  std::vector<float> _bias;
+};
+
+} // namespace
+
+TEST_P(TransposeConvTest, Float)
+{
+  nnfw::cker::TransposeConv kernel;
+  std::vector<float> output(_output_shape.FlatSize());
+  kernel(_params, _input_shape, _input.data(), _filter_shape, _filter.data(), _bias_shape,
+         _bias.data(), _output_shape, output.data());
+  EXPECT_EQ(output, expected());
+}
+
+TEST_P(TransposeConvTest, FloatMultiThreadConstFilter)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  nnfw::cker::TransposeConv kernel;
+  kernel.prepare(_filter_shape, _filter.data());
+  // Run twice to use packed filter cached at the first run
+  for (int run = 0; run < 2; ++run)
+  {
+    std::vector<float> output(_output_shape.FlatSize());
+    kernel(_params, _input_shape, _input.data(), _filter_shape, _filter.data(), _bias_shape,
+           _bias.data(), _output_shape, output.data(), &ruy_context);
+    EXPECT_EQ(output, expected());
+  }
+}
+
+TEST_P(TransposeConvTest, Int8)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(2);
+
+  // Shift input by zero point, output scale is 1 and output zero point is 1
+  _params.input_offset = -2;
+  _params.weights_offset = 0;
+  _params.output_offset = 1;
+  _params.quantized_activation_min = -128;
+  _params.quantized_activation_max = 127;
+
+  std::vector<int8_t> input(_input.size());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<int8_t>(_input[i] + 2);
+  std::vector<int8_t> filter(_filter.begin(), _filter.end());
+  std::vector<int32_t> bias(_bias.begin(), _bias.end());
+
+  nnfw::cker::TransposeConv kernel;
+  kernel.per_channel_output_multiplier().assign(OC, 1 << 30);
+  kernel.per_channel_output_shift().assign(OC, 1);
+  std::vector<int8_t> output(_output_shape.FlatSize());
+  kernel(_params, _input_shape, input.data(), _filter_shape, filter.data(), _bias_shape,
+         bias.data(), _output_shape, output.data(), &ruy_context);
+
+  std::vector<int8_t> expected_output;
+  for (const auto v : expected())
+    expected_output.push_back(static_cast<int8_t>(std::min(127, std::max(-128, (int)v + 1))));
+  EXPECT_EQ(output, expected_output);
+}
+
+INSTANTIATE_TEST_SUITE_P(StridePaddingKernel, TransposeConvTest,
+                         ::testing::Combine(::testing::Values(1, 2, 3), ::testing::Values(0, 1),
+                                            ::testing::Values(2, 3)));
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/BlockQuantMatMul.h>
+#include <cker/operation/Dequantize.h>
+#include <cker/operation/Erf.h>
+#include <cker/operation/LogSoftMax.h>
+#include <cker/operation/Logistic.h>
+#include <cker/operation/Quantize.h>
+#include <cker/operation/ReduceMean.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/Tanh.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+using nnfw::cker::X86SimdLevel;
+
+// Every kernel is run at each level, a level not supported by the cpu falls back to the
+// detected one. Sizes are not multiples of vector lengths to test tails.
+class X86SimdTest : public ::testing::TestWithParam<X86SimdLevel>
+{
+protected:
+  static constexpr int kSize = 8 * 16 + 13;
+
+  void SetUp() override
+  {
+    nnfw::cker::SetX86SimdLevel(GetParam());
+    _input.resize(kSize);
+    for (int i = 0; i < kSize; ++i)
+      _input[i] = static_cast<float>((i * 37) % 101 - 50) / 8.f;
+  }
+
+  void TearDown() override { nnfw::cker::SetX86SimdLevel(nnfw::cker::DetectX86SimdLevel()); }
+
+  std::vector<float> _input;
+};
+
+} // namespace
+
+TEST_P(X86SimdTest, Activations)
+{
+  const Shape shape{1, kSize};
+  std::vector<float> output(kSize);
+
+  nnfw::cker::Logistic(shape, _input.data(), shape, output.data());
+  for (int i = 0; i < kSize; ++i)
+    EXPECT_NEAR(output[i], 1.f / (1.f + std::exp(-_input[i])), 1e-6f);
+
+  nnfw::cker::Tanh(shape, _input.data(), shape, output.data());
+  for (int i = 0; i < kSize; ++i)
+    EXPECT_NEAR(output[i], std::tanh(_input[i]), 1e-6f);
+
+  nnfw::cker::Erf(shape, _input.data(), shape, output.data());
+  for (int i = 0; i < kSize; ++i)
+    EXPECT_NEAR(output[i], std::erf(_input[i]), 1e-6f);
+}
+
+TEST_P(X86SimdTest, Softmax)
+{
+  constexpr int depth = 47;
+  const Shape shape{3, depth};
+  std::vector<float> output(shape.FlatSize());
+  std::vector<float> expected(shape.FlatSize());
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 0.5;
+  params.axis = -1;
+  nnfw::cker::reference::Softmax(params, shape, _input.data(), shape, expected.data());
+  nnfw::cker::Softmax(params, shape, _input.data(), shape, output.data());
+  for (int i = 0; i < shape.FlatSize(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-6f);
+
+  nnfw::cker::LogSoftmax(params, shape, _input.data(), shape, output.data());
+  for (int i = 0; i < shape.FlatSize(); ++i)
+    EXPECT_NEAR(output[i], std::log(expected[i]), 1e-5f);
+}
+
+// Rows longer than L1 are computed by an online max and sum
+TEST_P(X86SimdTest, SoftmaxLongRows)
+{
+  constexpr int depth = 8192 + 13;
+  const Shape shape{2, depth};
+  std::vector<float> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = _input[i % kSize] + static_cast<float>(i % 7);
+  std::vector<float> output(shape.FlatSize());
+  std::vector<float> expected(shape.FlatSize());
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 0.5;
+  params.axis = -1;
+  nnfw::cker::reference::Softmax(params, shape, input.data(), shape, expected.data());
+  nnfw::cker::Softmax(params, shape, input.data(), shape, output.data());
+  for (int i = 0; i < shape.FlatSize(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-7f);
+
+  nnfw::cker::LogSoftmax(params, shape, input.data(), shape, output.data());
+  for (int i = 0; i < shape.FlatSize(); ++i)
+    EXPECT_NEAR(output[i], std::log(expected[i]), 1e-4f);
+}
+
+TEST_P(X86SimdTest, BinaryArithmetic)
+{
+  const Shape shape{1, kSize};
+  std::vector<float> input2(kSize);
+  for (int i = 0; i < kSize; ++i)
+    input2[i] = _input[kSize - 1 - i] + 0.0625f;
+  std::vector<float> output(kSize);
+
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.float_activation_min = -2.f;
+  params.float_activation_max = 3.f;
+  nnfw::cker::BinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::DIV>(
+    params, shape, _input.data(), shape, input2.data(), shape, output.data());
+  for (int i = 0; i < kSize; ++i)
+    EXPECT_EQ(output[i], std::min(std::max(_input[i] / input2[i], -2.f), 3.f));
+
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  nnfw::cker::BinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::SUB>(
+    params, shape, _input.data(), shape, input2.data(), shape, output.data());
+  for (int i = 0; i < kSize; ++i)
+    EXPECT_EQ(output[i], _input[i] - input2[i]);
+
+  // Scalar broadcast of the second input
+  const Shape scalar_shape{1, 1};
+  const float scalar = 1.5f;
+  nnfw::cker::ProcessBroadcastShapes(shape, scalar_shape, &params);
+  nnfw::cker::optimized::BroadcastDivDispatch(params, shape, _input.data(), scalar_shape, &scalar,
+                                              shape, output.data());
+  for (int i = 0; i < kSize; ++i)
+    EXPECT_EQ(output[i], _input[i] / scalar);
+}
+
+TEST_P(X86SimdTest, Reduce)
+{
+  constexpr int depth = 29;
+  const Shape input_shape{2, 3, 2, depth};
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = _input[i % kSize];
+
+  const Shape output_shape{2, 1, 1, depth};
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::MeanAxis1And2(input_shape, input.data(), output_shape, output.data());
+  for (int b = 0; b < 2; ++b)
+    for (int d = 0; d < depth; ++d)
+    {
+      float sum = 0.f;
+      for (int p = 0; p < 6; ++p)
+        sum += input[(b * 6 + p) * depth + d];
+      EXPECT_NEAR(output[b * depth + d], sum / 6, 1e-5f);
+    }
+
+#if defined(USE_NEON) || defined(USE_X86_SIMD)
+  std::vector<float> sum(input.size() / depth);
+  nnfw::cker::OptimizedReduceSum(input.data(), input_shape, sum.data());
+  for (size_t r = 0; r < sum.size(); ++r)
+  {
+    float expected = 0.f;
+    for (int d = 0; d < depth; ++d)
+      expected += input[r * depth + d];
+    EXPECT_NEAR(sum[r], expected, 1e-4f);
+  }
+#endif
+}
+
+TEST_P(X86SimdTest, Quantize)
+{
+  const Shape shape{1, kSize};
+  // Includes ties which are rounded away from zero, and values out of range
+  std::vector<float> input(kSize);
+  for (int i = 0; i < kSize; ++i)
+    input[i] = (i - kSize / 2) * 0.25f;
+  const float scale = 0.5f;
+
+  std::vector<int8_t> int8_output(kSize);
+  nnfw::cker::Quantize(shape, input.data(), shape, int8_output.data(), scale, -3);
+  for (int i = 0; i < kSize; ++i)
+  {
+    const int32_t expected = static_cast<int32_t>(std::round(input[i] / scale)) - 3;
+    EXPECT_EQ(int8_output[i], std::min(std::max(expected, -128), 127));
+  }
+
+  std::vector<uint8_t> uint8_output(kSize);
+  nnfw::cker::Quantize(shape, input.data(), shape, uint8_output.data(), 0.125f, 100);
+  for (int i = 0; i < kSize; ++i)
+  {
+    const int32_t expected = static_cast<int32_t>(std::round(input[i] / 0.125f)) + 100;
+    EXPECT_EQ(uint8_output[i], std::min(std::max(expected, 0), 255));
+  }
+
+  std::vector<float> output(kSize);
+  nnfw::cker::Dequantize(shape, int8_output.data(), shape, output.data(), scale, -3);
+  for (int i = 0; i < kSize; ++i)
+    EXPECT_EQ(output[i], scale * (int8_output[i] + 3));
+
+  nnfw::cker::Dequantize(shape, uint8_output.data(), shape, output.data(), 0.125f, 100);
+  for (int i = 0; i < kSize; ++i)
+    EXPECT_EQ(output[i], 0.125f * (uint8_output[i] - 100));
+}
+
+TEST_P(X86SimdTest, BlockQuantMatMul)
+{
+  constexpr int depth = 128;
+  constexpr int units = 5;
+  constexpr int blocks_per_row = depth / nnfw::cker::kBlockQuantSize;
+  std::vector<nnfw::cker::BlockQ4_0> q4(units * blocks_per_row);
+  std::vector<nnfw::cker::BlockQ8_0> q8(units * blocks_per_row);
+  for (int b = 0; b < units * blocks_per_row; ++b)
+  {
+    q4[b].scale = q8[b].scale = 0x3000 + b; // about 0.125
+    for (int j = 0; j < nnfw::cker::kBlockQuantSize / 2; ++j)
+      q4[b].quants[j] = static_cast<uint8_t>(b * 13 + j * 29);
+    for (int j = 0; j < nnfw::cker::kBlockQuantSize; ++j)
+      q8[b].quants[j] = static_cast<int8_t>(b * 13 + j * 29);
+  }
+
+  nnfw::cker::FullyConnectedParams params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  // A single row is computed by another kernel than multiple rows
+  for (int batches : {1, 3})
+  {
+    std::vector<float> input_data(batches * depth);
+    for (int i = 0; i < batches * depth; ++i)
+      input_data[i] = _input[i % kSize];
+    std::vector<float> q4_output(batches * units);
+    std::vector<float> q8_output(batches * units);
+    nnfw::cker::FullyConnectedBlockQuant(params, Shape{batches, depth}, input_data.data(),
+                                         Shape{units, depth}, q4.data(), Shape{units}, nullptr,
+                                         Shape{batches, units}, q4_output.data());
+    nnfw::cker::FullyConnectedBlockQuant(params, Shape{batches, depth}, input_data.data(),
+                                         Shape{units, depth}, q8.data(), Shape{units}, nullptr,
+                                         Shape{batches, units}, q8_output.data());
+
+    float row4[depth];
+    float row8[depth];
+    for (int u = 0; u < units; ++u)
+    {
+      for (int b = 0; b < blocks_per_row; ++b)
+      {
+        nnfw::cker::DequantizeBlock(q4[u * blocks_per_row + b],
+                                    row4 + b * nnfw::cker::kBlockQuantSize);
+        nnfw::cker::DequantizeBlock(q8[u * blocks_per_row + b],
+                                    row8 + b * nnfw::cker::kBlockQuantSize);
+      }
+      for (int r = 0; r < batches; ++r)
+      {
+        float expected4 = 0.f;
+        float expected8 = 0.f;
+        for (int k = 0; k < depth; ++k)
+        {
+          expected4 += row4[k] * input_data[r * depth + k];
+          expected8 += row8[k] * input_data[r * depth + k];
+        }
+        EXPECT_NEAR(q4_output[r * units + u], expected4, 1e-3f);
+        EXPECT_NEAR(q8_output[r * units + u], expected8, 1e-2f);
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Levels, X86SimdTest,
+                         ::testing::Values(X86SimdLevel::kNone, X86SimdLevel::kAvx2,
+                                           X86SimdLevel::kAvx512));
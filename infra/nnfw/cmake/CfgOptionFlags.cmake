@@ -45,12 +45,14 @@ option(BUILD_TENSORFLOW_LITE_GPU "Build TensorFlow Lite GPU delegate from the do
 option(BUILD_NPUD "Build NPU daemon" OFF)
 option(ENVVAR_NPUD_CONFIG "Use environment variable for npud configuration" OFF)
 option(BUILD_LOGGING "Build logging runtime" OFF)
+option(BUILD_BATCHER "Build dynamic batching front-end" OFF)
 #
 # Default build configuration for tools
 #
 option(BUILD_KBENCHMARK "Build kernel benchmark tool" OFF)
 option(BUILD_OPENCL_TOOL "Build OpenCL tool" OFF)
 option(BUILD_TFLITE_ACCURACY "Build tflite accuracy tool" OFF)
+option(BUILD_MEM_PLAN_REPORT "Build memory plan report tool" OFF)
 #
 # Default external libraries source download and build configuration
 #
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_BATCHER_BATCHER_H__
+#define __NNFW_BATCHER_BATCHER_H__
+
+#include <nnfw.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace batcher
+{
+
+struct BatcherOptions
+{
+  // Upper bound of requests coalesced into one run
+  uint32_t max_batch_size = 8;
+  // Latency budget : how long the oldest queued request may wait for others to join its batch
+  std::chrono::microseconds max_delay{1000};
+};
+
+struct BatcherStats
+{
+  uint64_t requests = 0;
+  uint64_t batches = 0;
+  uint64_t failed_requests = 0;
+  // Time from submit() to completion, summed over all requests
+  std::chrono::microseconds total_latency{0};
+  std::chrono::microseconds max_latency{0};
+  // Time spent inside nnfw_run, summed over all batches
+  std::chrono::microseconds total_run_time{0};
+
+  double avgBatchSize() const
+  {
+    return batches == 0 ? 0.0 : static_cast<double>(requests) / batches;
+  }
+  double avgLatencyUs() const
+  {
+    return requests == 0 ? 0.0 : static_cast<double>(total_latency.count()) / requests;
+  }
+};
+
+/**
+ * @brief Server-style front-end that coalesces single-sample requests into batched runs
+ *
+ * Every input and output of the model must have the batch on its first dimension. Queued
+ * requests are gathered until either max_batch_size requests are pending or the oldest one has
+ * waited max_delay, then the batch dimension of the inputs is changed to the number of gathered
+ * requests and the session runs once. Outputs are scattered back to the buffers of each request.
+ *
+ * The session must be prepared and must not be used by anyone else while the Batcher is alive.
+ */
+class Batcher
+{
+public:
+  Batcher(nnfw_session *session, const BatcherOptions &options);
+  ~Batcher();
+
+  Batcher(const Batcher &) = delete;
+  Batcher &operator=(const Batcher &) = delete;
+
+public:
+  /**
+   * @brief Queue one sample for inference
+   *
+   * @param inputs  One buffer per model input, each holding inputSampleSize(i) bytes
+   * @param outputs One buffer per model output, each able to hold outputSampleSize(i) bytes
+   * @return Future that becomes ready once outputs are written or the batch failed.
+   *         Buffers must stay valid until then.
+   */
+  std::future<NNFW_STATUS> submit(const std::vector<const void *> &inputs,
+                                  const std::vector<void *> &outputs);
+
+  BatcherStats stats() const;
+
+  uint32_t inputSize() const { return static_cast<uint32_t>(_inputs.size()); }
+  uint32_t outputSize() const { return static_cast<uint32_t>(_outputs.size()); }
+  size_t inputSampleSize(uint32_t index) const { return _inputs.at(index).sample_size; }
+  size_t outputSampleSize(uint32_t index) const { return _outputs.at(index).sample_size; }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Request
+  {
+    std::vector<const void *> inputs;
+    std::vector<void *> outputs;
+    std::promise<NNFW_STATUS> promise;
+    Clock::time_point arrival;
+  };
+
+  struct IOInfo
+  {
+    nnfw_tensorinfo info;
+    size_t sample_size;
+    // Gathered inputs or batched outputs, sized for max_batch_size samples
+    std::vector<uint8_t> staging;
+  };
+
+private:
+  void loop();
+  NNFW_STATUS run(std::vector<Request> &batch);
+  NNFW_STATUS resize(uint32_t batch_size);
+
+private:
+  nnfw_session *_session;
+  BatcherOptions _options;
+  std::vector<IOInfo> _inputs;
+  std::vector<IOInfo> _outputs;
+  uint32_t _current_batch_size = 0;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<Request> _queue;
+  bool _stop = false;
+  BatcherStats _stats;
+
+  std::thread _thread;
+};
+
+} // namespace batcher
+
+#endif // __NNFW_BATCHER_BATCHER_H__
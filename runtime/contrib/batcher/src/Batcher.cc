@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Batcher.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+
+size_t elemSize(NNFW_TYPE type)
+{
+  switch (type)
+  {
+    case NNFW_TYPE_TENSOR_FLOAT32:
+      return sizeof(float);
+    case NNFW_TYPE_TENSOR_INT32:
+      return sizeof(int32_t);
+    case NNFW_TYPE_TENSOR_QUANT8_ASYMM:
+    case NNFW_TYPE_TENSOR_BOOL:
+    case NNFW_TYPE_TENSOR_UINT8:
+    case NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
+      return sizeof(uint8_t);
+    case NNFW_TYPE_TENSOR_INT64:
+      return sizeof(int64_t);
+    case NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED:
+      return sizeof(int16_t);
+    default:
+      throw std::runtime_error{"Batcher: unsupported tensor type"};
+  }
+}
+
+// Bytes of one sample, i.e. of everything but the first (batch) dimension
+size_t sampleSize(const nnfw_tensorinfo &info)
+{
+  if (info.rank < 1)
+    throw std::runtime_error{"Batcher: tensors must have a batch dimension"};
+
+  size_t size = elemSize(info.dtype);
+  for (int32_t i = 1; i < info.rank; ++i)
+    size *= info.dims[i];
+  return size;
+}
+
+void check(NNFW_STATUS status, const char *what)
+{
+  if (status != NNFW_STATUS_NO_ERROR)
+    throw std::runtime_error{std::string{"Batcher: "} + what + " failed"};
+}
+
+} // namespace
+
+namespace batcher
+{
+
+Batcher::Batcher(nnfw_session *session, const BatcherOptions &options)
+  : _session{session}, _options{options}
+{
+  if (_session == nullptr)
+    throw std::runtime_error{"Batcher: session is null"};
+  if (_options.max_batch_size == 0)
+    throw std::runtime_error{"Batcher: max_batch_size must be positive"};
+
+  uint32_t num_inputs = 0;
+  uint32_t num_outputs = 0;
+  check(nnfw_input_size(_session, &num_inputs), "nnfw_input_size");
+  check(nnfw_output_size(_session, &num_outputs), "nnfw_output_size");
+
+  _inputs.resize(num_inputs);
+  for (uint32_t i = 0; i < num_inputs; ++i)
+  {
+    auto &input = _inputs[i];
+    check(nnfw_input_tensorinfo(_session, i, &input.info), "nnfw_input_tensorinfo");
+    input.sample_size = sampleSize(input.info);
+    input.staging.resize(input.sample_size * _options.max_batch_size);
+  }
+
+  _outputs.resize(num_outputs);
+  for (uint32_t i = 0; i < num_outputs; ++i)
+  {
+    auto &output = _outputs[i];
+    check(nnfw_output_tensorinfo(_session, i, &output.info), "nnfw_output_tensorinfo");
+    output.sample_size = sampleSize(output.info);
+    output.staging.resize(output.sample_size * _options.max_batch_size);
+  }
+
+  _thread = std::thread{&Batcher::loop, this};
+}
+
+Batcher::~Batcher()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stop = true;
+  }
+  _cv.notify_one();
+  // Pending requests are still served before the thread exits
+  _thread.join();
+}
+
+std::future<NNFW_STATUS> Batcher::submit(const std::vector<const void *> &inputs,
+                                         const std::vector<void *> &outputs)
+{
+  Request request;
+  auto future = request.promise.get_future();
+
+  if (inputs.size() != _inputs.size() || outputs.size() != _outputs.size())
+  {
+    request.promise.set_value(NNFW_STATUS_ERROR);
+    return future;
+  }
+
+  request.inputs = inputs;
+  request.outputs = outputs;
+  request.arrival = Clock::now();
+
+  size_t queued = 0;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_stop)
+    {
+      request.promise.set_value(NNFW_STATUS_INVALID_STATE);
+      return future;
+    }
+    _queue.emplace_back(std::move(request));
+    queued = _queue.size();
+  }
+
+  // Wake the batching thread only when it has something new to decide on : the first request
+  // starts the deadline, a full batch ends it early
+  if (queued == 1 || queued >= _options.max_batch_size)
+    _cv.notify_one();
+
+  return future;
+}
+
+BatcherStats Batcher::stats() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _stats;
+}
+
+void Batcher::loop()
+{
+  std::vector<Request> batch;
+  batch.reserve(_options.max_batch_size);
+
+  std::unique_lock<std::mutex> lock{_mutex};
+  while (true)
+  {
+    _cv.wait(lock, [&] { return _stop || !_queue.empty(); });
+    if (_queue.empty())
+      break;
+
+    const auto deadline = _queue.front().arrival + _options.max_delay;
+    _cv.wait_until(lock, deadline,
+                   [&] { return _stop || _queue.size() >= _options.max_batch_size; });
+
+    const auto batch_size = std::min<size_t>(_queue.size(), _options.max_batch_size);
+    for (size_t i = 0; i < batch_size; ++i)
+    {
+      batch.emplace_back(std::move(_queue.front()));
+      _queue.pop_front();
+    }
+    lock.unlock();
+
+    const auto run_begin = Clock::now();
+    const auto status = run(batch);
+    const auto done = Clock::now();
+
+    // Stats are updated before completing the requests so that callers which waited for their
+    // futures see this batch in stats()
+    lock.lock();
+    _stats.batches++;
+    _stats.total_run_time +=
+      std::chrono::duration_cast<std::chrono::microseconds>(done - run_begin);
+    for (const auto &request : batch)
+    {
+      const auto latency =
+        std::chrono::duration_cast<std::chrono::microseconds>(done - request.arrival);
+      _stats.requests++;
+      _stats.total_latency += latency;
+      _stats.max_latency = std::max(_stats.max_latency, latency);
+      if (status != NNFW_STATUS_NO_ERROR)
+        _stats.failed_requests++;
+    }
+    lock.unlock();
+
+    for (auto &request : batch)
+      request.promise.set_value(status);
+    batch.clear();
+
+    lock.lock();
+  }
+}
+
+NNFW_STATUS Batcher::resize(uint32_t batch_size)
+{
+  if (batch_size == _current_batch_size)
+    return NNFW_STATUS_NO_ERROR;
+
+  for (uint32_t i = 0; i < _inputs.size(); ++i)
+  {
+    auto info = _inputs[i].info;
+    info.dims[0] = static_cast<int32_t>(batch_size);
+    const auto status = nnfw_set_input_tensorinfo(_session, i, &info);
+    if (status != NNFW_STATUS_NO_ERROR)
+    {
+      // Shapes may be half applied, so force resizing on the next batch
+      _current_batch_size = 0;
+      return status;
+    }
+  }
+
+  _current_batch_size = batch_size;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS Batcher::run(std::vector<Request> &batch)
+{
+  const auto batch_size = static_cast<uint32_t>(batch.size());
+
+  auto status = resize(batch_size);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  // A single request needs neither gathering nor scattering : bind its buffers directly
+  const bool direct = (batch_size == 1);
+
+  for (uint32_t i = 0; i < _inputs.size() && status == NNFW_STATUS_NO_ERROR; ++i)
+  {
+    auto &input = _inputs[i];
+    const void *buffer = batch[0].inputs[i];
+    if (!direct)
+    {
+      for (uint32_t b = 0; b < batch_size; ++b)
+        std::memcpy(input.staging.data() + b * input.sample_size, batch[b].inputs[i],
+                    input.sample_size);
+      buffer = input.staging.data();
+    }
+    status = nnfw_set_input(_session, i, input.info.dtype, buffer,
+                            input.sample_size * batch_size);
+  }
+
+  for (uint32_t i = 0; i < _outputs.size() && status == NNFW_STATUS_NO_ERROR; ++i)
+  {
+    auto &output = _outputs[i];
+    void *buffer = direct ? batch[0].outputs[i] : output.staging.data();
+    status = nnfw_set_output(_session, i, output.info.dtype, buffer,
+                             output.sample_size * batch_size);
+  }
+
+  if (status == NNFW_STATUS_NO_ERROR)
+    status = nnfw_run(_session);
+
+  if (status != NNFW_STATUS_NO_ERROR || direct)
+    return status;
+
+  for (uint32_t i = 0; i < _outputs.size(); ++i)
+  {
+    const auto &output = _outputs[i];
+
+    // The batch dimension must have been propagated to every output
+    nnfw_tensorinfo info;
+    status = nnfw_output_tensorinfo(_session, i, &info);
+    if (status != NNFW_STATUS_NO_ERROR)
+      return status;
+    if (info.rank < 1 || info.dims[0] != static_cast<int32_t>(batch_size))
+      return NNFW_STATUS_ERROR;
+
+    for (uint32_t b = 0; b < batch_size; ++b)
+      std::memcpy(batch[b].outputs[i], output.staging.data() + b * output.sample_size,
+                  output.sample_size);
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+} // namespace batcher
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Open-loop load generator for Batcher
+//
+// Requests arrive as a Poisson process of the given rate, each carrying one random sample.
+// Running it with --max_batch 1 gives the unbatched baseline for the same load.
+
+#include "Batcher.h"
+
+#include <arser/arser.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct Pending
+{
+  std::future<NNFW_STATUS> future;
+  Clock::time_point arrival;
+  std::vector<std::vector<uint8_t>> outputs;
+};
+
+std::vector<uint8_t> randomSample(nnfw_session *session, uint32_t index, size_t size,
+                                  std::mt19937 &gen)
+{
+  nnfw_tensorinfo info;
+  nnfw_input_tensorinfo(session, index, &info);
+
+  std::vector<uint8_t> sample(size);
+  if (info.dtype == NNFW_TYPE_TENSOR_FLOAT32)
+  {
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    auto data = reinterpret_cast<float *>(sample.data());
+    std::generate(data, data + size / sizeof(float), [&] { return dist(gen); });
+  }
+  else
+  {
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::generate(sample.begin(), sample.end(), [&] { return static_cast<uint8_t>(dist(gen)); });
+  }
+  return sample;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  arser::Arser arser{"batcher_load_gen"};
+  arser.add_argument("nnpackage").type(arser::DataType::STR).help("nnpackage path");
+  arser.add_argument("--backends")
+    .type(arser::DataType::STR)
+    .default_value("cpu")
+    .help("Backends to use");
+  arser.add_argument("--max_batch")
+    .type(arser::DataType::INT32)
+    .default_value(8)
+    .help("Maximum number of requests in one run");
+  arser.add_argument("--max_delay_us")
+    .type(arser::DataType::INT32)
+    .default_value(1000)
+    .help("Latency budget(us) a request may wait for its batch to fill");
+  arser.add_argument("--rate")
+    .type(arser::DataType::INT32)
+    .default_value(1000)
+    .help("Mean arrival rate (requests per second)");
+  arser.add_argument("--requests")
+    .type(arser::DataType::INT32)
+    .default_value(1000)
+    .help("The number of requests to send");
+
+  try
+  {
+    arser.parse(argc, argv);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << e.what() << std::endl;
+    std::cout << arser;
+    return 255;
+  }
+
+  const auto package = arser.get<std::string>("nnpackage");
+  const auto backends = arser.get<std::string>("--backends");
+  const auto rate = arser.get<int>("--rate");
+  const auto num_requests = arser.get<int>("--requests");
+
+  batcher::BatcherOptions options;
+  options.max_batch_size = static_cast<uint32_t>(arser.get<int>("--max_batch"));
+  options.max_delay = std::chrono::microseconds{arser.get<int>("--max_delay_us")};
+
+  if (rate <= 0 || num_requests <= 0 || options.max_batch_size == 0)
+  {
+    std::cerr << "--rate, --requests and --max_batch must be positive" << std::endl;
+    return 255;
+  }
+
+  nnfw_session *session = nullptr;
+  if (nnfw_create_session(&session) != NNFW_STATUS_NO_ERROR ||
+      nnfw_load_model_from_file(session, package.c_str()) != NNFW_STATUS_NO_ERROR ||
+      nnfw_set_available_backends(session, backends.c_str()) != NNFW_STATUS_NO_ERROR ||
+      nnfw_prepare(session) != NNFW_STATUS_NO_ERROR)
+  {
+    std::cerr << "Failed to prepare " << package << std::endl;
+    nnfw_close_session(session);
+    return 255;
+  }
+
+  std::vector<double> latencies;
+  uint64_t failed = 0;
+  Clock::duration elapsed{};
+  batcher::BatcherStats stats;
+  {
+    batcher::Batcher batcher{session, options};
+
+    // All requests share one read-only random sample per input
+    std::mt19937 gen{0};
+    std::vector<std::vector<uint8_t>> samples;
+    std::vector<const void *> inputs;
+    for (uint32_t i = 0; i < batcher.inputSize(); ++i)
+      samples.emplace_back(randomSample(session, i, batcher.inputSampleSize(i), gen));
+    for (const auto &sample : samples)
+      inputs.emplace_back(sample.data());
+
+    // Requests complete in submission order, so a single collector measures their latency
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::unique_ptr<Pending>> pending;
+    latencies.reserve(num_requests);
+    std::thread collector{[&] {
+      for (int n = 0; n < num_requests; ++n)
+      {
+        std::unique_ptr<Pending> request;
+        {
+          std::unique_lock<std::mutex> lock{mutex};
+          cv.wait(lock, [&] { return !pending.empty(); });
+          request = std::move(pending.front());
+          pending.pop_front();
+        }
+        if (request->future.get() != NNFW_STATUS_NO_ERROR)
+          failed++;
+        latencies.emplace_back(
+          std::chrono::duration<double, std::micro>(Clock::now() - request->arrival).count());
+      }
+    }};
+
+    std::exponential_distribution<double> interval{static_cast<double>(rate)};
+    const auto begin = Clock::now();
+    auto next = begin;
+    for (int n = 0; n < num_requests; ++n)
+    {
+      next += std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(interval(gen)));
+      std::this_thread::sleep_until(next);
+
+      auto request = std::make_unique<Pending>();
+      std::vector<void *> outputs;
+      for (uint32_t i = 0; i < batcher.outputSize(); ++i)
+      {
+        request->outputs.emplace_back(batcher.outputSampleSize(i));
+        outputs.emplace_back(request->outputs.back().data());
+      }
+      request->arrival = Clock::now();
+      request->future = batcher.submit(inputs, outputs);
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+        pending.emplace_back(std::move(request));
+      }
+      cv.notify_one();
+    }
+
+    collector.join();
+    elapsed = Clock::now() - begin;
+    stats = batcher.stats();
+  }
+  nnfw_close_session(session);
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&](double p) {
+    return latencies[std::min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()))];
+  };
+  const auto seconds = std::chrono::duration<double>(elapsed).count();
+
+  std::cout << "requests        : " << stats.requests << " (failed " << failed << ")\n";
+  std::cout << "batches         : " << stats.batches << " (avg size " << stats.avgBatchSize()
+            << ")\n";
+  std::cout << "throughput      : " << stats.requests / seconds << " req/s\n";
+  std::cout << "avg run time    : "
+            << (stats.batches ? stats.total_run_time.count() / stats.batches : 0) << " us\n";
+  std::cout << "latency avg     : " << stats.avgLatencyUs() << " us\n";
+  std::cout << "latency p50/p99 : " << percentile(0.5) << " / " << percentile(0.99) << " us\n";
+  std::cout << "latency max     : " << stats.max_latency.count() << " us" << std::endl;
+
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file ParallelExecutor scheduling overhead benchmark
+ *
+ * Each benchmark runs a chain of NUM_OPS empty ops through exec::ThreadPool, so the measured
+ * time divided by NUM_OPS is the scheduling overhead per op.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <exec/ThreadPool.h>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+using namespace onert::exec;
+
+//
+// Parameters
+//
+NONIUS_PARAM(NUM_OPS, 1000);
+NONIUS_PARAM(NUM_WORKERS, 1);
+
+//
+// Helpers
+//
+namespace
+{
+
+class LambdaFunction : public IFunction
+{
+public:
+  LambdaFunction(const std::function<void()> &fn) : _fn{fn} {}
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+} // namespace
+
+//
+// Implementations
+//
+// The main thread dispatches every op after its producer notifies it
+NONIUS_BENCHMARK("ThreadPool(dispatch from main thread)", [](nonius::chronometer meter) {
+  auto num_ops = meter.param<NUM_OPS>();
+  ThreadPool pool{static_cast<uint32_t>(meter.param<NUM_WORKERS>())};
+
+  std::mutex mu;
+  std::condition_variable cv;
+  bool done = false;
+  LambdaFunction op{[&]() {
+    {
+      std::lock_guard<std::mutex> lock{mu};
+      done = true;
+    }
+    cv.notify_all();
+  }};
+
+  meter.measure([&](int) {
+    for (int i = 0; i < num_ops; ++i)
+    {
+      pool.enqueue(&op);
+
+      std::unique_lock<std::mutex> lock{mu};
+      cv.wait(lock, [&] { return done; });
+      done = false;
+    }
+  });
+
+  pool.finish();
+})
+
+// The worker that finished an op dispatches its successor by itself
+NONIUS_BENCHMARK("ThreadPool(dispatch from producer)", [](nonius::chronometer meter) {
+  auto num_ops = meter.param<NUM_OPS>();
+  ThreadPool pool{static_cast<uint32_t>(meter.param<NUM_WORKERS>())};
+
+  std::mutex mu;
+  std::condition_variable cv;
+  bool done = false;
+  int remaining = 0;
+  LambdaFunction op{[&]() {
+    if (--remaining > 0)
+    {
+      pool.enqueue(&op);
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock{mu};
+      done = true;
+    }
+    cv.notify_all();
+  }};
+
+  meter.measure([&](int) {
+    remaining = num_ops;
+    pool.enqueue(&op);
+
+    std::unique_lock<std::mutex> lock{mu};
+    cv.wait(lock, [&] { return done; });
+    done = false;
+  });
+
+  pool.finish();
+})
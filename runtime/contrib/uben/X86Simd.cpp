@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file cker x86 SIMD benchmark
+ *
+ * Compares portable kernels with AVX2 and AVX-512 ones. Levels not supported by the cpu fall
+ * back to the detected level.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Dequantize.h>
+#include <cker/operation/Logistic.h>
+#include <cker/operation/Quantize.h>
+#include <cker/operation/ReduceMean.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/Tanh.h>
+
+#include <vector>
+
+using nnfw::cker::X86SimdLevel;
+
+//
+// Parameters
+//
+NONIUS_PARAM(LEN, 1 << 16);
+NONIUS_PARAM(DEPTH, 1000);
+
+namespace
+{
+
+std::vector<float> MakeInput(int len)
+{
+  std::vector<float> input(len);
+  for (int i = 0; i < len; ++i)
+    input[i] = static_cast<float>((i * 37) % 101 - 50) / 16.f;
+  return input;
+}
+
+template <typename Fn> void Measure(nonius::chronometer &meter, X86SimdLevel level, Fn fn)
+{
+  nnfw::cker::SetX86SimdLevel(level);
+  meter.measure([&](int) { fn(); });
+  nnfw::cker::SetX86SimdLevel(nnfw::cker::DetectX86SimdLevel());
+}
+
+void Logistic(nonius::chronometer meter, X86SimdLevel level)
+{
+  auto len = meter.param<LEN>();
+  nnfw::cker::Shape shape{1, len};
+  auto input = MakeInput(len);
+  std::vector<float> output(len);
+
+  Measure(meter, level,
+          [&]() { nnfw::cker::Logistic(shape, input.data(), shape, output.data()); });
+}
+
+void Tanh(nonius::chronometer meter, X86SimdLevel level)
+{
+  auto len = meter.param<LEN>();
+  nnfw::cker::Shape shape{1, len};
+  auto input = MakeInput(len);
+  std::vector<float> output(len);
+
+  Measure(meter, level, [&]() { nnfw::cker::Tanh(shape, input.data(), shape, output.data()); });
+}
+
+void Softmax(nonius::chronometer meter, X86SimdLevel level)
+{
+  auto len = meter.param<LEN>();
+  auto depth = meter.param<DEPTH>();
+  nnfw::cker::Shape shape{len / depth, depth};
+  auto input = MakeInput(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.0;
+
+  Measure(meter, level,
+          [&]() { nnfw::cker::Softmax(params, shape, input.data(), shape, output.data()); });
+}
+
+void Mul(nonius::chronometer meter, X86SimdLevel level)
+{
+  auto len = meter.param<LEN>();
+  nnfw::cker::Shape shape{1, len};
+  auto input1 = MakeInput(len);
+  auto input2 = MakeInput(len);
+  std::vector<float> output(len);
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.float_activation_min = 0.f;
+  params.float_activation_max = 6.f;
+
+  Measure(meter, level, [&]() {
+    nnfw::cker::BinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::MUL>(
+      params, shape, input1.data(), shape, input2.data(), shape, output.data());
+  });
+}
+
+void Mean(nonius::chronometer meter, X86SimdLevel level)
+{
+  auto len = meter.param<LEN>();
+  nnfw::cker::Shape input_shape{1, 16, len / 16 / 64, 64};
+  nnfw::cker::Shape output_shape{1, 1, 1, 64};
+  auto input = MakeInput(input_shape.FlatSize());
+  std::vector<float> output(64);
+
+  Measure(meter, level, [&]() {
+    nnfw::cker::MeanAxis1And2(input_shape, input.data(), output_shape, output.data());
+  });
+}
+
+void QuantizeInt8(nonius::chronometer meter, X86SimdLevel level)
+{
+  auto len = meter.param<LEN>();
+  nnfw::cker::Shape shape{1, len};
+  auto input = MakeInput(len);
+  std::vector<int8_t> quantized(len);
+  std::vector<float> output(len);
+
+  Measure(meter, level, [&]() {
+    nnfw::cker::Quantize(shape, input.data(), shape, quantized.data(), 0.03f, 1);
+    nnfw::cker::Dequantize(shape, quantized.data(), shape, output.data(), 0.03f, 1);
+  });
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("cker::Logistic(float) portable",
+                 [](nonius::chronometer meter) { Logistic(meter, X86SimdLevel::kNone); })
+NONIUS_BENCHMARK("cker::Logistic(float) avx2",
+                 [](nonius::chronometer meter) { Logistic(meter, X86SimdLevel::kAvx2); })
+NONIUS_BENCHMARK("cker::Logistic(float) avx512",
+                 [](nonius::chronometer meter) { Logistic(meter, X86SimdLevel::kAvx512); })
+
+NONIUS_BENCHMARK("cker::Tanh(float) portable",
+                 [](nonius::chronometer meter) { Tanh(meter, X86SimdLevel::kNone); })
+NONIUS_BENCHMARK("cker::Tanh(float) avx2",
+                 [](nonius::chronometer meter) { Tanh(meter, X86SimdLevel::kAvx2); })
+NONIUS_BENCHMARK("cker::Tanh(float) avx512",
+                 [](nonius::chronometer meter) { Tanh(meter, X86SimdLevel::kAvx512); })
+
+NONIUS_BENCHMARK("cker::Softmax(float) portable",
+                 [](nonius::chronometer meter) { Softmax(meter, X86SimdLevel::kNone); })
+NONIUS_BENCHMARK("cker::Softmax(float) avx2",
+                 [](nonius::chronometer meter) { Softmax(meter, X86SimdLevel::kAvx2); })
+NONIUS_BENCHMARK("cker::Softmax(float) avx512",
+                 [](nonius::chronometer meter) { Softmax(meter, X86SimdLevel::kAvx512); })
+
+NONIUS_BENCHMARK("cker::Mul(float, relu6) portable",
+                 [](nonius::chronometer meter) { Mul(meter, X86SimdLevel::kNone); })
+NONIUS_BENCHMARK("cker::Mul(float, relu6) avx2",
+                 [](nonius::chronometer meter) { Mul(meter, X86SimdLevel::kAvx2); })
+NONIUS_BENCHMARK("cker::Mul(float, relu6) avx512",
+                 [](nonius::chronometer meter) { Mul(meter, X86SimdLevel::kAvx512); })
+
+NONIUS_BENCHMARK("cker::MeanAxis1And2(float) portable",
+                 [](nonius::chronometer meter) { Mean(meter, X86SimdLevel::kNone); })
+NONIUS_BENCHMARK("cker::MeanAxis1And2(float) avx2",
+                 [](nonius::chronometer meter) { Mean(meter, X86SimdLevel::kAvx2); })
+NONIUS_BENCHMARK("cker::MeanAxis1And2(float) avx512",
+                 [](nonius::chronometer meter) { Mean(meter, X86SimdLevel::kAvx512); })
+
+NONIUS_BENCHMARK("cker::Quantize+Dequantize(int8) portable",
+                 [](nonius::chronometer meter) { QuantizeInt8(meter, X86SimdLevel::kNone); })
+NONIUS_BENCHMARK("cker::Quantize+Dequantize(int8) avx2",
+                 [](nonius::chronometer meter) { QuantizeInt8(meter, X86SimdLevel::kAvx2); })
+NONIUS_BENCHMARK("cker::Quantize+Dequantize(int8) avx512",
+                 [](nonius::chronometer meter) { QuantizeInt8(meter, X86SimdLevel::kAvx512); })
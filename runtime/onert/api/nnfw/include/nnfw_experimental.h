@@ -558,6 +558,84 @@ NNFW_STATUS nnfw_set_codegen_model_path(nnfw_session *session, const char *path)
  */
 NNFW_STATUS nnfw_codegen(nnfw_session *session, const char *target, NNFW_CODEGEN_PREF pref);
 
+//////////////////////////////////////////////
+// APIs for shared session
+//////////////////////////////////////////////
+
+/**
+ * @brief     Create a new session which shares the model loaded on another session
+ *
+ * The new session copies the graphs of the model loaded on @c base instead of loading it again.
+ * The copied graphs share constant tensors (weights) with @c base, so weights are kept in memory
+ * only once. Each session is prepared independently and has its own graphs, executors and
+ * intermediate tensors, so sessions sharing a model can have different input shapes and can run
+ * concurrently on different threads.
+ *
+ * The new session copies the backend settings and input shapes of @c base, and it is in the same
+ * state as a session on which a model is just loaded. Call {@link nnfw_prepare} on it before
+ * running.
+ *
+ * @note  @c base must have loaded a model and must not be prepared yet.
+ *        Sessions sharing a model must be prepared one at a time since backends are loaded
+ *        globally on preparation, but can run concurrently.
+ *
+ * @param[in]  base    The session whose model is shared
+ * @param[out] session The session to be created
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_create_shared_session(nnfw_session *base, nnfw_session **session);
+
+//////////////////////////////////////////////
+// APIs for stateful tensors
+//////////////////////////////////////////////
+
+/**
+ * @brief     Bind a model input and a model output as a state which lives across runs
+ *
+ * A state is a buffer owned by the session, e.g. the key or value cache of a decoder. It holds as
+ * many entries as the input has at @c axis. On each {@link nnfw_run}, the whole buffer is given to
+ * the input with its static shape, and the number of entries cached so far is given to the input
+ * at @c length_index, so the model should mask entries from that position on. After the run, the
+ * entries of the output are appended to the buffer. As input shapes do not change between runs,
+ * shape inference does not run for each token, and only new entries are copied.
+ *
+ * Dimensions of the input before @c axis should be 1, and the ones from @c axis should be known.
+ * The output should have the same type and rank as the input. The length input should be a
+ * scalar of INT32, and states sharing it should append the same number of entries. The first run
+ * sees the length of 0. Buffers set by the user for the bound indices are ignored.
+ *
+ * @note  This function should be called after {@link nnfw_prepare}.
+ *
+ * @param[in] session      The session to bind a state
+ * @param[in] input_index  Input index of cached entries
+ * @param[in] output_index Output index of entries appended by a run
+ * @param[in] axis         Axis of entries, e.g. the sequence axis
+ * @param[in] length_index Input index which gets the number of cached entries
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_bind_state(nnfw_session *session, uint32_t input_index, uint32_t output_index,
+                            uint32_t axis, uint32_t length_index);
+
+/**
+ * @brief     Drop cached entries of all states, e.g. to start a new sequence
+ *
+ * Buffers of states are kept, so the next run does not allocate them again.
+ *
+ * @param[in] session The session whose states are reset
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_reset_states(nnfw_session *session);
+
+/**
+ * @brief     Get the number of entries cached in a state
+ *
+ * @param[in]  session     The session which has the state
+ * @param[in]  input_index Input index the state is bound to
+ * @param[out] length      The number of cached entries
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_state_length(nnfw_session *session, uint32_t input_index, uint32_t *length);
+
 //////////////////////////////////////////////
 // APIs for configuration
 //////////////////////////////////////////////
@@ -572,6 +650,11 @@ typedef enum
    * TODO: Use workspace
    */
   NNFW_PREPARE_CONFIG_PROFILE,
+  /**
+   * Linearize operations to lower peak memory of intermediate tensors (not require value setting)
+   * Parallel branches are ordered so that the one freeing the most memory runs first.
+   */
+  NNFW_PREPARE_CONFIG_MEMORY_AWARE_ORDER,
 } NNFW_PREPARE_CONFIG;
 
 /**
@@ -508,6 +508,35 @@ NNFW_STATUS nnfw_codegen(nnfw_session *session, const char *target, NNFW_CODEGEN
   return session->codegen(target, pref);
 }
 
+// Shared session
+
+NNFW_STATUS nnfw_create_shared_session(nnfw_session *base, nnfw_session **session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(base);
+  return nnfw_session::create_shared(base, session);
+}
+
+// Stateful tensors
+
+NNFW_STATUS nnfw_bind_state(nnfw_session *session, uint32_t input_index, uint32_t output_index,
+                            uint32_t axis, uint32_t length_index)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->bind_state(input_index, output_index, axis, length_index);
+}
+
+NNFW_STATUS nnfw_reset_states(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->reset_states();
+}
+
+NNFW_STATUS nnfw_get_state_length(nnfw_session *session, uint32_t input_index, uint32_t *length)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_state_length(input_index, length);
+}
+
 // Configuration
 
 NNFW_STATUS nnfw_set_prepare_config(nnfw_session *session, const NNFW_PREPARE_CONFIG key,
@@ -29,6 +29,7 @@
 #include "exporter/CircleExporter.h"
 #include "exporter/train/CheckpointExporter.h"
 #include "json/json.h"
+#include "ir/Graph.h"
 #include "ir/NNPkg.h"
 #include "ir/OpCode.h"
 #include "ir/train/TrainingInfo.h"
@@ -220,6 +221,33 @@ loadTrainingInfo(const std::shared_ptr<onert::ir::Model> &model)
   return std::make_unique<onert::ir::train::TrainingInfo>();
 }
 
+/**
+ * @brief Clone the graphs of nnpkg so that a session can modify them on its own
+ *
+ * Operations and operands are copied, but the operands keep sharing their constant data
+ * (ir::Data) with the original, so weights are not duplicated.
+ * Metadata is not copied since it is consumed on loading.
+ */
+std::shared_ptr<onert::ir::NNPkg> cloneNNPkg(const onert::ir::NNPkg &nnpkg)
+{
+  auto cloned = std::make_shared<onert::ir::NNPkg>(nnpkg);
+  for (uint16_t i = 0; i < nnpkg.model_count(); ++i)
+  {
+    const auto model_index = onert::ir::ModelIndex{i};
+    const auto &model = nnpkg.model(model_index);
+    auto cloned_model = std::make_shared<onert::ir::Model>();
+    model->iterate([&](const onert::ir::SubgraphIndex &subg_index, const onert::ir::IGraph &subg) {
+      const auto graph = dynamic_cast<const onert::ir::Graph *>(&subg);
+      if (graph == nullptr)
+        throw std::runtime_error{"Only ir::Graph can be shared between sessions"};
+      cloned_model->push(subg_index, std::make_shared<onert::ir::Graph>(*graph));
+    });
+    cloned_model->bindKernelBuilder(model->getKernelBuilder());
+    cloned->model(model_index) = cloned_model;
+  }
+  return cloned;
+}
+
 uint64_t getBufSize(const nnfw_tensorinfo *info)
 {
   static int elmsize[] = {
@@ -277,6 +305,50 @@ NNFW_STATUS nnfw_session::create(nnfw_session **session)
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::create_shared(nnfw_session *base, nnfw_session **session)
+{
+  if (session == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  // The model is released on prepare, so it can be shared only before that
+  if (!base->isStateModelLoaded())
+  {
+    std::cerr << "Error during shared session creation : base session should have loaded a model "
+                 "and not be prepared yet"
+              << std::endl;
+    *session = nullptr;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    auto new_session = std::unique_ptr<nnfw_session>(new nnfw_session());
+    // Each session compiles and reshapes its own graphs, which share constant data only
+    new_session->_nnpkg = cloneNNPkg(*base->_nnpkg);
+    new_session->_kernel_registry = base->_kernel_registry;
+    *new_session->_coptions = *base->_coptions;
+    if (base->_train_info)
+      new_session->_train_info =
+        std::make_unique<onert::ir::train::TrainingInfo>(*base->_train_info);
+    new_session->_model_path = base->_model_path;
+    new_session->_state = State::MODEL_LOADED;
+    *session = new_session.release();
+  }
+  catch (const std::bad_alloc &e)
+  {
+    std::cerr << "Error during shared session creation" << std::endl;
+    *session = nullptr;
+    return NNFW_STATUS_OUT_OF_MEMORY;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during shared session initialization : " << e.what() << std::endl;
+    *session = nullptr;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
 nnfw_session::~nnfw_session() = default;
 
 NNFW_STATUS nnfw_session::load_circle_from_buffer(uint8_t *buffer, size_t size)
@@ -935,6 +1007,14 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     _coptions->he_profiling_mode = toBool(value);
   }
+  else if (skey == config::MEMORY_AWARE_ORDER)
+  {
+    _coptions->memory_aware_order = toBool(value);
+  }
+  else if (skey == config::COMPILATION_CACHE_DIR)
+  {
+    _coptions->compilation_cache_dir = value;
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -1976,6 +2056,74 @@ NNFW_STATUS nnfw_session::codegen(const char *target, NNFW_CODEGEN_PREF pref)
   }
 }
 
+NNFW_STATUS nnfw_session::bind_state(uint32_t input_index, uint32_t output_index, uint32_t axis,
+                                     uint32_t length_index)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::bind_state : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (input_index >= getInputSize() || output_index >= getOutputSize() ||
+      length_index >= getInputSize())
+  {
+    std::cerr << "Error during nnfw_session::bind_state : index is out of range" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    _execution->bindState(onert::ir::IOIndex(input_index), onert::ir::IOIndex(output_index), axis,
+                          onert::ir::IOIndex(length_index));
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::bind_state : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::reset_states()
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::reset_states : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  _execution->resetStates();
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_state_length(uint32_t input_index, uint32_t *length)
+{
+  if (length == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::get_state_length : length is null pointer"
+              << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::get_state_length : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    *length = _execution->getStateLength(onert::ir::IOIndex(input_index));
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::get_state_length : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::set_prepare_config(const NNFW_PREPARE_CONFIG key, const char *)
 {
   if (!isStateModelLoaded())
@@ -1989,6 +2137,9 @@ NNFW_STATUS nnfw_session::set_prepare_config(const NNFW_PREPARE_CONFIG key, cons
     case NNFW_PREPARE_CONFIG_PROFILE:
       _coptions->he_profiling_mode = true;
       break;
+    case NNFW_PREPARE_CONFIG_MEMORY_AWARE_ORDER:
+      _coptions->memory_aware_order = true;
+      break;
     default:
       return NNFW_STATUS_ERROR;
   }
@@ -2005,6 +2156,7 @@ NNFW_STATUS nnfw_session::reset_prepare_config()
   }
 
   _coptions->he_profiling_mode = false;
+  _coptions->memory_aware_order = false;
 
   return NNFW_STATUS_NO_ERROR;
 }
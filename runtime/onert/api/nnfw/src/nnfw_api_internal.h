@@ -116,6 +116,12 @@ public:
    * @note  Use factory instead of constructor to get status
    */
   static NNFW_STATUS create(nnfw_session **session);
+  /**
+   * @brief Factory method. It creates nnfw_session which shares the model loaded on base
+   *
+   * @note  base should be in MODEL_LOADED state, and so is the new session
+   */
+  static NNFW_STATUS create_shared(nnfw_session *base, nnfw_session **session);
 
 private:
   nnfw_session();
@@ -194,6 +200,11 @@ public:
   NNFW_STATUS set_codegen_model_path(const char *path);
   NNFW_STATUS codegen(const char *target, NNFW_CODEGEN_PREF pref);
 
+  NNFW_STATUS bind_state(uint32_t input_index, uint32_t output_index, uint32_t axis,
+                         uint32_t length_index);
+  NNFW_STATUS reset_states();
+  NNFW_STATUS get_state_length(uint32_t input_index, uint32_t *length);
+
   NNFW_STATUS set_prepare_config(const NNFW_PREPARE_CONFIG key, const char *value);
   NNFW_STATUS reset_prepare_config();
   NNFW_STATUS set_execute_config(const NNFW_RUN_CONFIG key, const char *value);
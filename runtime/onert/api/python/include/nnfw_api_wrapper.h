@@ -15,6 +15,10 @@
  */
 
 #include "nnfw.h"
+#include "nnfw_experimental.h"
+
+#include <memory>
+#include <vector>
 
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
@@ -114,10 +118,20 @@ class NNFW_SESSION
 private:
   nnfw_session *session;
 
+  NNFW_SESSION(nnfw_session *session) : session(session) {}
+
 public:
   NNFW_SESSION(const char *package_file_path, const char *backends);
   ~NNFW_SESSION();
 
+  /**
+   * @brief   Create sessions which share one loaded model, and prepare all of them
+   *
+   * Weights are kept in memory only once, and each session can run on its own thread.
+   */
+  static std::vector<std::unique_ptr<NNFW_SESSION>>
+  create_shared(const char *package_file_path, const char *backends, uint32_t count);
+
   void close_session();
   void set_input_tensorinfo(uint32_t index, const tensorinfo *tensor_info);
   void run();
@@ -163,6 +163,33 @@ NNFW_SESSION::NNFW_SESSION(const char *package_file_path, const char *backends)
   ensure_status(nnfw_set_available_backends(this->session, backends));
   ensure_status(nnfw_prepare(this->session));
 }
+std::vector<std::unique_ptr<NNFW_SESSION>>
+NNFW_SESSION::create_shared(const char *package_file_path, const char *backends, uint32_t count)
+{
+  std::vector<std::unique_ptr<NNFW_SESSION>> sessions;
+  if (count == 0)
+    return sessions;
+
+  nnfw_session *base = nullptr;
+  ensure_status(nnfw_create_session(&base));
+  sessions.emplace_back(new NNFW_SESSION(base));
+  ensure_status(nnfw_load_model_from_file(base, package_file_path));
+  ensure_status(nnfw_set_available_backends(base, backends));
+
+  // Sessions should be created before the base is prepared
+  for (uint32_t i = 1; i < count; ++i)
+  {
+    nnfw_session *shared = nullptr;
+    ensure_status(nnfw_create_shared_session(base, &shared));
+    sessions.emplace_back(new NNFW_SESSION(shared));
+  }
+
+  // Sessions sharing a model are prepared one at a time
+  for (auto &&s : sessions)
+    ensure_status(nnfw_prepare(s->session));
+
+  return sessions;
+}
 NNFW_SESSION::~NNFW_SESSION()
 {
   if (session)
@@ -42,13 +42,26 @@ PYBIND11_MODULE(libnnfw_api_pybind, m)
       "\t\tMultiple backends can be set and they must be separated by a semicolon "
       "(ex: \"acl_cl;cpu\")\n"
       "\t\tAmong the multiple backends, the 1st element is used as the default backend.")
+    .def_static("create_shared", &NNFW_SESSION::create_shared, py::arg("package_file_path"),
+                py::arg("backends"), py::arg("count"),
+                "Create sessions which share one model loaded from nnpackage file or directory, "
+                "and prepare all of them to be ready for inference\n"
+                "Weights are loaded only once, and each session can run concurrently on its own "
+                "thread.\n"
+                "Parameters:\n"
+                "\tpackage_file_path (str): Path to the nnpackage file or unzipped directory to be "
+                "loaded\n"
+                "\tbackends (str): Available backends on which nnfw uses\n"
+                "\tcount (int): Number of sessions to create\n"
+                "Returns:\n"
+                "\tlist: Prepared sessions")
     .def("set_input_tensorinfo", &NNFW_SESSION::set_input_tensorinfo, py::arg("index"),
          py::arg("tensor_info"),
          "Set input model's tensor info for resizing.\n"
          "Parameters:\n"
          "\tindex (int): Index of input to be set (0-indexed)\n"
          "\ttensor_info (tensorinfo): Tensor info to be set")
-    .def("run", &NNFW_SESSION::run, "Run inference")
+    .def("run", &NNFW_SESSION::run, py::call_guard<py::gil_scoped_release>(), "Run inference")
     .def("run_async", &NNFW_SESSION::run_async, "Run inference asynchronously")
     .def("wait", &NNFW_SESSION::wait, "Wait for asynchronous run to finish")
     .def(
@@ -1134,12 +1134,17 @@ void KernelGenerator::visit(const ir::operation::TransposeConv &node)
   const auto ofm_index{node.getOutputs().at(0)};
   const auto ker_index{node.getInputs().at(ir::operation::TransposeConv::Input::KERNEL)};
   const auto ifm_index{node.getInputs().at(ir::operation::TransposeConv::Input::INPUT)};
+  // BIAS is optional, and may be absent from inputs or undefined
+  const auto bias_index{node.getInputs().size() > ir::operation::TransposeConv::Input::BIAS
+                          ? node.getInputs().at(ir::operation::TransposeConv::Input::BIAS)
+                          : ir::OperandIndex{}};
 
   const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature();
   const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature();
   const auto ker_shape = _ctx.at(ker_index).shape().asFeature();
 
   const auto stride = node.param().stride;
+  const auto activation = node.param().activation;
 
   assert((node.param().padding.type == ir::PaddingType::SAME) ||
          (node.param().padding.type == ir::PaddingType::VALID));
@@ -1157,15 +1162,17 @@ void KernelGenerator::visit(const ir::operation::TransposeConv &node)
   auto ofm_tensor = _tensor_reg->getAclTensor(ofm_index);
   auto ifm_tensor = _tensor_reg->getAclTensor(ifm_index);
   auto ker_tensor = _tensor_reg->getAclTensor(ker_index);
+  auto bias_handle = bias_index.valid() ? _tensor_reg->getAclTensor(bias_index)->handle() : nullptr;
 
   const auto tconv_info = acl_common::asPadStrideInfo(padding, stride);
 
   auto fn = acl_common::generateLayer<arm_compute::CLTransposeConvLayer>(
     _tensor_builder->acl_tensor_manager()->internal_buffer_manager(), ifm_tensor->handle(),
-    ker_tensor->handle(), nullptr, ofm_tensor->handle(), tconv_info, invalid_horizontal,
+    ker_tensor->handle(), bias_handle, ofm_tensor->handle(), tconv_info, invalid_horizontal,
     invalid_vertical);
 
-  _return_fn = asAclFunction(std::move(fn));
+  _return_fn = std::make_unique<exec::FunctionSequence>(
+    asAclFunction(std::move(fn)), ActivationBuilder::generate(activation, ofm_tensor->handle()));
 }
 
 void KernelGenerator::visit(const ir::operation::SquaredDifference &node)
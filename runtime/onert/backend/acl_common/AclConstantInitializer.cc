@@ -115,6 +115,8 @@ void AclConstantInitializer::visit(const ir::operation::RNN &node)
 void AclConstantInitializer::visit(const ir::operation::TransposeConv &node)
 {
   copyInputInitialize(node, ir::operation::TransposeConv::KERNEL);
+  if (node.getInputs().size() > ir::operation::TransposeConv::BIAS)
+    copyInputInitialize(node, ir::operation::TransposeConv::BIAS);
 }
 
 // NOTE Workaround for 16b float type. Here, this is enough since only the size of bytes matters.
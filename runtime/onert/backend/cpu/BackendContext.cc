@@ -18,11 +18,94 @@
 
 #include "TensorBuilder.h"
 #include "KernelGenerator.h"
+#include "ops/PrefetchLayer.h"
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 #include "ir/Index.h"
 #include "ir/OperandIndexMap.h"
 #include "ir/OperandIndexSequence.h"
 #include "backend/basic/BackendContextHelpers.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/ExpandDims.h"
+#include "ir/operation/Reshape.h"
+
+namespace
+{
+
+using namespace onert;
+
+// Prepare a function at its first run instead of compilation time
+class LazyPrepareFunction final : public exec::IFunction
+{
+public:
+  LazyPrepareFunction(std::unique_ptr<exec::IFunction> fn) : _fn{std::move(fn)} { assert(_fn); }
+
+  void run() override
+  {
+    prepare();
+    _fn->run();
+  }
+
+  void prepare() override
+  {
+    if (_prepared)
+      return;
+    _fn->prepare();
+    _prepared = true;
+  }
+
+private:
+  std::unique_ptr<exec::IFunction> _fn;
+  bool _prepared = false;
+};
+
+// Inputs whose buffer the kernel of the operation can overwrite with its output
+ir::OperandIndexSequence inplaceCandidates(const ir::IOperation &op)
+{
+  const auto &inputs = op.getInputs();
+  switch (op.opcode())
+  {
+    case ir::OpCode::Reshape:
+      return ir::OperandIndexSequence{inputs.at(ir::operation::Reshape::Input::INPUT)};
+    case ir::OpCode::ExpandDims:
+      return ir::OperandIndexSequence{inputs.at(ir::operation::ExpandDims::Input::INPUT)};
+    case ir::OpCode::ElementwiseActivation:
+      return ir::OperandIndexSequence{
+        inputs.at(ir::operation::ElementwiseActivation::Input::INPUT)};
+    case ir::OpCode::BinaryArithmetic:
+      return ir::OperandIndexSequence{inputs.at(ir::operation::BinaryArithmetic::Input::LHS),
+                                      inputs.at(ir::operation::BinaryArithmetic::Input::RHS)};
+    default:
+      return ir::OperandIndexSequence{};
+  }
+}
+
+// Reshape-like operations only copy bytes, elementwise ones need the same shape on all operands
+bool isInplaceCompatible(const ir::IOperation &op, const ir::Operands &operands,
+                         const ir::OperandIndex &input, const ir::OperandIndex &output)
+{
+  const auto &input_info = operands.at(input).info();
+  const auto &output_info = operands.at(output).info();
+  if (input_info.typeInfo().type() != output_info.typeInfo().type())
+    return false;
+
+  switch (op.opcode())
+  {
+    case ir::OpCode::Reshape:
+    case ir::OpCode::ExpandDims:
+      return input_info.total_size() == output_info.total_size();
+    default:
+      for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED)
+      {
+        if (operands.at(ind).shape() != output_info.shape())
+          return false;
+      }
+      return true;
+  }
+}
+
+} // namespace
 
 namespace onert
 {
@@ -31,7 +114,56 @@ namespace backend
 namespace cpu
 {
 
-ITensorRegistry *BackendContext::genTensors() { return basic::genTensors(*this); }
+/*
+ * Find operations that can write their output over an input, like FindInplaceOpPass of
+ * onert-micro does. The input must
+ * - be produced by this backend and used by no other operation, so that it dies here
+ * - be a static non-constant tensor, as well as the output
+ * - have the size of the output, and the shape of it for elementwise operations
+ * Chains of such operations share one buffer, which lives until the last of them dies.
+ */
+void BackendContext::planInplaceTensors()
+{
+  const auto &graph = *_data.graph;
+  const auto &operands = graph.operands();
+
+  auto is_static_internal = [&](const ir::OperandIndex &ind) {
+    const auto &operand = operands.at(ind);
+    return !external_operands().contains(ind) && !_data.exported_operands.contains(ind) &&
+           !operand.isConstant() && !operand.info().isDynamic() && !operand.info().isVariable();
+  };
+
+  for (const auto &op_ind : _data.op_order)
+  {
+    const auto &op = graph.operations().at(op_ind);
+    if (op.getOutputs().size() != 1)
+      continue;
+
+    const auto output = op.getOutputs().at(0);
+    if (!output.valid() || !is_static_internal(output) || graph.getOutputs().contains(output))
+      continue;
+
+    for (const auto &input : inplaceCandidates(op))
+    {
+      const auto &operand = operands.at(input);
+      if (!is_static_internal(input) || !operand.getDef().valid() || operand.getUses().size() != 1)
+        continue;
+      if (!isInplaceCompatible(op, operands, input, output))
+        continue;
+
+      VERBOSE(CPU_BackendContext) << "In-place " << op.name() << " : " << output << " reuses "
+                                  << input << std::endl;
+      tensor_builder->setInplace(output, input);
+      break;
+    }
+  }
+}
+
+ITensorRegistry *BackendContext::genTensors()
+{
+  planInplaceTensors();
+  return basic::genTensors(*this);
+}
 
 FunctionMap BackendContext::genKernels()
 {
@@ -50,6 +182,16 @@ FunctionMap BackendContext::genKernels()
     .operands()
     .iterate([&](const ir::OperandIndex &, ir::Operand &obj) { obj.releaseData(); });
 
+  if (util::getConfigBool(util::config::LAZY_WEIGHT_PAGING))
+  {
+    // Prepare (e.g. weight prepacking) is deferred to the first run and cached by kernels, so
+    // that weights stay file-backed until they are used
+    for (auto &&it : ret)
+      it.second->wrap<LazyPrepareFunction>();
+    appendPrefetchLayers(ret);
+    return ret;
+  }
+
   for (auto &&it : ret)
   {
     auto &fn_seq = it.second;
@@ -59,6 +201,47 @@ FunctionMap BackendContext::genKernels()
   return ret;
 }
 
+void BackendContext::appendPrefetchLayers(FunctionMap &fn_map)
+{
+  // Constant tensors of each operation in execution order
+  std::vector<std::vector<const IPortableTensor *>> op_consts;
+  for (auto &&op_ind : _data.op_order)
+  {
+    std::vector<const IPortableTensor *> consts;
+    for (auto &&ind : graph()->operations().at(op_ind).getInputs() | ir::Remove::UNDEFINED)
+    {
+      if (!graph()->operands().at(ind).isConstant() || external_operands().contains(ind))
+        continue;
+
+      auto tensor = dynamic_cast<const IPortableTensor *>(tensor_registry->getNativeITensor(ind));
+      if (tensor != nullptr)
+        consts.emplace_back(tensor);
+    }
+    op_consts.emplace_back(std::move(consts));
+  }
+
+  // Each kernel hints the constants of the operation after next, so that paging them in
+  // overlaps with the computation of the next operation. Constants of the first operations are
+  // hinted right now.
+  const size_t distance = 2;
+  for (size_t i = 0; i < std::min(distance, op_consts.size()); ++i)
+  {
+    ops::PrefetchLayer prefetch;
+    prefetch.configure(op_consts[i]);
+    prefetch.run();
+  }
+
+  for (size_t i = 0; i + distance < op_consts.size(); ++i)
+  {
+    if (op_consts[i + distance].empty())
+      continue;
+
+    auto fn = std::make_unique<ops::PrefetchLayer>();
+    fn->configure(op_consts[i + distance]);
+    fn_map.at(_data.op_order[i])->append(std::move(fn));
+  }
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
@@ -51,6 +51,10 @@ public:
   std::shared_ptr<TensorBuilder> tensor_builder;
   std::shared_ptr<KernelGenerator> kernel_gen;
 
+private:
+  void planInplaceTensors();
+  void appendPrefetchLayers(FunctionMap &fn_map);
+
 private:
   // NOTE ruy context has a thread pool, and when multiple ruy contexts are created,
   //      the thread pool is also created in duplicate
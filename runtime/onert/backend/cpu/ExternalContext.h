@@ -19,7 +19,6 @@
 
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
-#include <ggml.h>
 
 #include <memory>
 
@@ -48,18 +47,10 @@ public:
     _ruy_context->set_max_num_threads(target_num_threads);
   }
 
-  void initGgmlContext()
-  {
-    if (_ggml_context == nullptr)
-      _ggml_context = std::unique_ptr<ggml_context, decltype(&ggml_free)>(
-        ggml_init({.mem_size = 0, .mem_buffer = nullptr, .no_alloc = true}), &ggml_free);
-  }
-
   ruy::Context *ruy_context() const { return _ruy_context.get(); }
 
 private:
   const std::unique_ptr<ruy::Context> _ruy_context;
-  std::unique_ptr<ggml_context, decltype(&ggml_free)> _ggml_context{nullptr, &ggml_free};
 };
 
 } // namespace cpu
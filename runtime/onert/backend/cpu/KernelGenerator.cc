@@ -18,6 +18,7 @@
 
 #include "ops/AddNLayer.h"
 #include "ops/ArgMinMaxLayer.h"
+#include "ops/AttentionLayer.h"
 #include "ops/BatchToSpaceNDLayer.h"
 #include "ops/BinaryArithmeticLayer.h"
 #include "ops/CompareLayer.h"
@@ -60,6 +61,7 @@
 #include "ops/SplitVLayer.h"
 #include "ops/TileLayer.h"
 #include "ops/TransposeLayer.h"
+#include "ops/TransposeConvLayer.h"
 #include "ops/UnpackLayer.h"
 #include "ops/SquaredDiffLayer.h"
 #include "ops/L2NormLayer.h"
@@ -512,7 +514,7 @@ void KernelGenerator::visit(const ir::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -532,7 +534,7 @@ void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
 
   fn->configure(lhs_tensor, rhs_tensor, ofm_tensor, activation,
-                convertArithmeticType(node.param().arithmetic_type));
+                convertArithmeticType(node.param().arithmetic_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -658,7 +660,7 @@ void KernelGenerator::visit(const ir::operation::ElementwiseActivation &node)
   auto fn = std::make_unique<ops::ElementwiseActivationLayer>();
 
   fn->configure(input_tensor, output_tensor, node.param().alpha, node.param().beta,
-                convertElementwiseActivationType(node.param().op_type));
+                convertElementwiseActivationType(node.param().op_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -698,7 +700,8 @@ void KernelGenerator::visit(const ir::operation::ElementwiseUnary &node)
   else
   {
     auto fn = std::make_unique<ops::ElementwiseUnaryLayer>();
-    fn->configure(input_tensor, output_tensor, convertElementwiseUnaryType(node.param().op_type));
+    fn->configure(input_tensor, output_tensor, convertElementwiseUnaryType(node.param().op_type),
+                  _external_context);
     _return_fn = std::move(fn);
   }
 }
@@ -800,7 +803,56 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
 
   auto fn = std::make_unique<ops::TransposeLayer>();
 
-  fn->configure(input_tensor, perm_tensor, output_tensor);
+  fn->configure(input_tensor, perm_tensor, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::TransposeConv &node)
+{
+  using ir::operation::TransposeConv;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(TransposeConv::Input::INPUT)};
+  const auto ker_index{node.getInputs().at(TransposeConv::Input::KERNEL)};
+  const auto bias_index{node.getInputs().size() > TransposeConv::Input::BIAS
+                          ? node.getInputs().at(TransposeConv::Input::BIAS)
+                          : ir::OperandIndex{}};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+  auto ker_tensor = _tensor_reg->getPortableTensor(ker_index);
+  auto bias_tensor = bias_index.undefined() ? nullptr : _tensor_reg->getPortableTensor(bias_index);
+
+  const auto stride = node.param().stride;
+  const auto &param_padding = node.param().padding;
+  const auto activation = node.param().activation;
+
+  auto fn = std::make_unique<ops::TransposeConvLayer>();
+
+  if (_ctx.at(ifm_index).info().isDynamic() || _ctx.at(ofm_index).info().isDynamic())
+  {
+    fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, param_padding.param.left,
+                  param_padding.param.top, stride.horizontal, stride.vertical, activation,
+                  ofm_tensor, _external_context);
+
+    _return_fn = std::move(fn);
+    return;
+  }
+  const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature();
+  const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature();
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _ctx.at(ker_index).shape();
+  const auto ker_height = ker_shape.dim(1);
+  const auto ker_width = ker_shape.dim(2);
+
+  // Padding of transposed convolution is that of the convolution from output to input
+  const auto padding =
+    ir::calculatePadding(param_padding, ofm_shape, ifm_shape, stride, ker_width, ker_height);
+
+  fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
+                padding.top, stride.horizontal, stride.vertical, activation, ofm_tensor,
+                _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -1196,6 +1248,31 @@ void KernelGenerator::visit(const ir::operation::DetectionPostProcess &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::Attention &node)
+{
+  using ir::operation::Attention;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto query_index{node.getInputs().at(Attention::Input::QUERY)};
+  const auto key_index{node.getInputs().at(Attention::Input::KEY)};
+  const auto value_index{node.getInputs().at(Attention::Input::VALUE)};
+  const auto mask_index = node.getInputs().size() > Attention::Input::MASK
+                            ? node.getInputs().at(Attention::Input::MASK)
+                            : ir::OperandIndex{};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto query_tensor = _tensor_reg->getPortableTensor(query_index);
+  auto key_tensor = _tensor_reg->getPortableTensor(key_index);
+  auto value_tensor = _tensor_reg->getPortableTensor(value_index);
+  auto mask_tensor = mask_index.undefined() ? nullptr : _tensor_reg->getPortableTensor(mask_index);
+
+  auto fn = std::make_unique<ops::AttentionLayer>();
+
+  fn->configure(query_tensor, key_tensor, value_tensor, mask_tensor, node.param().scale,
+                node.param().causal, output_tensor, _external_context);
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1211,7 +1288,7 @@ void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
 
   auto fn = std::make_unique<ops::BatchMatMulLayer>();
 
-  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor);
+  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor, _external_context);
   _return_fn = std::move(fn);
 }
 
@@ -1265,7 +1342,7 @@ void KernelGenerator::visit(const ir::operation::LogSoftmax &node)
 
   auto fn = std::make_unique<ops::LogSoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, axis, output_tensor);
+  fn->configure(input_tensor, beta, axis, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -46,6 +46,7 @@ public:
 
   void visit(const ir::operation::AddN &) override;
   void visit(const ir::operation::ArgMinMax &) override;
+  void visit(const ir::operation::Attention &) override;
   void visit(const ir::operation::BatchMatMul &) override;
   void visit(const ir::operation::BatchToSpaceND &) override;
   void visit(const ir::operation::BinaryArithmetic &) override;
@@ -95,6 +96,7 @@ public:
   void visit(const ir::operation::StridedSlice &) override;
   void visit(const ir::operation::Tile &) override;
   void visit(const ir::operation::Transpose &) override;
+  void visit(const ir::operation::TransposeConv &) override;
   void visit(const ir::operation::Unpack &) override;
 
 private:
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "AttentionLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/Attention.h>
+
+#include <cmath>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+AttentionLayer::AttentionLayer()
+  : _query(nullptr), _key(nullptr), _value(nullptr), _mask(nullptr), _output(nullptr),
+    _scale(0.f), _causal(false), _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+void AttentionLayer::attentionFloat32()
+{
+  const auto query_shape = getShape(_query);
+  nnfw::cker::AttentionParams op_params;
+  // Scale 0 means 1 / sqrt(depth)
+  op_params.scale =
+    _scale != 0.f ? _scale : 1.f / std::sqrt(static_cast<float>(query_shape.Dims(3)));
+  op_params.causal = _causal;
+
+  nnfw::cker::Attention(op_params, query_shape, getBuffer<float>(_query), getShape(_key),
+                        getBuffer<float>(_key), getShape(_value), getBuffer<float>(_value),
+                        _mask ? getShape(_mask) : nnfw::cker::Shape(),
+                        _mask ? getBuffer<float>(_mask) : nullptr, getShape(_output),
+                        getBuffer<float>(_output), _external_context->ruy_context());
+}
+
+void AttentionLayer::configure(const IPortableTensor *query, const IPortableTensor *key,
+                               const IPortableTensor *value, const IPortableTensor *mask,
+                               float scale, bool causal, IPortableTensor *output,
+                               const std::shared_ptr<ExternalContext> &external_context)
+{
+  _query = query;
+  _key = key;
+  _value = value;
+  _mask = mask;
+  _scale = scale;
+  _causal = causal;
+  _output = output;
+  _external_context = external_context;
+}
+
+void AttentionLayer::run()
+{
+  if (_query->data_type() == OperandType::FLOAT32)
+  {
+    attentionFloat32();
+  }
+  else
+  {
+    throw std::runtime_error{"Attention: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
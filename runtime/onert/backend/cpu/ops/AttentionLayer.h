@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __ONERT_BACKEND_CPU_OPS_ATTENTION_LAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_ATTENTION_LAYER_H__
+
+#include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
+
+#include <exec/IFunction.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class AttentionLayer : public ::onert::exec::IFunction
+{
+public:
+  AttentionLayer();
+
+public:
+  void attentionFloat32();
+
+  void configure(const IPortableTensor *query, const IPortableTensor *key,
+                 const IPortableTensor *value, const IPortableTensor *mask, float scale,
+                 bool causal, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  void run() override;
+
+private:
+  const IPortableTensor *_query;
+  const IPortableTensor *_key;
+  const IPortableTensor *_value;
+  const IPortableTensor *_mask;
+  IPortableTensor *_output;
+
+  float _scale;
+  bool _causal;
+
+  std::shared_ptr<ExternalContext> _external_context;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_ATTENTION_LAYER_H__
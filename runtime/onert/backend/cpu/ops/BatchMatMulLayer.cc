@@ -17,6 +17,7 @@
 #include "BatchMatMulLayer.h"
 
 #include <cker/operation/BatchMatMul.h>
+#include <cker/operation/BlockQuantMatMul.h>
 
 namespace onert
 {
@@ -29,7 +30,8 @@ namespace ops
 
 BatchMatMulLayer::BatchMatMulLayer()
   : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _adj_x(false), _adj_y(false),
-    _kernel(new nnfw::cker::BatchMatMul())
+    _output_multiplier(0), _output_shift(0), _kernel(new nnfw::cker::BatchMatMul()),
+    _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -39,19 +41,52 @@ BatchMatMulLayer::~BatchMatMulLayer() = default;
 void BatchMatMulLayer::batchMatMulFloat32()
 {
   nnfw::cker::BatchMatMul &batchmatmul_kernel = *_kernel;
-  nnfw::cker::Shape lhs_shape = getShape(_lhs);
-  nnfw::cker::Shape rhs_shape = getShape(_rhs);
-  nnfw::cker::Shape output_shape = getShape(_output);
+  batchmatmul_kernel(getShape(_lhs), getBuffer<float>(_lhs), getShape(_rhs),
+                     getBuffer<float>(_rhs), _adj_x, _adj_y, getShape(_output),
+                     getBuffer<float>(_output), _external_context->ruy_context());
+}
+
+template <typename T> void BatchMatMulLayer::batchMatMulQuant()
+{
+  nnfw::cker::BatchMatMulParams op_params;
+  op_params.adj_x = _adj_x;
+  op_params.adj_y = _adj_y;
+  op_params.lhs_zero_point = _lhs->data_zero_point();
+  op_params.rhs_zero_point = _rhs->data_zero_point();
+  op_params.output_zero_point = _output->data_zero_point();
+  op_params.output_multiplier = _output_multiplier;
+  op_params.output_shift = _output_shift;
+  op_params.quantized_activation_min = std::numeric_limits<T>::min();
+  op_params.quantized_activation_max = std::numeric_limits<T>::max();
+  op_params.rhs_cacheable = _rhs->is_constant();
 
-  // TODO implement for constant input
+  nnfw::cker::BatchMatMul &batchmatmul_kernel = *_kernel;
+  batchmatmul_kernel(op_params, getShape(_lhs), getBuffer<T>(_lhs), getShape(_rhs),
+                     getBuffer<T>(_rhs), getShape(_output), getBuffer<T>(_output),
+                     _external_context->ruy_context());
+}
 
-  batchmatmul_kernel.prepare(lhs_shape, rhs_shape, _adj_x, _adj_y);
-  batchmatmul_kernel(lhs_shape, getBuffer<float>(_lhs), rhs_shape, getBuffer<float>(_rhs), _adj_x,
-                     _adj_y, output_shape, getBuffer<float>(_output));
+void BatchMatMulLayer::batchMatMulBlockQuant()
+{
+  if (_rhs->data_type() == OperandType::QUANT_GGML_Q4_0)
+  {
+    nnfw::cker::BatchMatMulBlockQuant(
+      getShape(_lhs), getBuffer<float>(_lhs), getShape(_rhs),
+      getBuffer<nnfw::cker::BlockQ4_0>(_rhs), _adj_x, _adj_y, getShape(_output),
+      getBuffer<float>(_output), _external_context->ruy_context());
+  }
+  else
+  {
+    nnfw::cker::BatchMatMulBlockQuant(
+      getShape(_lhs), getBuffer<float>(_lhs), getShape(_rhs),
+      getBuffer<nnfw::cker::BlockQ8_0>(_rhs), _adj_x, _adj_y, getShape(_output),
+      getBuffer<float>(_output), _external_context->ruy_context());
+  }
 }
 
 void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x,
-                                 bool adj_y, IPortableTensor *output)
+                                 bool adj_y, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -62,18 +97,56 @@ void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTens
   _adj_x = adj_x;
   _adj_y = adj_y;
   _output = output;
+  _external_context = external_context;
+
+  if (_lhs->data_type() != OperandType::FLOAT32)
+  {
+    const double real_multiplier =
+      static_cast<double>(_lhs->data_scale()) * _rhs->data_scale() / _output->data_scale();
+    QuantizeMultiplier(real_multiplier, &_output_multiplier, &_output_shift);
+  }
+
+  // Block quantized rhs is dequantized on the fly instead of being packed by ruy
+  if (_rhs->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+      _rhs->data_type() == OperandType::QUANT_GGML_Q8_0)
+    return;
+
+  // Constant rhs is packed once by ruy and reused on later runs
+  _kernel->prepare(getShape(_lhs), getShape(_rhs), _adj_x, _adj_y, _rhs->is_constant());
 }
 
 void BatchMatMulLayer::run()
 {
-  if ((_lhs->data_type() == OperandType::FLOAT32) && (_rhs->data_type() == OperandType::FLOAT32))
+  if (_lhs->data_type() == OperandType::FLOAT32 &&
+      (_rhs->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+       _rhs->data_type() == OperandType::QUANT_GGML_Q8_0))
   {
-    batchMatMulFloat32();
+    batchMatMulBlockQuant();
+    return;
   }
-  else
+
+  if (_lhs->data_type() != _rhs->data_type())
   {
     throw std::runtime_error{"BatchMatMul: unsupported data type"};
   }
+
+  switch (_lhs->data_type())
+  {
+    case OperandType::FLOAT32:
+      batchMatMulFloat32();
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      batchMatMulQuant<uint8_t>();
+      break;
+    case OperandType::QUANT_INT8_ASYMM:
+      batchMatMulQuant<int8_t>();
+      break;
+    case OperandType::QUANT_INT16_SYMM:
+      batchMatMulQuant<int16_t>();
+      break;
+    default:
+      throw std::runtime_error{"BatchMatMul: unsupported data type"};
+  }
 }
 
 #undef AVGPOOLING_PARAMETERS
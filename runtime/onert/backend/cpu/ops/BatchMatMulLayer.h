@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_BATCH_MATMUL_LAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -48,8 +49,12 @@ public:
 public:
   void batchMatMulFloat32();
 
+  template <typename T> void batchMatMulQuant();
+
+  void batchMatMulBlockQuant();
+
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x, bool adj_y,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -61,7 +66,11 @@ private:
   bool _adj_x;
   bool _adj_y;
 
+  int32_t _output_multiplier;
+  int _output_shift;
+
   std::unique_ptr<nnfw::cker::BatchMatMul> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -19,6 +19,7 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -49,7 +50,8 @@ public:
 
 public:
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-                 const ir::Activation activation, const ArithmeticType arithmetic_type);
+                 const ir::Activation activation, const ArithmeticType arithmetic_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -57,6 +59,7 @@ protected:
   const IPortableTensor *_lhs;
   const IPortableTensor *_rhs;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
 
   std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)> _kernel;
 };
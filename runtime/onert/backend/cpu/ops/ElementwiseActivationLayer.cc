@@ -86,19 +86,21 @@ void ElementwiseActivationLayer::EvalUsingLookupTable(const IPortableTensor *inp
 
 void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                            float alpha, float beta,
-                                           ElementwiseActivationType op_type)
+                                           ElementwiseActivationType op_type,
+                                           const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
+  _external_context = external_context;
+  ruy::Context *ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
 
   switch (op_type)
   {
     case ElementwiseActivationType::kElu:
       if (input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-          nnfw::cker::ELU(getShape(input), getBuffer<float>(input), getShape(output),
-                          getBuffer<float>(output));
+        _kernel = [ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+          runElementwise<float, float>(input, output, ruy_context, nnfw::cker::ELU);
         };
       }
       else
@@ -115,9 +117,8 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-          nnfw::cker::Logistic(getShape(input), getBuffer<float>(input), getShape(output),
-                               getBuffer<float>(output));
+        _kernel = [ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+          runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Logistic);
         };
       }
       else
@@ -130,16 +131,14 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       {
         if (alpha == std::numeric_limits<float>::infinity() && beta == 0.f)
         {
-          _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-            nnfw::cker::ReLU(getShape(input), getBuffer<float>(input), getShape(output),
-                             getBuffer<float>(output));
+          _kernel = [ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+            runElementwise<float, float>(input, output, ruy_context, nnfw::cker::ReLU);
           };
         }
         else if (alpha == 6.f && beta == 0.f)
         {
-          _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-            nnfw::cker::ReLU6(getShape(input), getBuffer<float>(input), getShape(output),
-                              getBuffer<float>(output));
+          _kernel = [ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+            runElementwise<float, float>(input, output, ruy_context, nnfw::cker::ReLU6);
           };
         }
         else
@@ -162,9 +161,8 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-          nnfw::cker::Tanh(getShape(input), getBuffer<float>(input), getShape(output),
-                           getBuffer<float>(output));
+        _kernel = [ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+          runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Tanh);
         };
       }
       else
@@ -175,10 +173,14 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
     case ElementwiseActivationType::kLeakyReLU:
       if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [alpha](const IPortableTensor *input, IPortableTensor *output) {
-          nnfw::cker::LeakyReLU(nnfw::cker::LeakyReluParams{alpha}, getShape(input),
-                                getBuffer<float>(input), getShape(output),
-                                getBuffer<float>(output));
+        _kernel = [alpha, ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+          runElementwise<float, float>(
+            input, output, ruy_context,
+            [alpha](const nnfw::cker::Shape &input_shape, const float *input_data,
+                    const nnfw::cker::Shape &output_shape, float *output_data) {
+              nnfw::cker::LeakyReLU(nnfw::cker::LeakyReluParams{alpha}, input_shape, input_data,
+                                    output_shape, output_data);
+            });
         };
       }
       else
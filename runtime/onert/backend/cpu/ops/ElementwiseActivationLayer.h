@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_ElementwiseActivationLAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_ElementwiseActivationLAYER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/IPortableTensor.h>
 
 #include <exec/IFunction.h>
@@ -46,7 +48,8 @@ public:
 
 public:
   void configure(const IPortableTensor *input, IPortableTensor *output, float alpha, float beta,
-                 const ElementwiseActivationType op_type);
+                 const ElementwiseActivationType op_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -57,6 +60,7 @@ public:
 protected:
   const IPortableTensor *_input;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
   uint8_t _table[256];
   std::function<void(const IPortableTensor *input, IPortableTensor *output)> _kernel;
 };
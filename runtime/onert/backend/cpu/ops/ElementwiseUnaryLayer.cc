@@ -36,10 +36,9 @@ namespace ops
 
 namespace
 {
-void absFloat32(const IPortableTensor *input, IPortableTensor *output)
+void absFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Abs(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Abs);
 }
 
 template <typename FromT>
@@ -76,7 +75,7 @@ void castPtr(const FromT *in, DataPtr out, int num_elements, ir::DataType data_t
   }
 }
 
-void cast(const IPortableTensor *input, IPortableTensor *output)
+void cast(const IPortableTensor *input, IPortableTensor *output, ruy::Context *)
 {
   auto input_buf = input->buffer();
   auto output_buf = output->buffer();
@@ -113,90 +112,97 @@ void cast(const IPortableTensor *input, IPortableTensor *output)
   }
 }
 
-void cosFloat32(const IPortableTensor *input, IPortableTensor *output)
+void cosFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Cos(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Cos);
 }
 
-void dequantizeInt8(const IPortableTensor *input, IPortableTensor *output)
+void dequantizeInt8(const IPortableTensor *input, IPortableTensor *output,
+                     ruy::Context *ruy_context)
 {
-  nnfw::cker::Dequantize(getShape(input), getBuffer<int8_t>(input), getShape(output),
-                         getBuffer<float>(output), input->data_scale(), input->data_zero_point());
+  const float scale = input->data_scale();
+  const int32_t zero_point = input->data_zero_point();
+  runElementwise<int8_t, float>(
+    input, output, ruy_context,
+    [&](const nnfw::cker::Shape &input_shape, const int8_t *input_data,
+        const nnfw::cker::Shape &output_shape, float *output_data) {
+      nnfw::cker::Dequantize(input_shape, input_data, output_shape, output_data, scale,
+                             zero_point);
+    });
 }
 
-void dequantizeUint8(const IPortableTensor *input, IPortableTensor *output)
+void dequantizeUint8(const IPortableTensor *input, IPortableTensor *output,
+                      ruy::Context *ruy_context)
 {
-  nnfw::cker::Dequantize(getShape(input), getBuffer<uint8_t>(input), getShape(output),
-                         getBuffer<float>(output), input->data_scale(), input->data_zero_point());
+  const float scale = input->data_scale();
+  const int32_t zero_point = input->data_zero_point();
+  runElementwise<uint8_t, float>(
+    input, output, ruy_context,
+    [&](const nnfw::cker::Shape &input_shape, const uint8_t *input_data,
+        const nnfw::cker::Shape &output_shape, float *output_data) {
+      nnfw::cker::Dequantize(input_shape, input_data, output_shape, output_data, scale,
+                             zero_point);
+    });
 }
 
-void expFloat32(const IPortableTensor *input, IPortableTensor *output)
+void expFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Exp(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Exp);
 }
 
-void erfFloat32(const IPortableTensor *input, IPortableTensor *output)
+void erfFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Erf(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Erf);
 }
 
-void floorFloat32(const IPortableTensor *input, IPortableTensor *output)
+void floorFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Floor(getShape(input), getBuffer<float>(input), getShape(output),
-                    getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Floor);
 }
 
-void logFloat32(const IPortableTensor *input, IPortableTensor *output)
+void logFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Log(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Log);
 }
 
-void logicalNot(const IPortableTensor *input, IPortableTensor *output)
+void logicalNot(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::LogicalNot(getShape(input), getBuffer<bool>(input), getShape(output),
-                         getBuffer<bool>(output));
+  runElementwise<bool, bool>(input, output, ruy_context, nnfw::cker::LogicalNot);
 }
 
-template <typename T> void neg(const IPortableTensor *input, IPortableTensor *output)
+template <typename T>
+void neg(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Neg<T>(getShape(input), getBuffer<T>(input), getShape(output), getBuffer<T>(output));
+  runElementwise<T, T>(input, output, ruy_context, nnfw::cker::Neg<T>);
 }
 
-void roundFloat32(const IPortableTensor *input, IPortableTensor *output)
+void roundFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Round(getShape(input), getBuffer<float>(input), getShape(output),
-                    getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Round);
 }
 
-void rsqrtFloat32(const IPortableTensor *input, IPortableTensor *output)
+void rsqrtFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Rsqrt(getShape(input), getBuffer<float>(input), getShape(output),
-                    getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Rsqrt);
 }
 
-void sinFloat32(const IPortableTensor *input, IPortableTensor *output)
+void sinFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Sin(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Sin);
 }
 
-void sqrtFloat32(const IPortableTensor *input, IPortableTensor *output)
+void sqrtFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Sqrt(getShape(input), getBuffer<float>(input), getShape(output),
-                   getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Sqrt);
 }
 
-void squareFloat32(const IPortableTensor *input, IPortableTensor *output)
+void squareFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Square(getShape(input), getBuffer<float>(input), getShape(output),
-                     getBuffer<float>(output));
+  runElementwise<float, float>(input, output, ruy_context, nnfw::cker::Square);
 }
 
-template <typename T> void zerosLikeFloat32(const IPortableTensor *input, IPortableTensor *output)
+template <typename T>
+void zerosLikeFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *)
 {
   if (!HaveSameShapes(input, output))
     throw std::runtime_error{"ZerosLike: input and output shape don't match."};
@@ -208,13 +214,15 @@ template <typename T> void zerosLikeFloat32(const IPortableTensor *input, IPorta
 } // namespace
 
 void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTensor *output,
-                                      const ElementwiseUnaryType op_type)
+                                      const ElementwiseUnaryType op_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(input != nullptr);
   assert(output != nullptr);
 
   _input = input;
   _output = output;
+  _external_context = external_context;
 
   switch (op_type)
   {
@@ -394,7 +402,10 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
   }
 }
 
-void ElementwiseUnaryLayer::run() { _kernel(_input, _output); }
+void ElementwiseUnaryLayer::run()
+{
+  _kernel(_input, _output, _external_context ? _external_context->ruy_context() : nullptr);
+}
 
 } // namespace ops
 } // namespace cpu
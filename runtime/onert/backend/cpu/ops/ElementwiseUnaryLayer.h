@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_ELEMENTWISEUNARYLAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_ELEMENTWISEUNARYLAYER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/IPortableTensor.h>
 
 #include <exec/IFunction.h>
@@ -61,14 +63,16 @@ public:
 
 public:
   void configure(const IPortableTensor *input, IPortableTensor *output,
-                 const ElementwiseUnaryType op_type);
+                 const ElementwiseUnaryType op_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
-  std::function<void(const IPortableTensor *, IPortableTensor *)> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
+  std::function<void(const IPortableTensor *, IPortableTensor *, ruy::Context *)> _kernel;
 };
 
 } // namespace ops
@@ -17,6 +17,7 @@
 #include "FullyConnectedLayer.h"
 
 #include "../Tensor.h"
+#include <cker/operation/BlockQuantMatMul.h>
 #include <cker/operation/FullyConnected.h>
 #include <cker/TensorUtils.h>
 #include <misc/polymorphic_downcast.h>
@@ -195,6 +196,34 @@ void FullyConnectedLayer::fullyConnected16x1Float32()
 #endif
 }
 
+void FullyConnectedLayer::fullyConnectedBlockQuant()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  if (_weights->data_type() == OperandType::QUANT_GGML_Q4_0)
+  {
+    nnfw::cker::FullyConnectedBlockQuant(
+      op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
+      getBuffer<nnfw::cker::BlockQ4_0>(_weights), getShape(_bias),
+      _bias ? getBuffer<float>(_bias) : nullptr, getShape(_output), getBuffer<float>(_output),
+      _external_context->ruy_context());
+  }
+  else
+  {
+    nnfw::cker::FullyConnectedBlockQuant(
+      op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
+      getBuffer<nnfw::cker::BlockQ8_0>(_weights), getShape(_bias),
+      _bias ? getBuffer<float>(_bias) : nullptr, getShape(_output), getBuffer<float>(_output),
+      _external_context->ruy_context());
+  }
+}
+
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
                                     const IPortableTensor *bias, ir::Activation activation,
                                     ir::FullyConnectedWeightsFormat weights_format,
@@ -229,6 +258,11 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedSparseWeight();
   }
+  else if (_weights->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+           _weights->data_type() == OperandType::QUANT_GGML_Q8_0)
+  {
+    fullyConnectedBlockQuant();
+  }
   else if (_input->data_type() == OperandType::FLOAT32)
   {
     _is_shuffled16x1float32 ? fullyConnected16x1Float32() : fullyConnectedFloat32();
@@ -57,6 +57,8 @@ public:
 
   void fullyConnected16x1Float32();
 
+  void fullyConnectedBlockQuant();
+
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
                  const IPortableTensor *bias, ir::Activation activation,
                  ir::FullyConnectedWeightsFormat weights_format, IPortableTensor *output,
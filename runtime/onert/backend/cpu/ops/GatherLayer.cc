@@ -17,7 +17,6 @@
 #include "GatherLayer.h"
 
 #include "OperationUtils.h"
-#include "GGMLHelper.h"
 
 #include <cker/operation/Gather.h>
 
@@ -38,9 +37,6 @@ void GatherLayer::configure(const IPortableTensor *input, const IPortableTensor
   _axis = axis;
   _output = output;
   _ctx = ctx;
-
-  if (_input->data_type() == OperandType::QUANT_GGML_Q4_0)
-    ctx->initGgmlContext();
 }
 
 template <typename InputType> void GatherLayer::runByInputType()
@@ -57,7 +53,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        _ctx->ruy_context());
       break;
     }
     case OperandType::INT64:
@@ -66,7 +63,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        _ctx->ruy_context());
       break;
     }
     default:
@@ -74,53 +72,29 @@ template <typename InputType> void GatherLayer::runByInputType()
   }
 }
 
-void GatherLayer::runByGGMLQuantInputType()
+template <typename BlockType> void GatherLayer::runByBlockQuantInputType()
 {
-  // Supporting condition
-  // Input: rank 2
-  // Indice: rank < 4 or rank 4 with dim(0) = 1, INT32
-  // Axis: 0
-  if (getShape(_input).DimensionsCount() != 2)
-    throw std::runtime_error("Gather: block quantized input tensor must be rank 2");
-
-  if (getShape(_indices).DimensionsCount() > 4 &&
-      (getShape(_indices).DimensionsCount() != 4 || getShape(_indices).Dims(0) != 1))
-    throw std::runtime_error("Gather: invalid indices tensor shape");
-
-  if (_indices->data_type() != ir::DataType::INT32)
-    throw std::runtime_error("Gather: indices tensor must be int32 type");
-
+  // Rows of a block quantized table are gathered along axis 0 and dequantized to float
   if (_axis != 0)
     throw std::runtime_error("Gather: axis must be 0");
 
-  // convert tensor
-  auto input = getGGMLTensor(_input);
-  auto indices = getGGMLTensor(_indices);
-  auto output = getGGMLTensor(_output);
-  {
-    output.op = GGML_OP_GET_ROWS;
-    output.src[0] = &input;
-    output.src[1] = &indices;
-  }
-  auto *nodes = &output;
-
-  // create graph
-  struct ggml_cgraph graph;
+  switch (_indices->data_type())
   {
-    memset(&graph, 0, sizeof(graph));
-    graph.n_nodes = 1;
-    graph.nodes = &nodes;
+    case OperandType::INT32:
+      nnfw::cker::GatherBlockQuant(getShape(_input), getBuffer<BlockType>(_input),
+                                   getShape(_indices), getBuffer<int32_t>(_indices),
+                                   getShape(_output), getBuffer<float>(_output),
+                                   _ctx->ruy_context());
+      break;
+    case OperandType::INT64:
+      nnfw::cker::GatherBlockQuant(getShape(_input), getBuffer<BlockType>(_input),
+                                   getShape(_indices), getBuffer<int64_t>(_indices),
+                                   getShape(_output), getBuffer<float>(_output),
+                                   _ctx->ruy_context());
+      break;
+    default:
+      throw std::runtime_error("Gather: unsupported indices data type");
   }
-
-  // get cplan
-  auto cplan = ggml_graph_plan(&graph, _ctx->ruy_context()->max_num_threads());
-  cplan.work_data = (uint8_t *)(malloc(cplan.work_size));
-
-  // compute
-  ggml_graph_compute(&graph, &cplan);
-
-  // free
-  free(cplan.work_data);
 }
 
 void GatherLayer::run()
@@ -137,7 +111,10 @@ void GatherLayer::run()
       runByInputType<int32_t>();
       break;
     case OperandType::QUANT_GGML_Q4_0:
-      runByGGMLQuantInputType();
+      runByBlockQuantInputType<nnfw::cker::BlockQ4_0>();
+      break;
+    case OperandType::QUANT_GGML_Q8_0:
+      runByBlockQuantInputType<nnfw::cker::BlockQ8_0>();
       break;
     default:
       throw std::runtime_error("Gather: unsupported input data type");
@@ -48,7 +48,7 @@ public:
 
 private:
   template <typename OpType> void runByInputType();
-  void runByGGMLQuantInputType();
+  template <typename BlockType> void runByBlockQuantInputType();
 
 private:
   const IPortableTensor *_input;
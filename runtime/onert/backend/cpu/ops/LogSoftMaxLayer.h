@@ -17,6 +17,7 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_LOGSOFTMAXLAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_LOGSOFTMAXLAYER_H__
 
+#include "../ExternalContext.h"
 #include "../Tensor.h"
 
 #include <exec/IFunction.h>
@@ -41,7 +42,7 @@ public:
   void logsoftmaxQuant8();
 
   void configure(const IPortableTensor *input, const float beta, const int axis,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run();
 
@@ -50,6 +51,7 @@ public:
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
 
   float _beta;
   int _axis;
@@ -25,6 +25,7 @@
 
 #include <cker/Shape.h>
 #include <cker/Types.h>
+#include <cker/operation/ParallelElementwise.h>
 
 #include <limits>
 #include <vector>
@@ -191,6 +192,25 @@ template <> inline bool *getBuffer(IPortableTensor *tensor)
   return reinterpret_cast<bool *>(tensor->buffer());
 }
 
+/**
+ * @brief Run an elementwise kernel of cker on ranges of flat tensors split over the thread pool
+ *
+ * kernel(shape, input_data, shape, output_data) is called for each range with its rank 1 shape.
+ * Small tensors run on the caller thread, and so do all tensors if ruy_context is null.
+ */
+template <typename InputT, typename OutputT, typename Kernel>
+void runElementwise(const IPortableTensor *input, IPortableTensor *output,
+                    ruy::Context *ruy_context, const Kernel &kernel)
+{
+  const int size = MatchingFlatSize(getShape(input), getShape(output));
+  const InputT *input_data = getBuffer<InputT>(input);
+  OutputT *output_data = getBuffer<OutputT>(output);
+  nnfw::cker::ParallelElementwise(size, 1, ruy_context, [&](int start, int end) {
+    const nnfw::cker::Shape shape{end - start};
+    kernel(shape, input_data + start, shape, output_data + start);
+  });
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
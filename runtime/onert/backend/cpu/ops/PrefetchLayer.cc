@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PrefetchLayer.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+PrefetchLayer::PrefetchLayer() : _tensors()
+{
+  // DO NOTHING
+}
+
+void PrefetchLayer::configure(const std::vector<const IPortableTensor *> &tensors)
+{
+  _tensors = tensors;
+}
+
+void PrefetchLayer::run()
+{
+  static const uintptr_t page_size = static_cast<uintptr_t>(getpagesize());
+
+  for (const auto tensor : _tensors)
+  {
+    // Buffer can be released by the kernel that prepacked it
+    const auto buffer = tensor->buffer();
+    if (buffer == nullptr || tensor->total_size() == 0)
+      continue;
+
+    // madvise accepts page-aligned address only
+    const auto begin = reinterpret_cast<uintptr_t>(buffer) & ~(page_size - 1);
+    const auto end = reinterpret_cast<uintptr_t>(buffer) + tensor->total_size();
+
+    // This is just a hint. Failure does not affect correctness.
+    madvise(reinterpret_cast<void *>(begin), end - begin, MADV_WILLNEED);
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_PREFETCHLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_PREFETCHLAYER_H__
+
+#include <backend/IPortableTensor.h>
+
+#include <exec/IFunction.h>
+
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+/**
+ * @brief Hint OS to page in constant tensors which will be used soon
+ *
+ * It does not touch the data, so it is cheap even if the data is already resident.
+ * It is meaningful for tensors backed by file mapping (USE_MMAPED_DATA or LAZY_WEIGHT_PAGING).
+ */
+class PrefetchLayer : public ::onert::exec::IFunction
+{
+public:
+  PrefetchLayer();
+
+public:
+  void configure(const std::vector<const IPortableTensor *> &tensors);
+
+  void run() override;
+
+private:
+  std::vector<const IPortableTensor *> _tensors;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_PREFETCHLAYER_H__
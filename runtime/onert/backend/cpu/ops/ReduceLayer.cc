@@ -209,7 +209,7 @@ void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor
 void ReduceLayer::run()
 {
   const auto axes = getReducerAxes(_axes);
-#ifdef USE_NEON
+#if defined(USE_NEON) || defined(USE_X86_SIMD)
   int32_t rank = _input->getShape().rank();
   if (_input->data_type() == ir::DataType::FLOAT32 && _reduceType == ReduceType::kSum &&
       axes.size() == 1 && (axes[0] == -1 || axes[0] == rank - 1))
@@ -217,7 +217,7 @@ void ReduceLayer::run()
     OptimizedReduceSum(getBuffer<float>(_input), getShape(_input), getBuffer<float>(_output));
     return;
   }
-#endif // NEON
+#endif // defined(USE_NEON) || defined(USE_X86_SIMD)
   _kernel(_input, _output, axes);
 }
 
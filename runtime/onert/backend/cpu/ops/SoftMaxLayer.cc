@@ -39,7 +39,8 @@ void SoftMaxLayer::softmaxFloat32()
   if (getNumberOfDimensions(_input) == 1)
   {
     uint32_t input_size = getNumberOfElements(_input);
-    nnfw::cker::Softmax(getBuffer<float>(_input), input_size, 1, _beta, getBuffer<float>(_output));
+    nnfw::cker::Softmax(getBuffer<float>(_input), input_size, 1, _beta, getBuffer<float>(_output),
+                        _external_context->ruy_context());
   }
   else if (getNumberOfDimensions(_input) == 2)
   {
@@ -49,14 +50,14 @@ void SoftMaxLayer::softmaxFloat32()
 
     uint32_t input_size = getNumberOfElements(_input) / batch_size;
     nnfw::cker::Softmax(getBuffer<float>(_input), input_size, batch_size, _beta,
-                        getBuffer<float>(_output));
+                        getBuffer<float>(_output), _external_context->ruy_context());
   }
   else if (getNumberOfDimensions(_input) == 4)
   {
     nnfw::cker::SoftmaxParams op_params;
     op_params.beta = _beta;
     nnfw::cker::Softmax(op_params, getShape(_input), getBuffer<float>(_input), getShape(_output),
-                        getBuffer<float>(_output));
+                        getBuffer<float>(_output), _external_context->ruy_context());
   }
   else
   {
@@ -78,19 +79,22 @@ template <typename T> void SoftMaxLayer::softmaxQuant8()
 
 #ifdef TFLITE_SOFTMAX_USE_UINT16_LUT
   nnfw::cker::SoftmaxInt8LUT<T, T>(op_params, getShape(_input), getBuffer<T>(_input),
-                                   getShape(_output), getBuffer<T>(_output));
+                                   getShape(_output), getBuffer<T>(_output),
+                                   _external_context->ruy_context());
 #else
   nnfw::cker::Softmax<T, T>(op_params, getShape(_input), getBuffer<T>(_input), getShape(_output),
-                            getBuffer<T>(_output));
+                            getBuffer<T>(_output), _external_context->ruy_context());
 #endif
 }
 
 void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
-                             IPortableTensor *output)
+                             IPortableTensor *output,
+                             const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
   _beta = beta;
+  _external_context = external_context;
 
   if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM ||
       _input->data_type() == OperandType::QUANT_INT8_ASYMM)
@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_SOFTMAXLAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_SOFTMAXLAYER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/IPortableTensor.h>
 
 #include <exec/IFunction.h>
@@ -40,13 +42,15 @@ public:
 
   template <typename T> void softmaxQuant8();
 
-  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output);
+  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
 protected:
   const IPortableTensor *_input;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
 
 private:
   float _beta;
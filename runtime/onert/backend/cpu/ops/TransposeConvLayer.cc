@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+
+#include "../Tensor.h"
+#include "ir/Padding.h"
+#include <cker/operation/TransposeConv.h>
+
+#include <algorithm>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+TransposeConvLayer::TransposeConvLayer()
+  : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr),
+    _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _strideWidth(0),
+    _strideHeight(0), _activation(ir::Activation::NONE),
+    _transpose_conv_kernel(new nnfw::cker::TransposeConv()), _external_context(nullptr),
+    _prepare(false)
+{
+  // DO NOTHING
+}
+
+TransposeConvLayer::~TransposeConvLayer() = default;
+
+void TransposeConvLayer::transposeConvFloat32()
+{
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  CalculateActivationRange(_activation, &op_params.float_activation_min,
+                           &op_params.float_activation_max);
+
+  nnfw::cker::TransposeConv &kernel = *_transpose_conv_kernel;
+  kernel(op_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel),
+         getBuffer<float>(_kernel), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
+         getShape(_output), getBuffer<float>(_output), _external_context->ruy_context());
+}
+
+template <typename T> void TransposeConvLayer::transposeConvQuant8()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.input_offset = -_input->data_zero_point();
+  // Zero points of filter are the same, which is checked on prepare()
+  op_params.weights_offset = -_kernel->data_zero_points()[0];
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::TransposeConv &kernel = *_transpose_conv_kernel;
+  kernel(op_params, getShape(_input), getBuffer<T>(_input), getShape(_kernel),
+         getBuffer<T>(_kernel), getShape(_bias), _bias ? getBuffer<int32_t>(_bias) : nullptr,
+         getShape(_output), getBuffer<T>(_output), _external_context->ruy_context());
+}
+
+void TransposeConvLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
+                                   const IPortableTensor *bias,
+                                   const ir::PaddingType paddingType, const uint32_t paddingLeft,
+                                   const uint32_t paddingTop, const uint32_t strideWidth,
+                                   const uint32_t strideHeight, const ir::Activation activation,
+                                   IPortableTensor *output,
+                                   const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _kernel = kernel;
+  _bias = bias;
+  _paddingType = paddingType;
+  _paddingLeft = paddingLeft;
+  _paddingTop = paddingTop;
+  _strideWidth = strideWidth;
+  _strideHeight = strideHeight;
+  _activation = activation;
+  _output = output;
+  _external_context = external_context;
+}
+
+void TransposeConvLayer::run()
+{
+  prepare();
+  if (_input->is_dynamic() || _output->is_dynamic())
+  {
+    const auto ifm_shape = _input->getShape().asFeature();
+    const auto ofm_shape = _output->getShape().asFeature();
+    // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+    const auto ker_shape = _kernel->getShape();
+
+    ir::Stride stride;
+    stride.vertical = _strideHeight;
+    stride.horizontal = _strideWidth;
+
+    ir::Padding param_padding;
+    param_padding.type = _paddingType;
+    param_padding.param.left = _paddingLeft;
+    param_padding.param.top = _paddingTop;
+
+    // Padding of transposed convolution is that of the convolution from output to input
+    const auto padding = ir::calculatePadding(param_padding, ofm_shape, ifm_shape, stride,
+                                              ker_shape.dim(2), ker_shape.dim(1));
+    _paddingLeft = padding.left;
+    _paddingTop = padding.top;
+  }
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    transposeConvFloat32();
+  }
+  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    transposeConvQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    transposeConvQuant8<int8_t>();
+  }
+  else
+  {
+    throw std::runtime_error{"TransposeConv: unsupported data type"};
+  }
+}
+
+void TransposeConvLayer::prepare()
+{
+  if (_prepare)
+    return;
+
+  nnfw::cker::TransposeConv &kernel = *_transpose_conv_kernel;
+  const auto data_type = _input->data_type();
+  if (data_type == OperandType::QUANT_UINT8_ASYMM || data_type == OperandType::QUANT_INT8_ASYMM)
+  {
+    // ruy takes a single zero point for the filter
+    if (data_type == OperandType::QUANT_UINT8_ASYMM && _kernel->data_scales().size() > 1)
+      throw std::runtime_error{
+        "TransposeConv: per-channel quantized uint8 filter is not supported"};
+    const auto &zero_points = _kernel->data_zero_points();
+    if (zero_points.empty() ||
+        std::any_of(zero_points.begin(), zero_points.end(),
+                    [&](int32_t zero_point) { return zero_point != zero_points[0]; }))
+      throw std::runtime_error{"TransposeConv: filter zero points should be the same"};
+
+    // Per-tensor filter is handled as per-channel filter of the same scale
+    const int num_channels = getShape(_kernel).Dims(0);
+    GetQuantizedConvolutionMultipliersAndShifts(
+      _input->data_scale(), _output->data_scale(), _kernel->data_scales().data(),
+      _kernel->data_scales().size(), num_channels, kernel.per_channel_output_multiplier(),
+      kernel.per_channel_output_shift());
+  }
+
+  if (!_kernel->is_constant() || _kernel->is_dynamic())
+  {
+    _prepare = true;
+    return;
+  }
+
+  if (data_type == OperandType::FLOAT32)
+    kernel.prepare(getShape(_kernel), getBuffer<float>(_kernel));
+  else if (data_type == OperandType::QUANT_UINT8_ASYMM)
+    kernel.prepare(getShape(_kernel), getBuffer<uint8_t>(_kernel));
+  else if (data_type == OperandType::QUANT_INT8_ASYMM)
+    kernel.prepare(getShape(_kernel), getBuffer<int8_t>(_kernel));
+  else
+    throw std::runtime_error{"TransposeConv: unsupported data type"};
+
+  // Transposed copy is used from now on, so release the original weights
+  auto kernel_tensor = dynamic_cast<const Tensor *>(_kernel);
+  if (kernel_tensor)
+    // TODO Remove const_cast
+    const_cast<Tensor *>(kernel_tensor)->decrease_ref();
+
+  _prepare = true;
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_TRANSPOSELAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_TRANSPOSELAYER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/IPortableTensor.h>
 
 #include <exec/IFunction.h>
@@ -41,7 +43,7 @@ public:
   void transposeQuant8();
 
   void configure(const IPortableTensor *input, const IPortableTensor *perm,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -49,6 +51,7 @@ private:
   const IPortableTensor *_input;
   const IPortableTensor *_perm;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -175,7 +175,7 @@ void KernelGenerator::visit(const ir::train::operation::BinaryArithmetic &node)
 
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
   fn->configure(lhs_tensor, rhs_tensor, output_tensor, activation,
-                static_cast<cpu::ops::ArithmeticType>(arithmetic_type));
+                static_cast<cpu::ops::ArithmeticType>(arithmetic_type), _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -329,7 +329,7 @@ void KernelGenerator::visit(const ir::train::operation::ElementwiseActivation &n
   };
 
   fn->configure(input_tensor, output_tensor, node.param().alpha, node.param().beta,
-                convertToInferActivationType(node.param().op_type));
+                convertToInferActivationType(node.param().op_type), _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -601,7 +601,7 @@ void KernelGenerator::visit(const ir::train::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -42,6 +42,8 @@ struct ContextData
   std::vector<onert::ir::OperationIndex> op_order;
   /* Operands that are defined by other backends */
   util::Set<ir::OperandIndex> external_operands;
+  /* Operands that are defined by this backend and used by other backends */
+  util::Set<ir::OperandIndex> exported_operands;
   /* Custom kernel builder */
   std::shared_ptr<custom::IKernelBuilder> custom_kernel_builder;
   /* Is linear executor or not */
@@ -50,6 +50,17 @@ public:
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
 
+  /**
+   * @brief Make a tensor share the buffer of another tensor, which it overwrites in-place
+   *
+   * The shared buffer is claimed by the first tensor of the chain and released when every tensor
+   * sharing it has been released. It must be called before planning.
+   *
+   * @param[in] ind    Tensor that is written in-place
+   * @param[in] source Tensor whose buffer is reused
+   */
+  void setInplace(const ir::OperandIndex &ind, const ir::OperandIndex &source);
+
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
 
 private:
@@ -57,6 +68,10 @@ private:
   const std::shared_ptr<TensorRegistry> _tensors;
   ir::OperandIndexMap<bool> _as_constants;
   DynamicTensorManager *_dynamic_tensor_manager;
+  // Tensor written in-place -> the first tensor of its chain, which owns the buffer
+  ir::OperandIndexMap<ir::OperandIndex> _inplace_roots;
+  // The number of tensors sharing the buffer of a root that are not released yet
+  ir::OperandIndexMap<uint32_t> _inplace_refs;
 };
 
 } // namespace basic
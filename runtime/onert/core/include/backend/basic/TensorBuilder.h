@@ -52,6 +52,12 @@ public:
 
   bool isRegistered(const ir::OperandIndex &) const;
 
+  /**
+   * @brief     Let the tensor of @c ind reuse the buffer of @c source
+   *            Both must be static non-constant tensors and it must be called before planning
+   */
+  void setInplace(const ir::OperandIndex &ind, const ir::OperandIndex &source);
+
   void allocate(void);
 
   DynamicTensorManager *dynamicTensorManager(void) { return _dynamic_tensor_mgr.get(); }
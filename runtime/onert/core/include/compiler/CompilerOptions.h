@@ -65,6 +65,8 @@ struct CompilerOptions
 
   // GENERAL OPTIONS
   std::vector<std::string> backend_list;
+  bool memory_aware_order;           //< Whether to linearize operations to lower peak memory
+  std::string compilation_cache_dir; //< Directory of compilation cache, disabled if empty
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   int graph_dump_level; //< Graph dump level, values between 0 and 2 are valid
@@ -37,6 +37,13 @@ class LoweredGraph : public ILoweredGraph
 {
 public:
   LoweredGraph(const ir::Graph &graph, const compiler::CompilerOptions &options);
+  /**
+   * @brief Lower graph with backends assigned in advance (e.g. from compilation cache)
+   * @note  If any operation is not assigned or its backend is not available,
+   *        backends are scheduled as usual
+   */
+  LoweredGraph(const ir::Graph &graph, const compiler::CompilerOptions &options,
+               const std::unordered_map<ir::OperationIndex, std::string> &assigned_backends);
 
   ir::Graph &graph() override { return _graph; }
   const ir::Graph &graph() const override { return _graph; }
@@ -57,7 +64,8 @@ public:
 private:
   void makeLowerInfo(const compiler::BackendResolver &backend_resolver);
   void dumpLowerInfo();
-  void lowerGraph(const compiler::CompilerOptions &options);
+  void lowerGraph(const compiler::CompilerOptions &options,
+                  const std::unordered_map<ir::OperationIndex, std::string> *assigned_backends);
 
 private:
   /**
@@ -28,6 +28,7 @@
 
 #include <thread>
 #include <deque>
+#include <vector>
 #include <semaphore.h>
 
 namespace onert
@@ -178,6 +179,47 @@ public:
 
   ExecutionOptions &executionOptions() { return _ctx.options; }
 
+  /**
+   * @brief     Bind a pair of input and output as a state which lives across executions
+   * @param[in] input   Input index of cached entries, e.g. past keys of attention
+   * @param[in] output  Output index of entries appended by an execution
+   * @param[in] axis    Axis of entries. Dimensions before it should be 1.
+   * @param[in] length  Input index of a scalar INT32 which gets the number of cached entries
+   * @note      The state owns its buffer of as many entries as the input has along axis. Each
+   *            execution binds the whole buffer to the input with its static shape, so shape
+   *            inference does not run again, and the model should mask entries from length on.
+   *            Entries of the output are appended to the buffer after the execution.
+   */
+  void bindState(const ir::IOIndex &input, const ir::IOIndex &output, uint32_t axis,
+                 const ir::IOIndex &length);
+  /**
+   * @brief Drop cached entries of all states
+   */
+  void resetStates();
+  /**
+   * @brief     Get the number of cached entries of a state
+   * @param[in] input Input index of the state
+   * @return    The number of cached entries
+   */
+  uint32_t getStateLength(const ir::IOIndex &input) const;
+
+private:
+  struct State
+  {
+    ir::IOIndex input;
+    ir::IOIndex output;
+    ir::IOIndex length_input;
+    uint32_t axis;
+    int32_t length;     // Given to length_input as is
+    int32_t max_length; // Dimension of input at axis
+    size_t entry_size;  // Bytes of an entry
+    std::vector<uint8_t> buffer;
+    std::vector<uint8_t> appended; // Output of an execution, appended to buffer after it
+  };
+
+  void bindStateBuffers();
+  void appendStates();
+
 private:
   const IExecutor *entryExecutor() const { return _executors->entryExecutor(); };
   IExecutor *entryExecutor() { return _executors->entryExecutor(); };
@@ -187,6 +229,7 @@ private:
   ExecutionContext _ctx;
   std::unique_ptr<std::thread> _exec_thread;
   bool finished{false};
+  std::vector<State> _states;
 };
 
 } // namespace exec
@@ -37,13 +37,15 @@ public:
   {
     OUTPUT_SHAPE = 0,
     KERNEL,
-    INPUT
+    INPUT,
+    BIAS // Optional
   };
 
   struct Param
   {
     Padding padding;
     Stride stride;
+    Activation activation;
   };
 
 public:
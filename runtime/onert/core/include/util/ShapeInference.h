@@ -42,6 +42,8 @@ using Shapes = std::vector<ir::Shape>;
 
 ir::Shape inferArgMinMaxShape(const ir::Shape &input_shape, int axis, int rank);
 
+ir::Shape inferAttentionShape(const ir::Shape &query_shape, const ir::Shape &value_shape);
+
 ir::Shape inferBatchMatMulShape(const ir::Shape &lhs_shape, const ir::Shape &rhs_shape,
                                 const ir::operation::BatchMatMul::Param &param);
 
@@ -16,7 +16,11 @@
 
 #include "MemoryPlanner.h"
 #include "util/logging.h"
+
+#include <algorithm>
 #include <cassert>
+#include <limits>
+#include <numeric>
 
 namespace onert
 {
@@ -198,6 +202,174 @@ WICPlanner::MemoryPlans &WICPlanner::memory_plans()
   return _mem_plans;
 }
 
+void LifetimePlanner::claim(const ir::OperandIndex &ind, size_t size)
+{
+  assert(!_initialized);
+  assert(_live_intervals.find(ind) == _live_intervals.end());
+
+  _live_intervals[ind] = _intervals.size();
+  _intervals.push_back({ind, static_cast<uint32_t>(size), _time++,
+                        std::numeric_limits<uint32_t>::max()});
+
+  _live_size += size;
+  _lower_bound = std::max(_lower_bound, _live_size);
+
+  VERBOSE(LT_PLANNER) << "claim(" << ind << "): [" << size << "sz]" << std::endl;
+}
+
+void LifetimePlanner::release(const ir::OperandIndex &ind)
+{
+  auto it = _live_intervals.find(ind);
+  if (it == _live_intervals.end())
+  {
+    assert(!"Cannot release for given index. It has been not claimed or released already.");
+    return;
+  }
+
+  auto &interval = _intervals[it->second];
+  interval.end = _time++;
+  _live_size -= interval.size;
+  _live_intervals.erase(it);
+
+  VERBOSE(LT_PLANNER) << "release(" << ind << ")" << std::endl;
+}
+
+// Assign offsets to intervals in the given order and return the resulting capacity
+//
+// Each interval goes to the smallest gap between the blocks of already placed intervals that
+// overlap with it in time. If no gap is large enough, it goes on top of them.
+uint32_t LifetimePlanner::place(const std::vector<size_t> &order,
+                                std::vector<uint32_t> &offsets) const
+{
+  std::vector<bool> placed(_intervals.size(), false);
+  std::vector<std::pair<uint32_t, uint32_t>> occupied;
+  uint32_t capacity = 0;
+
+  for (const auto i : order)
+  {
+    const auto &interval = _intervals[i];
+
+    occupied.clear();
+    for (size_t j = 0; j < _intervals.size(); ++j)
+    {
+      const auto &other = _intervals[j];
+      if (placed[j] && interval.start < other.end && other.start < interval.end)
+        occupied.emplace_back(offsets[j], other.size);
+    }
+    std::sort(occupied.begin(), occupied.end());
+
+    uint32_t best_offset = 0;
+    uint32_t best_gap = std::numeric_limits<uint32_t>::max();
+    uint32_t cursor = 0;
+    for (const auto &[offset, size] : occupied)
+    {
+      if (offset > cursor)
+      {
+        const uint32_t gap = offset - cursor;
+        if (gap >= interval.size && gap < best_gap)
+        {
+          best_gap = gap;
+          best_offset = cursor;
+        }
+      }
+      cursor = std::max(cursor, offset + size);
+    }
+    if (best_gap == std::numeric_limits<uint32_t>::max())
+      best_offset = cursor;
+
+    offsets[i] = best_offset;
+    placed[i] = true;
+    capacity = std::max(capacity, best_offset + interval.size);
+  }
+
+  return capacity;
+}
+
+/*
+ * Build memory plans using full live intervals of operands
+ * 1. Close intervals of operands which are never released
+ * 2. Place operands in several orders
+ *   - By descending size
+ *   - By descending size * lifetime
+ *   - By descending breadth, i.e. the largest sum of live sizes during the interval, which
+ *     places the operands of the widest branches first
+ * 3. Keep the smallest plan, stopping early when it reaches the lower bound
+ */
+void LifetimePlanner::buildMemoryPlans()
+{
+  const auto num_intervals = _intervals.size();
+  const uint32_t end_of_time = _time + 1;
+  for (auto &interval : _intervals)
+    interval.end = std::min(interval.end, end_of_time);
+
+  std::vector<uint64_t> breadth_at(end_of_time, 0);
+  for (const auto &interval : _intervals)
+    for (uint32_t t = interval.start; t < interval.end; ++t)
+      breadth_at[t] += interval.size;
+
+  std::vector<uint64_t> area(num_intervals);
+  std::vector<uint64_t> breadth(num_intervals);
+  for (size_t i = 0; i < num_intervals; ++i)
+  {
+    const auto &interval = _intervals[i];
+    area[i] = static_cast<uint64_t>(interval.size) * (interval.end - interval.start);
+    breadth[i] = *std::max_element(breadth_at.begin() + interval.start,
+                                   breadth_at.begin() + interval.end);
+  }
+
+  auto order_by = [&](const std::vector<uint64_t> &key) {
+    std::vector<size_t> order(num_intervals);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      if (key[a] != key[b])
+        return key[a] > key[b];
+      return _intervals[a].size > _intervals[b].size;
+    });
+    return order;
+  };
+
+  std::vector<uint64_t> size(num_intervals);
+  for (size_t i = 0; i < num_intervals; ++i)
+    size[i] = _intervals[i].size;
+
+  std::vector<uint32_t> best_offsets(num_intervals, 0);
+  std::vector<uint32_t> offsets(num_intervals, 0);
+  _capacity = std::numeric_limits<uint32_t>::max();
+  for (const auto *key : {&size, &area, &breadth})
+  {
+    const auto capacity = place(order_by(*key), offsets);
+    VERBOSE(LT_PLANNER) << "candidate plan : " << capacity << "sz" << std::endl;
+    if (capacity < _capacity)
+    {
+      _capacity = capacity;
+      best_offsets.swap(offsets);
+    }
+    if (_capacity == _lower_bound)
+      break;
+  }
+
+  for (size_t i = 0; i < num_intervals; ++i)
+  {
+    const auto &interval = _intervals[i];
+    _mem_plans[interval.index] = {best_offsets[i], interval.size};
+    VERBOSE(LT_PLANNER) << "alloc(" << interval.index << "): [+" << best_offsets[i] << ", "
+                        << interval.size << "sz]" << std::endl;
+  }
+  VERBOSE(LT_PLANNER) << "capacity : " << _capacity << ", lower bound : " << _lower_bound
+                      << std::endl;
+
+  _initialized = true;
+  _intervals.clear();
+  _live_intervals.clear();
+}
+
+LifetimePlanner::MemoryPlans &LifetimePlanner::memory_plans()
+{
+  if (!_initialized)
+    buildMemoryPlans();
+  return _mem_plans;
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
@@ -153,6 +153,71 @@ private:
   std::multimap<uint32_t, ir::OperandIndex, std::greater<uint32_t>> _operands;
 };
 
+/**
+ * @brief Class to plan memory from full live intervals of operands
+ *
+ * claim() and release() only record when each operand becomes live and dead. Offsets are assigned
+ * once all intervals are known, placing each operand in the tightest gap left by the operands whose
+ * intervals overlap with it. Several placement orders are tried and the smallest plan is kept.
+ */
+class LifetimePlanner : public IMemoryPlanner<ir::OperandIndex>
+{
+public:
+  /**
+   * @brief Claim memory for operand, which opens its live interval
+   * @param[in] index The operand index
+   * @param[in] size The size of the memory
+   */
+  void claim(const ir::OperandIndex &, size_t) override;
+  /**
+   * @brief Release memory for operand, which closes its live interval
+   * @param[in] index The operand index
+   */
+  void release(const ir::OperandIndex &) override;
+  /**
+   * @brief Get capacity for memory planning
+   * @return The value of capacity
+   */
+  uint32_t capacity() override
+  {
+    if (!_initialized)
+      buildMemoryPlans();
+    return _capacity;
+  }
+  /**
+   * @brief Get MemoryPlans
+   * @return MemoryPlans
+   */
+  MemoryPlans &memory_plans() override;
+  /**
+   * @brief Get the largest sum of sizes of operands live at the same time
+   * @return The value no plan can go below
+   */
+  uint32_t lower_bound() const { return _lower_bound; }
+
+private:
+  struct Interval
+  {
+    ir::OperandIndex index;
+    uint32_t size;
+    uint32_t start;
+    uint32_t end;
+  };
+
+  void buildMemoryPlans();
+  uint32_t place(const std::vector<size_t> &order, std::vector<uint32_t> &offsets) const;
+
+  bool _initialized = false;
+  uint32_t _capacity = 0;
+  MemoryPlans _mem_plans;
+  // Claim and release events are numbered in order to form the live intervals
+  uint32_t _time = 0;
+  std::vector<Interval> _intervals;
+  ir::OperandIndexMap<size_t> _live_intervals;
+  uint32_t _live_size = 0;
+  uint32_t _lower_bound = 0;
+};
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
@@ -191,3 +191,88 @@ TEST(WICPlanner, claim_release_test)
   // CAPACITY - 40
   capacity(40);
 }
+
+TEST(LifetimePlanner, claim_release_test)
+{
+  ::onert::backend::basic::LifetimePlanner planner;
+
+  auto claim = [&planner](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  auto verify = [&planner](uint32_t index, uint32_t size, uint32_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+    ASSERT_EQ(mem_blk.size, size);
+  };
+
+  // Two branches from 0 joined by 5 : FirstFitPlanner leaves a hole where 1 was
+  claim(0, 10);
+  claim(1, 30);
+  claim(2, 20);
+  release(1);
+  claim(3, 40);
+  release(0);
+  release(2);
+  claim(4, 20);
+  release(3);
+  claim(5, 20);
+  release(4);
+  release(5);
+
+  // Nothing can be planned below the peak of live sizes (10 + 20 + 40)
+  ASSERT_EQ(planner.lower_bound(), 70);
+  ASSERT_EQ(planner.capacity(), 70);
+
+  verify(3, 40, 0);
+  verify(1, 30, 0);
+  verify(2, 20, 40);
+  verify(0, 10, 60);
+  verify(4, 20, 40);
+  verify(5, 20, 0);
+}
+
+TEST(LifetimePlanner, no_overlap_test)
+{
+  ::onert::backend::basic::LifetimePlanner planner;
+
+  // Operands 0..15 with various sizes and lifetimes, a few of them never released
+  const uint32_t num_operands = 16;
+  for (uint32_t i = 0; i < num_operands; ++i)
+  {
+    planner.claim(onert::ir::OperandIndex{i}, 8 * ((i * 7) % 5 + 1));
+    if (i >= 3 && i % 4 != 0)
+      planner.release(onert::ir::OperandIndex{i - 3});
+  }
+
+  auto &plans = planner.memory_plans();
+  ASSERT_EQ(plans.size(), num_operands);
+  ASSERT_GE(planner.capacity(), planner.lower_bound());
+
+  // Operands that were live at the same time must not share memory
+  auto live_together = [](uint32_t a, uint32_t b) {
+    auto released = [](uint32_t i) { return i + 3 < 16 && (i + 3) % 4 != 0; };
+    if (a > b)
+      std::swap(a, b);
+    return !released(a) || b <= a + 3;
+  };
+  for (uint32_t a = 0; a < num_operands; ++a)
+  {
+    for (uint32_t b = a + 1; b < num_operands; ++b)
+    {
+      if (!live_together(a, b))
+        continue;
+      const auto &x = plans[onert::ir::OperandIndex{a}];
+      const auto &y = plans[onert::ir::OperandIndex{b}];
+      ASSERT_TRUE(x.offset + x.size <= y.offset || y.offset + y.size <= x.offset);
+      ASSERT_LE(x.offset + x.size, planner.capacity());
+    }
+  }
+}
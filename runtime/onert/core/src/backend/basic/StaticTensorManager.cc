@@ -52,7 +52,8 @@ void StaticTensorManager::allocateNonconsts(void)
   {
     if (!_as_constants[ind] && !tensor->is_dynamic())
     {
-      auto *buffer = _nonconst_mgr->getBuffer(ind);
+      auto root = _inplace_roots.find(ind);
+      auto *buffer = _nonconst_mgr->getBuffer(root == _inplace_roots.end() ? ind : root->second);
       tensor->setBuffer(buffer);
 
       VERBOSE(CPU_StaticTensorManager)
@@ -88,6 +89,10 @@ void StaticTensorManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
   // This method is called only when a tensor has proper shape
   assert(!_tensors->getNativeTensor(ind)->is_dynamic());
 
+  // The buffer is claimed by the root of the chain
+  if (_inplace_roots.find(ind) != _inplace_roots.end())
+    return;
+
   if (!_as_constants[ind])
     _nonconst_mgr->claimPlan(ind, size);
 }
@@ -99,8 +104,34 @@ void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
   // This method is called only when a tensor has proper shape
   assert(!_tensors->getNativeTensor(ind)->is_dynamic());
 
-  if (!_as_constants[ind])
-    _nonconst_mgr->releasePlan(ind);
+  auto root_it = _inplace_roots.find(ind);
+  const auto root = root_it == _inplace_roots.end() ? ind : root_it->second;
+
+  // Keep the buffer while any tensor sharing it is alive
+  auto refs = _inplace_refs.find(root);
+  if (refs != _inplace_refs.end() && --refs->second > 0)
+    return;
+
+  if (!_as_constants[root])
+    _nonconst_mgr->releasePlan(root);
+}
+
+void StaticTensorManager::setInplace(const ir::OperandIndex &ind, const ir::OperandIndex &source)
+{
+  assert(_inplace_roots.find(ind) == _inplace_roots.end());
+
+  auto root_it = _inplace_roots.find(source);
+  const auto root = root_it == _inplace_roots.end() ? source : root_it->second;
+  _inplace_roots[ind] = root;
+
+  // The root itself is also counted
+  auto refs = _inplace_refs.find(root);
+  if (refs == _inplace_refs.end())
+    _inplace_refs[root] = 2;
+  else
+    refs->second++;
+
+  VERBOSE(CPU_StaticTensorManager) << "INPLACE " << ind << " : " << root << std::endl;
 }
 
 void StaticTensorManager::iterate(const std::function<void(const ir::OperandIndex &)> &fn)
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/StaticTensorManager.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::basic;
+
+namespace
+{
+
+class StaticTensorManagerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    _reg = std::make_shared<TensorRegistry>();
+    _dyn_mgr = std::make_unique<DynamicTensorManager>(_reg);
+    _mgr = std::make_unique<StaticTensorManager>(_reg, "FirstFit", _dyn_mgr.get());
+
+    const auto info =
+      ir::OperandInfo::createStaticInfo(ir::Shape{4}, ir::TypeInfo{ir::DataType::FLOAT32});
+    for (uint32_t i = 0; i < 5; ++i)
+      _mgr->buildTensor(ir::OperandIndex{i}, info, false);
+  }
+
+  void claim(uint32_t i) { _mgr->claimPlan(ir::OperandIndex{i}, 16); }
+  void release(uint32_t i) { _mgr->releasePlan(ir::OperandIndex{i}); }
+  uint8_t *buffer(uint32_t i) { return _reg->getNativeTensor(ir::OperandIndex{i})->buffer(); }
+
+  std::shared_ptr<TensorRegistry> _reg;
+  std::unique_ptr<DynamicTensorManager> _dyn_mgr;
+  std::unique_ptr<StaticTensorManager> _mgr;
+};
+
+} // namespace
+
+TEST_F(StaticTensorManagerTest, inplace_chain)
+{
+  // 0 -> 1 -> 2 are written in-place, 3 is claimed while 2 is alive and 4 after it died
+  _mgr->setInplace(ir::OperandIndex{1}, ir::OperandIndex{0});
+  _mgr->setInplace(ir::OperandIndex{2}, ir::OperandIndex{1});
+
+  claim(0);
+  claim(1);
+  release(0);
+  claim(2);
+  release(1);
+  claim(3);
+  release(2);
+  claim(4);
+  release(3);
+  release(4);
+
+  _mgr->allocateNonconsts();
+
+  ASSERT_NE(buffer(0), nullptr);
+  ASSERT_EQ(buffer(1), buffer(0));
+  ASSERT_EQ(buffer(2), buffer(0));
+  ASSERT_EQ(buffer(3), buffer(0) + 16);
+  ASSERT_EQ(buffer(4), buffer(0));
+}
+
+TEST_F(StaticTensorManagerTest, inplace_root_released_first)
+{
+  // The shared buffer must not be reused while the in-place tensor is alive
+  _mgr->setInplace(ir::OperandIndex{1}, ir::OperandIndex{0});
+
+  claim(0);
+  claim(1);
+  release(0);
+  claim(2);
+  release(1);
+  claim(3);
+  claim(4);
+  release(2);
+  release(3);
+  release(4);
+
+  _mgr->allocateNonconsts();
+
+  ASSERT_EQ(buffer(1), buffer(0));
+  ASSERT_EQ(buffer(2), buffer(0) + 16);
+  ASSERT_EQ(buffer(3), buffer(0));
+}
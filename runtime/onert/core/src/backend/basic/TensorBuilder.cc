@@ -81,6 +81,11 @@ bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
   return _tensor_info_map.find(ind) != _tensor_info_map.end();
 }
 
+void TensorBuilder::setInplace(const ir::OperandIndex &ind, const ir::OperandIndex &source)
+{
+  _static_tensor_mgr->setInplace(ind, source);
+}
+
 void TensorBuilder::allocate(void) { _static_tensor_mgr->allocateNonconsts(); }
 
 } // namespace basic
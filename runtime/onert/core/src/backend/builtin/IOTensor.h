@@ -54,6 +54,13 @@ public:
 
 public:
   void setTensor(IPortableTensor *tensor);
+  /**
+   * @brief Stop indirecting to the tensor set by setTensor()
+   *
+   * The tensor set by setTensor() may wrap a user buffer whose lifetime is not guaranteed after
+   * execution. After this call, buffer() returns nullptr until setTensor() is called again.
+   */
+  void resetTensor() { _tensor = _orig.get(); }
 
 public:
   uint8_t *buffer() const override { return _tensor->buffer(); }
@@ -41,6 +41,7 @@ PermuteLayer::PermuteLayer(const std::vector<ITensor *> &src_tensors,
   _src_tensors_offsets.resize(src_tensors.size());
   _dst_tensors_offsets.resize(dst_tensors.size());
   _permute_types.resize(src_tensors.size());
+  _ruy_context = _external_context->ruy_context();
 }
 
 void PermuteLayer::optimize()
@@ -116,6 +117,11 @@ void PermuteLayer::optimize()
             assert(src_tensor.getShape().rank() == 4 &&
                    (permute_type == ir::PermuteType::NHWC_TO_NCHW ||
                     permute_type == ir::PermuteType::NCHW_TO_NHWC));
+            // Tensors without padding are transposed by tiles in permute(), which is faster than
+            // tasks copying an element at a time
+            if (!src_tensor.has_padding() && !dst_tensor.has_padding())
+              return;
+
             const auto loop_shape = src_tensor.getShape();
             const auto copy_len = data_size;
 
@@ -0,0 +1,531 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompilationCache.h"
+
+#include "../exec/JSONExecTime.h"
+#include "ir/OperationVisitor.h"
+#include "util/logging.h"
+
+#include <misc/polymorphic_downcast.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <unistd.h>
+
+namespace
+{
+
+using namespace onert;
+
+constexpr const char *kMagic = "ONERT_COMPILATION_CACHE";
+constexpr uint32_t kVersion = 3;
+
+// FNV-1a
+uint64_t hashString(const std::string &str)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const auto c : str)
+  {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+void writeOptions(std::ostream &os, const compiler::CompilerOptions &options)
+{
+  os << "backends";
+  for (const auto &backend : options.backend_list)
+    os << " " << backend;
+  os << "\nexecutor " << options.executor;
+  os << "\nhe_scheduler " << options.he_scheduler;
+  os << "\nmemory_aware_order " << options.memory_aware_order;
+  os << "\nfp16_enable " << options.fp16_enable;
+
+  // HEScheduler decisions depend on the measured execution time, so a changed profile must not
+  // reuse the decisions made with an old one
+  if (options.he_scheduler)
+  {
+    std::ifstream profile(exec::JSON::default_measurement_file, std::ios::binary);
+    std::ostringstream content;
+    if (profile.is_open())
+      content << profile.rdbuf();
+    os << "\nexec_time " << std::hex << hashString(content.str()) << std::dec;
+  }
+
+  // Sort unordered maps to make the key stable
+  const auto &manual = options.manual_scheduler_options;
+  os << "\nbackend_for_all " << manual.backend_for_all;
+  std::map<std::string, std::string> opcode_to_backend;
+  for (const auto &[opcode, backend] : manual.opcode_to_backend)
+    opcode_to_backend.emplace(ir::toString(opcode), backend);
+  for (const auto &[opcode, backend] : opcode_to_backend)
+    os << "\nopcode " << opcode << " " << backend;
+  std::map<uint32_t, std::string> index_to_backend;
+  for (const auto &[index, backend] : manual.index_to_backend)
+    index_to_backend.emplace(index.value(), backend);
+  for (const auto &[index, backend] : index_to_backend)
+    os << "\nindex " << index << " " << backend;
+  os << "\n";
+}
+
+// Writes operation parameters, which are not visible from operands, as the key must differ for
+// operations of the same type with different attributes (stride, padding, activation, ...)
+class ParamWriter : public ir::OperationVisitor
+{
+public:
+  ParamWriter(std::ostream &os) : _os{os} {}
+
+public:
+  void visit(const ir::operation::ArgMinMax &node) override
+  {
+    write(node.param().output_type, node.param().is_arg_max);
+  }
+  void visit(const ir::operation::Attention &node) override
+  {
+    write(node.param().scale, node.param().causal);
+  }
+  void visit(const ir::operation::BatchMatMul &node) override
+  {
+    write(node.param().adj_x, node.param().adj_y);
+  }
+  void visit(const ir::operation::BCQFullyConnected &node) override
+  {
+    write(node.param().weights_hidden_size, node.param().activation);
+  }
+  void visit(const ir::operation::BCQGather &node) override
+  {
+    write(node.param().input_hidden_size, node.param().axis);
+  }
+  void visit(const ir::operation::BinaryArithmetic &node) override
+  {
+    write(node.param().arithmetic_type, node.param().activation);
+  }
+  void visit(const ir::operation::Bulk &node) override
+  {
+    const auto &param = node.param();
+    write(param.binary_path, param.origin_input_shapes, param.origin_output_shapes);
+  }
+  void visit(const ir::operation::Comparison &node) override
+  {
+    write(node.param().comparison_type);
+  }
+  void visit(const ir::operation::Concat &node) override { write(node.param().axis); }
+  void visit(const ir::operation::Conv2D &node) override
+  {
+    const auto &param = node.param();
+    write(param.stride, param.padding, param.activation, param.dilation);
+  }
+  void visit(const ir::operation::Custom &node) override
+  {
+    const auto &userdata = node.userdata();
+    write(node.id(), std::string(userdata.data, userdata.size));
+  }
+  void visit(const ir::operation::DepthToSpace &node) override { write(node.param().block_size); }
+  void visit(const ir::operation::DepthwiseConv2D &node) override
+  {
+    const auto &param = node.param();
+    write(param.stride, param.padding, param.multiplier, param.activation, param.dilation);
+  }
+  void visit(const ir::operation::DetectionPostProcess &node) override
+  {
+    const auto &param = node.param();
+    write(param.max_detections, param.score_threshold, param.iou_threshold,
+          param.max_boxes_per_class, param.num_classes, param.max_classes_per_detection,
+          param.center_size_boxes, param.do_fast_eval, param.scale.y_scale, param.scale.x_scale,
+          param.scale.h_scale, param.scale.w_scale);
+  }
+  void visit(const ir::operation::Einsum &node) override { write(node.param().equation); }
+  void visit(const ir::operation::ElementwiseActivation &node) override
+  {
+    write(node.param().op_type, node.param().alpha, node.param().beta);
+  }
+  void visit(const ir::operation::ElementwiseBinary &node) override
+  {
+    write(node.param().op_type);
+  }
+  void visit(const ir::operation::ElementwiseUnary &node) override
+  {
+    write(node.param().op_type);
+  }
+  void visit(const ir::operation::FullyConnected &node) override
+  {
+    write(node.param().activation, node.param().weights_format);
+  }
+  void visit(const ir::operation::FusedBatchNorm &node) override
+  {
+    write(node.param().is_training, node.param().data_format, node.param().epsilon);
+  }
+  void visit(const ir::operation::Gather &node) override { write(node.param().axis); }
+  void visit(const ir::operation::If &node) override
+  {
+    write(node.param().then_subg_index, node.param().else_subg_index);
+  }
+  void visit(const ir::operation::InstanceNorm &node) override
+  {
+    write(node.param().activation, node.param().epsilon);
+  }
+  void visit(const ir::operation::LocalResponseNormalization &node) override
+  {
+    const auto &param = node.param();
+    write(param.radius, param.bias, param.alpha, param.beta);
+  }
+  void visit(const ir::operation::LogSoftmax &node) override
+  {
+    write(node.param().beta, node.param().axis);
+  }
+  void visit(const ir::operation::LSTM &node) override
+  {
+    const auto &param = node.param();
+    write(param.activation, param.cell_threshold, param.projection_threshold, param.time_major);
+  }
+  void visit(const ir::operation::OneHot &node) override { write(node.param().axis); }
+  void visit(const ir::operation::Pack &node) override
+  {
+    write(node.param().num, node.param().axis);
+  }
+  void visit(const ir::operation::Pool2D &node) override
+  {
+    const auto &param = node.param();
+    write(param.op_type, param.kh, param.kw, param.stride, param.padding, param.activation);
+  }
+  void visit(const ir::operation::Reduce &node) override
+  {
+    write(node.param().reduce_type, node.param().keep_dims);
+  }
+  void visit(const ir::operation::Reshape &node) override { write(node.param().new_shape); }
+  void visit(const ir::operation::ResizeBilinear &node) override
+  {
+    const auto &param = node.param();
+    write(param.height_out, param.width_out, param.align_corners, param.half_pixel_centers);
+  }
+  void visit(const ir::operation::ResizeNearestNeighbor &node) override
+  {
+    const auto &param = node.param();
+    write(param.height_out, param.width_out, param.align_corners);
+  }
+  void visit(const ir::operation::RmsNorm &node) override { write(node.param().epsilon); }
+  void visit(const ir::operation::RNN &node) override { write(node.param().activation); }
+  void visit(const ir::operation::Softmax &node) override { write(node.param().beta); }
+  void visit(const ir::operation::SpaceToDepth &node) override { write(node.param().block_size); }
+  void visit(const ir::operation::Split &node) override { write(node.param().num_splits); }
+  void visit(const ir::operation::SplitV &node) override { write(node.param().num_splits); }
+  void visit(const ir::operation::Squeeze &node) override
+  {
+    const auto &param = node.param();
+    write(std::vector<int>(param.dims, param.dims + param.ndim));
+  }
+  void visit(const ir::operation::StridedSlice &node) override
+  {
+    const auto &param = node.param();
+    write(param.begin_mask, param.end_mask, param.shrink_axis_mask);
+  }
+  void visit(const ir::operation::TopKV2 &node) override { write(node.param().k); }
+  void visit(const ir::operation::TransposeConv &node) override
+  {
+    write(node.param().padding, node.param().stride, node.param().activation);
+  }
+  void visit(const ir::operation::Unpack &node) override
+  {
+    write(node.param().num, node.param().axis);
+  }
+  void visit(const ir::operation::While &node) override
+  {
+    write(node.param().cond_subg_index, node.param().body_subg_index);
+  }
+
+private:
+  template <typename... Args> void write(const Args &...args)
+  {
+    _os << " {";
+    (put(args), ...);
+    _os << " }";
+  }
+
+  template <typename T> void put(const T &value)
+  {
+    if constexpr (std::is_enum_v<T>)
+      _os << " " << static_cast<int64_t>(value);
+    else
+      _os << " " << value;
+  }
+  // Bit pattern keeps the key exact regardless of stream precision
+  void put(float value)
+  {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    _os << " f" << bits;
+  }
+  // Length prefix keeps strings with spaces unambiguous
+  void put(const std::string &str) { _os << " " << str.size() << ":" << str; }
+  void put(const ir::SubgraphIndex &index) { _os << " " << index.value(); }
+  void put(const ir::Stride &stride)
+  {
+    put(stride.vertical);
+    put(stride.horizontal);
+  }
+  void put(const ir::Dilation &dilation)
+  {
+    put(dilation.width_factor);
+    put(dilation.height_factor);
+  }
+  void put(const ir::Padding &padding)
+  {
+    put(padding.type);
+    put(padding.param.left);
+    put(padding.param.right);
+    put(padding.param.top);
+    put(padding.param.bottom);
+  }
+  void put(const ir::Shape &shape)
+  {
+    _os << " [";
+    for (int i = 0; i < shape.rank(); ++i)
+      put(shape.dim(i));
+    _os << " ]";
+  }
+  template <typename T> void put(const std::vector<T> &values)
+  {
+    _os << " [";
+    for (const auto &value : values)
+      put(value);
+    _os << " ]";
+  }
+
+private:
+  std::ostream &_os;
+};
+
+void writeGraph(std::ostream &os, const ir::Graph &graph)
+{
+  // Operands and operations are iterated in index order
+  graph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    const auto &info = operand.info();
+    os << "operand " << index.value() << " " << static_cast<int>(info.typeInfo().type());
+    os << " [";
+    for (int i = 0; i < info.shape().rank(); ++i)
+      os << " " << info.shape().dim(i);
+    os << " ] " << info.isConstant() << info.isVariable() << info.isDynamic();
+    // Quantization parameters may decide kernels, e.g. per-channel or per-tensor
+    os << " (";
+    for (const auto scale : info.typeInfo().scales())
+    {
+      uint32_t bits = 0;
+      std::memcpy(&bits, &scale, sizeof(bits));
+      os << " " << bits;
+    }
+    os << " ) (";
+    for (const auto zero_point : info.typeInfo().zero_points())
+      os << " " << zero_point;
+    os << " )\n";
+  });
+  ParamWriter param_writer{os};
+  graph.operations().iterate([&](const ir::OperationIndex &index, const ir::IOperation &op) {
+    os << "operation " << index.value() << " " << op.name() << " (";
+    for (const auto &ind : op.getInputs())
+      os << " " << ind.value();
+    os << " ) (";
+    for (const auto &ind : op.getOutputs())
+      os << " " << ind.value();
+    os << " )";
+    op.accept(param_writer);
+    os << "\n";
+  });
+  os << "inputs";
+  for (const auto &ind : graph.getInputs())
+    os << " " << ind.value();
+  os << "\noutputs";
+  for (const auto &ind : graph.getOutputs())
+    os << " " << ind.value();
+  os << "\n";
+}
+
+std::string cacheKey(const ir::Model &model, const compiler::CompilerOptions &options)
+{
+  std::ostringstream oss;
+  oss << kMagic << " " << kVersion << "\n";
+  writeOptions(oss, options);
+  model.iterate([&](const ir::SubgraphIndex &index, const ir::IGraph &graph) {
+    oss << "subgraph " << index.value() << "\n";
+    writeGraph(oss, nnfw::misc::polymorphic_downcast<const ir::Graph &>(graph));
+  });
+
+  std::ostringstream key;
+  key << std::hex << hashString(oss.str());
+  return key.str();
+}
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+
+CompilationCache::CompilationCache(const std::string &dir, const ir::Model &model,
+                                   const CompilerOptions &options)
+  : _path{dir + "/" + cacheKey(model, options) + ".cache"}
+{
+  // DO NOTHING
+}
+
+bool CompilationCache::load()
+{
+  std::ifstream ifs(_path);
+  if (!ifs.is_open())
+    return false;
+
+  std::string magic;
+  uint32_t version = 0;
+  ifs >> magic >> version;
+  if (magic != kMagic || version != kVersion)
+  {
+    VERBOSE(CompilationCache) << "Ignore incompatible cache file " << _path << std::endl;
+    return false;
+  }
+
+  // Format
+  //   subgraph <index> <number of backend assignments> <number of operations in order>
+  //   <operation index> <backend id>
+  //   ...
+  //   <operation index> <operation index> ...
+  std::unordered_map<ir::SubgraphIndex, Entry> entries;
+  std::string tag;
+  while (ifs >> tag)
+  {
+    uint32_t subg_index = 0;
+    size_t num_backends = 0;
+    size_t num_ops = 0;
+    if (tag != "subgraph" || !(ifs >> subg_index >> num_backends >> num_ops))
+      return false;
+
+    Entry entry;
+    for (size_t i = 0; i < num_backends; ++i)
+    {
+      uint32_t op_index = 0;
+      std::string backend_id;
+      if (!(ifs >> op_index >> backend_id))
+        return false;
+      entry.backends.emplace(ir::OperationIndex{op_index}, backend_id);
+    }
+    for (size_t i = 0; i < num_ops; ++i)
+    {
+      uint32_t op_index = 0;
+      if (!(ifs >> op_index))
+        return false;
+      entry.op_order.emplace_back(op_index);
+    }
+    entries.emplace(ir::SubgraphIndex{static_cast<uint16_t>(subg_index)}, std::move(entry));
+  }
+
+  _entries = std::move(entries);
+  _updated = false;
+  VERBOSE(CompilationCache) << "Loaded " << _path << std::endl;
+  return true;
+}
+
+void CompilationCache::store() const
+{
+  const auto tmp_path = _path + "." + std::to_string(getpid()) + ".tmp";
+  {
+    std::ofstream ofs(tmp_path);
+    if (!ofs.is_open())
+    {
+      VERBOSE(CompilationCache) << "Cannot write " << tmp_path << std::endl;
+      return;
+    }
+
+    ofs << kMagic << " " << kVersion << "\n";
+    // Sort to make the file deterministic
+    std::map<uint32_t, const Entry *> entries;
+    for (const auto &[index, entry] : _entries)
+      entries.emplace(index.value(), &entry);
+    for (const auto &[index, entry] : entries)
+    {
+      ofs << "subgraph " << index << " " << entry->backends.size() << " "
+          << entry->op_order.size() << "\n";
+      std::map<uint32_t, std::string> backends;
+      for (const auto &[op_index, backend_id] : entry->backends)
+        backends.emplace(op_index.value(), backend_id);
+      for (const auto &[op_index, backend_id] : backends)
+        ofs << op_index << " " << backend_id << "\n";
+      for (const auto &op_index : entry->op_order)
+        ofs << op_index.value() << " ";
+      ofs << "\n";
+    }
+
+    if (!ofs.good())
+    {
+      std::remove(tmp_path.c_str());
+      return;
+    }
+  }
+
+  if (std::rename(tmp_path.c_str(), _path.c_str()) != 0)
+  {
+    VERBOSE(CompilationCache) << "Cannot write " << _path << std::endl;
+    std::remove(tmp_path.c_str());
+  }
+}
+
+const CompilationCache::Entry *CompilationCache::find(const ir::SubgraphIndex &index) const
+{
+  auto it = _entries.find(index);
+  return it == _entries.end() ? nullptr : &it->second;
+}
+
+void CompilationCache::update(const ir::SubgraphIndex &index, Entry &&entry)
+{
+  auto it = _entries.find(index);
+  if (it != _entries.end() && it->second == entry)
+    return;
+
+  _entries[index] = std::move(entry);
+  _updated = true;
+}
+
+bool CompilationCache::isValidOrder(const ir::Graph &graph,
+                                    const std::vector<ir::OperationIndex> &order)
+{
+  if (order.size() != graph.operations().size())
+    return false;
+
+  ir::OperationIndexMap<bool> visited;
+  for (const auto &op_index : order)
+  {
+    if (!graph.operations().exist(op_index) || visited.count(op_index) > 0)
+      return false;
+
+    // All operations defining inputs must come before
+    const auto &op = graph.operations().at(op_index);
+    for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED)
+    {
+      const auto def = graph.operands().at(ind).getDef();
+      if (def.valid() && visited.count(def) == 0)
+        return false;
+    }
+    visited[op_index] = true;
+  }
+  return true;
+}
+
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_COMPILATION_CACHE_H__
+#define __ONERT_COMPILER_COMPILATION_CACHE_H__
+
+#include "compiler/CompilerOptions.h"
+#include "ir/Graph.h"
+#include "ir/Index.h"
+#include "ir/Model.h"
+#include "ir/OperationIndexMap.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Scheduler decisions of a model persisted across processes
+ *
+ * Kernels and tensors hold process-local memory, so they are generated on every compilation.
+ * This keeps only the decisions that depend on graph structure, compiler options and, for
+ * HEScheduler, the execution time profile: backend assignment of operations and execution order
+ * of the lowered graph.
+ *
+ * @note  Only the scheduler and linearization are skipped on a cache hit. Lowering, permutation
+ *        insertion, shape inference and validation, tensor and memory planning and kernel
+ *        generation still run on every compilation, so a hit saves little for ManualScheduler
+ *        with the default topological order.
+ *
+ * Cache file is named after the hash of graph structure, operation parameters, quantization
+ * parameters, options and the execution time profile in the cache directory. Constant values are
+ * not hashed as the decisions do not depend on them.
+ */
+class CompilationCache
+{
+public:
+  struct Entry
+  {
+    // Backend id for each operation of the graph before lowering
+    std::unordered_map<ir::OperationIndex, std::string> backends;
+    // Execution order of operations of the lowered graph
+    std::vector<ir::OperationIndex> op_order;
+
+    bool operator==(const Entry &other) const
+    {
+      return backends == other.backends && op_order == other.op_order;
+    }
+  };
+
+public:
+  CompilationCache(const std::string &dir, const ir::Model &model, const CompilerOptions &options);
+
+public:
+  /**
+   * @brief Load cache file
+   * @return @c true if a cache file for the model and options is loaded, otherwise @c false
+   */
+  bool load();
+  /**
+   * @brief Store entries into cache file
+   * @note  It writes a temporary file and renames it, so processes sharing the cache directory
+   *        never see a partially written file
+   */
+  void store() const;
+
+  const Entry *find(const ir::SubgraphIndex &index) const;
+  void update(const ir::SubgraphIndex &index, Entry &&entry);
+  bool isUpdated() const { return _updated; }
+
+  const std::string &path() const { return _path; }
+
+public:
+  /**
+   * @brief Check whether the order is a complete topological order of operations in the graph
+   */
+  static bool isValidOrder(const ir::Graph &graph, const std::vector<ir::OperationIndex> &order);
+
+private:
+  std::string _path;
+  std::unordered_map<ir::SubgraphIndex, Entry> _entries;
+  bool _updated = false;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_COMPILATION_CACHE_H__
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompilationCache.h"
+
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+using namespace onert;
+
+namespace
+{
+
+/*
+ * in -> op0 -> t0 -> op1 -> out
+ */
+std::shared_ptr<ir::Graph>
+createChainGraph(ir::Activation activation = ir::Activation::NONE,
+                 const ir::TypeInfo &type = ir::TypeInfo{ir::DataType::FLOAT32})
+{
+  auto graph = std::make_shared<ir::Graph>();
+  ir::Shape shape{4};
+  auto in = graph->addOperand(shape, type);
+  auto t0 = graph->addOperand(shape, type);
+  auto out = graph->addOperand(shape, type);
+
+  ir::operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = ir::operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = activation;
+  graph->addOperation(std::make_unique<ir::operation::BinaryArithmetic>(
+    ir::OperandIndexSequence{in, in}, ir::OperandIndexSequence{t0}, param));
+  graph->addOperation(std::make_unique<ir::operation::BinaryArithmetic>(
+    ir::OperandIndexSequence{t0, t0}, ir::OperandIndexSequence{out}, param));
+
+  graph->addInput(in);
+  graph->addOutput(out);
+  graph->verify();
+  return graph;
+}
+
+class CompilationCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char dir_template[] = "/tmp/onert_cache_test_XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), nullptr);
+    _dir = dir_template;
+
+    _graph = createChainGraph();
+    _model.push(ir::SubgraphIndex{0}, _graph);
+    _options = compiler::CompilerOptions::fromGlobalConfig();
+  }
+
+  void TearDown() override
+  {
+    compiler::CompilationCache cache{_dir, _model, *_options};
+    std::remove(cache.path().c_str());
+    rmdir(_dir.c_str());
+  }
+
+protected:
+  std::string _dir;
+  std::shared_ptr<ir::Graph> _graph;
+  ir::Model _model;
+  std::unique_ptr<compiler::CompilerOptions> _options;
+};
+
+} // namespace
+
+TEST_F(CompilationCacheTest, store_and_load)
+{
+  compiler::CompilationCache::Entry entry;
+  entry.backends.emplace(ir::OperationIndex{0}, "cpu");
+  entry.backends.emplace(ir::OperationIndex{1}, "ruy");
+  entry.op_order = {ir::OperationIndex{0}, ir::OperationIndex{1}};
+
+  {
+    compiler::CompilationCache cache{_dir, _model, *_options};
+    ASSERT_FALSE(cache.load());
+    cache.update(ir::SubgraphIndex{0}, compiler::CompilationCache::Entry{entry});
+    ASSERT_TRUE(cache.isUpdated());
+    cache.store();
+  }
+
+  compiler::CompilationCache cache{_dir, _model, *_options};
+  ASSERT_TRUE(cache.load());
+  const auto loaded = cache.find(ir::SubgraphIndex{0});
+  ASSERT_NE(loaded, nullptr);
+  ASSERT_EQ(*loaded, entry);
+  ASSERT_EQ(cache.find(ir::SubgraphIndex{1}), nullptr);
+
+  // Same entry does not need to be stored again
+  cache.update(ir::SubgraphIndex{0}, compiler::CompilationCache::Entry{entry});
+  ASSERT_FALSE(cache.isUpdated());
+}
+
+TEST_F(CompilationCacheTest, key_depends_on_options)
+{
+  compiler::CompilationCache cache{_dir, _model, *_options};
+
+  _options->memory_aware_order = !_options->memory_aware_order;
+  compiler::CompilationCache other{_dir, _model, *_options};
+  _options->memory_aware_order = !_options->memory_aware_order;
+
+  ASSERT_NE(cache.path(), other.path());
+}
+
+TEST_F(CompilationCacheTest, key_depends_on_operation_params)
+{
+  compiler::CompilationCache cache{_dir, _model, *_options};
+
+  ir::Model relu_model;
+  relu_model.push(ir::SubgraphIndex{0}, createChainGraph(ir::Activation::RELU));
+  compiler::CompilationCache other{_dir, relu_model, *_options};
+
+  ASSERT_NE(cache.path(), other.path());
+}
+
+TEST_F(CompilationCacheTest, key_depends_on_quantization)
+{
+  ir::Model model;
+  model.push(ir::SubgraphIndex{0},
+             createChainGraph(ir::Activation::NONE,
+                              ir::TypeInfo{ir::DataType::QUANT_UINT8_ASYMM, 0.5f, 3}));
+  compiler::CompilationCache cache{_dir, model, *_options};
+
+  ir::Model other_model;
+  other_model.push(ir::SubgraphIndex{0},
+                   createChainGraph(ir::Activation::NONE,
+                                    ir::TypeInfo{ir::DataType::QUANT_UINT8_ASYMM, 0.25f, 3}));
+  compiler::CompilationCache other{_dir, other_model, *_options};
+
+  ASSERT_NE(cache.path(), other.path());
+}
+
+TEST_F(CompilationCacheTest, key_depends_on_exec_time_profile)
+{
+  auto write_profile = [](const char *content) {
+    FILE *fp = std::fopen("exec_time.json", "w");
+    ASSERT_NE(fp, nullptr);
+    std::fputs(content, fp);
+    std::fclose(fp);
+  };
+
+  _options->he_scheduler = true;
+  write_profile("{\"cpu\": {\"Add\": {\"0\": {\"4\": 10}}}}");
+  compiler::CompilationCache cache{_dir, _model, *_options};
+  write_profile("{\"cpu\": {\"Add\": {\"0\": {\"4\": 20}}}}");
+  compiler::CompilationCache other{_dir, _model, *_options};
+  _options->he_scheduler = false;
+  EXPECT_EQ(std::remove("exec_time.json"), 0);
+
+  ASSERT_NE(cache.path(), other.path());
+}
+
+TEST_F(CompilationCacheTest, valid_order)
+{
+  ASSERT_TRUE(compiler::CompilationCache::isValidOrder(
+    *_graph, {ir::OperationIndex{0}, ir::OperationIndex{1}}));
+}
+
+TEST_F(CompilationCacheTest, neg_invalid_order)
+{
+  using compiler::CompilationCache;
+  const ir::OperationIndex op0{0};
+  const ir::OperationIndex op1{1};
+  // Not topological
+  ASSERT_FALSE(CompilationCache::isValidOrder(*_graph, {op1, op0}));
+  // Incomplete
+  ASSERT_FALSE(CompilationCache::isValidOrder(*_graph, {op0}));
+  // Duplicated
+  ASSERT_FALSE(CompilationCache::isValidOrder(*_graph, {op0, op0}));
+  // Unknown operation
+  ASSERT_FALSE(CompilationCache::isValidOrder(*_graph, {op0, ir::OperationIndex{5}}));
+}
+
+TEST_F(CompilationCacheTest, neg_corrupted_file)
+{
+  compiler::CompilationCache cache{_dir, _model, *_options};
+  {
+    FILE *fp = std::fopen(cache.path().c_str(), "w");
+    ASSERT_NE(fp, nullptr);
+    std::fputs("ONERT_COMPILATION_CACHE 3\nsubgraph 0 2 2\n0 cpu\n", fp);
+    std::fclose(fp);
+  }
+  ASSERT_FALSE(cache.load());
+  ASSERT_EQ(cache.find(ir::SubgraphIndex{0}), nullptr);
+}
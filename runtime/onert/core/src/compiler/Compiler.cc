@@ -16,8 +16,10 @@
 
 #include "compiler/Compiler.h"
 
+#include "CompilationCache.h"
 #include "CompilerHelpers.h"
 #include "ExecutorFactory.h"
+#include "Linear.h"
 #include "ShapeValidator.h"
 #include "pass/ConstantOutputPass.h"
 #include "pass/OddOutputPass.h"
@@ -93,6 +95,17 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
     pass::PassRunner{}.append(std::make_unique<pass::UnusedOperandEliminationPass>(subg)).run();
   });
 
+  // Compilation cache: reuse backend assignment and execution order of previous compilation
+  // Profiling mode is excluded because it measures every backend on purpose
+  std::unique_ptr<CompilationCache> cache;
+  if (!_options->compilation_cache_dir.empty() && !_options->he_profiling_mode)
+  {
+    cache = std::make_unique<CompilationCache>(_options->compilation_cache_dir, *_model, *_options);
+    if (!cache->load())
+      VERBOSE(Compiler) << "Compilation cache miss: " << cache->path() << std::endl;
+  }
+  std::unordered_map<ir::SubgraphIndex, CompilationCache::Entry> cache_entries;
+
   /***************************************************
    * Backend independent analysis & optimization phase
    ***************************************************/
@@ -110,7 +123,22 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
       auto &subg = nnfw::misc::polymorphic_downcast<ir::Graph &>(graph);
 
       // Lower: Assign backend
-      lowered_subgs[subg_index] = std::make_unique<compiler::LoweredGraph>(subg, *_options);
+      const auto cached = cache ? cache->find(subg_index) : nullptr;
+      if (cached)
+        lowered_subgs[subg_index] =
+          std::make_unique<compiler::LoweredGraph>(subg, *_options, cached->backends);
+      else
+        lowered_subgs[subg_index] = std::make_unique<compiler::LoweredGraph>(subg, *_options);
+
+      if (cache)
+      {
+        // Record backends of operations before lowering, as the cache key is built on them
+        const auto &lower_info = lowered_subgs[subg_index]->lower_info();
+        auto &backends = cache_entries[subg_index].backends;
+        subg.operations().iterate([&](const ir::OperationIndex &op_index, const ir::IOperation &) {
+          backends.emplace(op_index, lower_info.operation.at(op_index)->config()->id());
+        });
+      }
       // Set tracing_ctx for copied graph
       tracing_ctx->setSubgraphIndex(&(lowered_subgs[subg_index]->graph()), subg_index.value());
     });
@@ -172,12 +200,28 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
     args.options = _options;
     args.model_index = model_index;
     args.custom_kernel_builder = custom_kernel_builder;
+    if (cache)
+    {
+      const auto cached = cache->find(subg_index);
+      const auto &graph = lowered_subg->graph();
+      if (cached && CompilationCache::isValidOrder(graph, cached->op_order))
+        args.op_order = cached->op_order;
+      else
+        args.op_order = Linear::linearize(graph, _options->memory_aware_order);
+
+      auto &entry = cache_entries.at(subg_index);
+      entry.op_order = args.op_order;
+      cache->update(subg_index, std::move(entry));
+    }
     auto executor = std::unique_ptr<exec::IExecutor>{
       ExecutorFactory::get().create(std::move(lowered_subg), executors, args)};
     executor->setIndexedRanks(indexed_ranks);
     executors->emplace(model_index, subg_index, std::move(executor));
   }
 
+  if (cache && cache->isUpdated())
+    cache->store();
+
   /********************************
    * Code generation phase finished
    ********************************/
@@ -80,10 +80,12 @@ std::unique_ptr<CompilerOptions> CompilerOptions::fromGlobalConfig()
   o->backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
   o->graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   o->executor = util::getConfigString(util::config::EXECUTOR);
+  o->memory_aware_order = util::getConfigBool(util::config::MEMORY_AWARE_ORDER);
   o->he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   o->he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
   o->fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
   o->workspace_dir = util::getConfigString(util::config::WORKSPACE_DIR);
+  o->compilation_cache_dir = util::getConfigString(util::config::COMPILATION_CACHE_DIR);
   {
     // Backend for all
     auto &ms_options = o->manual_scheduler_options;
@@ -133,6 +135,8 @@ void CompilerOptions::verboseOptions()
                     << nnfw::misc::join(backend_list.begin(), backend_list.end(), "/") << std::endl;
   VERBOSE(Compiler) << "graph_dump_level         : " << graph_dump_level << std::endl;
   VERBOSE(Compiler) << "executor                 : " << executor << std::endl;
+  VERBOSE(Compiler) << "memory_aware_order       : " << memory_aware_order << std::endl;
+  VERBOSE(Compiler) << "compilation_cache_dir    : " << compilation_cache_dir << std::endl;
   VERBOSE(Compiler) << "manual backend_for_all   : " << manual_scheduler_options.backend_for_all
                     << std::endl;
   VERBOSE(Compiler) << "manual_scheduler_options : "
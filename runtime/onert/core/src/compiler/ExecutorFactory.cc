@@ -145,7 +145,8 @@ void initializeSubgraphIOTensors(compiler::ILoweredGraph &lowered_graph,
 
 backend::BackendContexts
 createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
-                      std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder)
+                      std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder,
+                      const std::vector<ir::OperationIndex> &whole_op_order)
 {
   backend::BackendContexts contexts;
   std::unordered_map<const backend::Backend *, backend::ContextData> context_data_map;
@@ -207,6 +208,11 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
           assert(new_operand_ind == operand_ind);
 
           external_operands.add(operand_ind);
+
+          // Let the defining backend know that this operand is read outside of it
+          const auto &def_backends = lgraph.lower_info().operand.at(operand_ind).def_backends();
+          if (def_backends.size() != 0 && def_backends.getOnlyElement() != backend)
+            context_data_map[def_backends.getOnlyElement()].exported_operands.add(operand_ind);
         }
 
         auto new_op_ind = partial_graph.addOperation(op_ind, clone(operation));
@@ -216,7 +222,6 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
     });
 
   // Create contexts
-  auto whole_op_order = lgraph.graph().topolSortOperations();
   for (auto &&[backend, data] : context_data_map)
   {
     auto graph = data.graph.get();
@@ -388,8 +393,14 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   auto custom_kernel_builder = args.custom_kernel_builder;
   auto &graph = lowered_graph->graph();
 
-  backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+  // linearize
+  // NOTE Backends plan their tensors along this order, so it must be decided before contexts
+  auto order =
+    args.op_order.empty() ? Linear::linearize(graph, options->memory_aware_order) : args.op_order;
+  Linear::dump(*lowered_graph, order);
+
+  backend::BackendContexts backend_contexts = createBackendContexts(
+    *lowered_graph, options->executor == "Linear", custom_kernel_builder, order);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -398,10 +409,6 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
     (lowered_graph->graph().getInputs() + lowered_graph->graph().getOutputs()) |
       ir::Remove::DUPLICATED | ir::Remove::UNDEFINED);
 
-  // linearize
-  auto order = Linear::linearize(*lowered_graph);
-  Linear::dump(*lowered_graph, order);
-
   for (auto &&pair : backend_contexts)
   {
     pair.second->genTensors();
@@ -516,8 +523,11 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   const auto tracing_ctx = args.tracing_ctx;
   auto custom_kernel_builder = args.custom_kernel_builder;
 
-  backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+  const auto order = args.op_order.empty()
+                       ? Linear::linearize(lowered_graph->graph(), options->memory_aware_order)
+                       : args.op_order;
+  backend::BackendContexts backend_contexts = createBackendContexts(
+    *lowered_graph, options->executor == "Linear", custom_kernel_builder, order);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -659,8 +669,8 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
 
   // TODO Create context only once instead of replacing
   backend::train::TrainableBackendContexts tbackend_contexts;
-  backend::BackendContexts base_backend_contexts =
-    createBackendContexts(*lowered_graph, true, custom_kernel_builder);
+  backend::BackendContexts base_backend_contexts = createBackendContexts(
+    *lowered_graph, true, custom_kernel_builder, lowered_graph->graph().topolSortOperations());
 
   // Replace BackendContext with TrainbleBackendContext
   for (auto &&pair : base_backend_contexts)
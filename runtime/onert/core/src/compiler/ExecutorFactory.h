@@ -41,6 +41,8 @@ struct ExecutorFactoryArgs
   const compiler::CompilerOptions *options;
   ir::ModelIndex model_index;
   std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder;
+  // Execution order decided in advance (e.g. from compilation cache). Linearized if empty.
+  std::vector<ir::OperationIndex> op_order;
 };
 
 class ExecutorFactory
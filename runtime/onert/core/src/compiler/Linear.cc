@@ -20,7 +20,127 @@
 
 #include "util/logging.h"
 
+#include <algorithm>
 #include <sstream>
+#include <unordered_map>
+
+namespace
+{
+
+using namespace onert;
+
+// Bytes of the operand that memory planners account for
+uint64_t plannedSize(const ir::Graph &graph, const ir::OperandIndex &ind)
+{
+  const auto &operand = graph.operands().at(ind);
+  if (operand.isConstant() || operand.info().isDynamic())
+    return 0;
+  if (graph.getInputs().contains(ind) || graph.getOutputs().contains(ind))
+    return 0;
+  return operand.info().total_size();
+}
+
+/*
+ * Greedy list scheduling over ready operations
+ * - Among ready operations, pick the one that grows live bytes the least, i.e. the one whose
+ *   outputs are small and which is the last user of large inputs
+ * - On ties, continue the branch of the previous operation, then follow operation index
+ */
+std::vector<ir::OperationIndex> memoryAwareOrder(const ir::Graph &graph)
+{
+  ir::OperandIndexMap<uint32_t> remaining_uses;
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    remaining_uses[ind] = obj.getUses().size();
+  });
+
+  // The number of input operands whose producer is not scheduled yet
+  std::unordered_map<ir::OperationIndex, uint32_t> num_pending;
+  std::vector<ir::OperationIndex> ready;
+  graph.operations().iterate([&](const ir::OperationIndex &ind, const ir::IOperation &op) {
+    uint32_t pending = 0;
+    for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (graph.operands().at(input).getDef().valid())
+        pending++;
+    }
+    num_pending[ind] = pending;
+    if (pending == 0)
+      ready.emplace_back(ind);
+  });
+
+  auto growth = [&](const ir::IOperation &op) {
+    int64_t bytes = 0;
+    for (const auto &output : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      bytes += plannedSize(graph, output);
+    for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (remaining_uses[input] == 1)
+        bytes -= plannedSize(graph, input);
+    }
+    return bytes;
+  };
+
+  std::vector<ir::OperationIndex> order;
+  order.reserve(graph.operations().size());
+  ir::OperationIndex prev;
+  while (!ready.empty())
+  {
+    auto continues_prev = [&](const ir::IOperation &op) {
+      if (!prev.valid())
+        return false;
+      for (const auto &input : op.getInputs() | ir::Remove::UNDEFINED)
+      {
+        if (graph.operands().at(input).getDef() == prev)
+          return true;
+      }
+      return false;
+    };
+
+    size_t best = 0;
+    int64_t best_growth = 0;
+    bool best_continues = false;
+    for (size_t i = 0; i < ready.size(); ++i)
+    {
+      const auto &op = graph.operations().at(ready[i]);
+      const auto op_growth = growth(op);
+      const auto op_continues = continues_prev(op);
+      const bool better = [&] {
+        if (i == 0 || op_growth != best_growth)
+          return i == 0 || op_growth < best_growth;
+        if (op_continues != best_continues)
+          return op_continues;
+        return ready[i].value() < ready[best].value();
+      }();
+      if (better)
+      {
+        best = i;
+        best_growth = op_growth;
+        best_continues = op_continues;
+      }
+    }
+
+    const auto ind = ready[best];
+    ready.erase(ready.begin() + best);
+    order.emplace_back(ind);
+    prev = ind;
+
+    const auto &op = graph.operations().at(ind);
+    for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      remaining_uses[input]--;
+    for (const auto &output : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      for (const auto &use : graph.operands().at(output).getUses())
+      {
+        if (--num_pending[use] == 0)
+          ready.emplace_back(use);
+      }
+    }
+  }
+
+  return order;
+}
+
+} // namespace
 
 namespace onert
 {
@@ -30,7 +150,54 @@ namespace compiler
 // TODO(easy) Change the LoweredGraph param to Graph
 std::vector<ir::OperationIndex> Linear::linearize(const compiler::ILoweredGraph &lowered_graph)
 {
-  return lowered_graph.graph().topolSortOperations();
+  return linearize(lowered_graph.graph(), false);
+}
+
+std::vector<ir::OperationIndex> Linear::linearize(const ir::Graph &graph, bool memory_aware)
+{
+  auto topological_order = graph.topolSortOperations();
+  if (!memory_aware)
+    return topological_order;
+
+  auto memory_aware_order = memoryAwareOrder(graph);
+  if (memory_aware_order.size() != topological_order.size())
+    throw std::runtime_error{"Linear: failed to schedule all operations"};
+
+  const auto topological_peak = peakLiveBytes(graph, topological_order);
+  const auto memory_aware_peak = peakLiveBytes(graph, memory_aware_order);
+  VERBOSE(Linearize) << "Peak live bytes : topological " << topological_peak << ", memory-aware "
+                     << memory_aware_peak << std::endl;
+
+  return memory_aware_peak < topological_peak ? memory_aware_order : topological_order;
+}
+
+uint64_t Linear::peakLiveBytes(const ir::Graph &graph,
+                               const std::vector<ir::OperationIndex> &order)
+{
+  ir::OperandIndexMap<uint32_t> remaining_uses;
+  uint64_t live = 0;
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    remaining_uses[ind] = obj.getUses().size();
+    // Operands without producer are live from the beginning
+    if (!obj.getDef().valid())
+      live += plannedSize(graph, ind);
+  });
+
+  uint64_t peak = live;
+  for (const auto &ind : order)
+  {
+    const auto &op = graph.operations().at(ind);
+    for (const auto &output : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      live += plannedSize(graph, output);
+    peak = std::max(peak, live);
+    for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (--remaining_uses[input] == 0)
+        live -= plannedSize(graph, input);
+    }
+  }
+
+  return peak;
 }
 
 // TODO(easy) Change the LoweredGraph param to Graph
@@ -20,6 +20,7 @@
 #include <vector>
 #include <memory>
 
+#include "ir/Graph.h"
 #include "ir/Index.h"
 #include "compiler/ILoweredGraph.h"
 
@@ -32,6 +33,21 @@ class Linear
 {
 public:
   static std::vector<ir::OperationIndex> linearize(const compiler::ILoweredGraph &lowered_graph);
+  /**
+   * @brief Linearize operations of the graph
+   * @param[in] graph        Graph to linearize
+   * @param[in] memory_aware If true, order parallel branches to lower the peak of live activation
+   *                         bytes. Plain topological order is kept if it is not worse.
+   * @return Operations in execution order
+   */
+  static std::vector<ir::OperationIndex> linearize(const ir::Graph &graph, bool memory_aware);
+  /**
+   * @brief Get the peak sum of sizes of activations live at the same time along the order
+   *
+   * Constants and graph inputs/outputs are not counted as their memory is not planned.
+   */
+  static uint64_t peakLiveBytes(const ir::Graph &graph,
+                                const std::vector<ir::OperationIndex> &order);
   static void dump(const compiler::ILoweredGraph &lowered_graph,
                    const std::vector<ir::OperationIndex> &order);
 };
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Linear.h"
+
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+
+namespace
+{
+
+ir::OperationIndex addAddOperation(ir::Graph &graph, const ir::OperandIndex &input,
+                                   const ir::OperandIndex &output)
+{
+  ir::operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = ir::operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = ir::Activation::NONE;
+  return graph.addOperation(
+    std::make_unique<ir::operation::BinaryArithmetic>(ir::OperandIndexSequence{input, input},
+                                                      ir::OperandIndexSequence{output}, param));
+}
+
+ir::OperandIndex addOperand(ir::Graph &graph, int32_t size)
+{
+  return graph.addOperand(ir::Shape{size}, ir::TypeInfo{ir::DataType::FLOAT32});
+}
+
+/*
+ * Two branches joined at the end
+ *
+ *    in ----> b1(500) -> b2(500) -> b3(1) ---> out
+ *       \                                  /
+ *        `--------------> a1(1000) -------`
+ *
+ * Topological order computes a1 first and keeps it live during the long branch.
+ */
+struct BranchGraph
+{
+  BranchGraph()
+  {
+    auto in = addOperand(graph, 1);
+    auto b1 = addOperand(graph, 500);
+    auto b2 = addOperand(graph, 500);
+    auto b3 = addOperand(graph, 1);
+    auto a1 = addOperand(graph, 1000);
+    auto out = addOperand(graph, 1);
+
+    auto op_a1 = addAddOperation(graph, in, a1);
+    ops.push_back(addAddOperation(graph, in, b1));
+    ops.push_back(addAddOperation(graph, b1, b2));
+    ops.push_back(addAddOperation(graph, b2, b3));
+    ops.push_back(op_a1);
+
+    ir::operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = ir::operation::BinaryArithmetic::ArithmeticType::ADD;
+    param.activation = ir::Activation::NONE;
+    ops.push_back(graph.addOperation(std::make_unique<ir::operation::BinaryArithmetic>(
+      ir::OperandIndexSequence{a1, b3}, ir::OperandIndexSequence{out}, param)));
+
+    graph.addInput(in);
+    graph.addOutput(out);
+    graph.verify();
+  }
+
+  ir::Graph graph;
+  // Operations in the order that keeps the peak lowest
+  std::vector<ir::OperationIndex> ops;
+};
+
+} // namespace
+
+TEST(Linear, topological_order)
+{
+  BranchGraph g;
+
+  auto order = compiler::Linear::linearize(g.graph, false);
+  ASSERT_EQ(order, g.graph.topolSortOperations());
+  ASSERT_EQ(compiler::Linear::peakLiveBytes(g.graph, order), (1000 + 500 + 500) * sizeof(float));
+}
+
+TEST(Linear, memory_aware_order)
+{
+  BranchGraph g;
+
+  auto order = compiler::Linear::linearize(g.graph, true);
+  ASSERT_EQ(order, g.ops);
+  ASSERT_EQ(compiler::Linear::peakLiveBytes(g.graph, order), (1000 + 1) * sizeof(float));
+}
+
+TEST(Linear, memory_aware_order_keeps_topological)
+{
+  // A single chain has only one valid order
+  ir::Graph graph;
+  auto in = addOperand(graph, 10);
+  auto mid = addOperand(graph, 10);
+  auto out = addOperand(graph, 10);
+  addAddOperation(graph, in, mid);
+  addAddOperation(graph, mid, out);
+  graph.addInput(in);
+  graph.addOutput(out);
+  graph.verify();
+
+  ASSERT_EQ(compiler::Linear::linearize(graph, true), graph.topolSortOperations());
+}
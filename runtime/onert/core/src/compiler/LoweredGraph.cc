@@ -33,6 +33,36 @@
 #include <cassert>
 #include <sstream>
 
+namespace
+{
+
+using namespace onert;
+
+// Return nullptr if any operation is not assigned or its backend is not available
+std::unique_ptr<compiler::BackendResolver>
+resolveAssignedBackends(const ir::Graph &graph,
+                        const std::unordered_map<ir::OperationIndex, std::string> &assigned)
+{
+  auto backend_resolver = std::make_unique<compiler::BackendResolver>();
+  bool resolved = true;
+  graph.operations().iterate([&](const ir::OperationIndex &index, const ir::IOperation &) {
+    auto it = assigned.find(index);
+    const auto backend =
+      it == assigned.end() ? nullptr : compiler::BackendManager::get().get(it->second);
+    if (backend == nullptr)
+    {
+      VERBOSE(LoweredGraph) << "Backend for " << index << " is not available" << std::endl;
+      resolved = false;
+      return;
+    }
+    backend_resolver->setBackend(index, backend);
+  });
+
+  return resolved ? std::move(backend_resolver) : nullptr;
+}
+
+} // namespace
+
 namespace onert
 {
 namespace compiler
@@ -40,10 +70,20 @@ namespace compiler
 
 LoweredGraph::LoweredGraph(const ir::Graph &graph, const CompilerOptions &options) : _graph{graph}
 {
-  lowerGraph(options);
+  lowerGraph(options, nullptr);
+}
+
+LoweredGraph::LoweredGraph(
+  const ir::Graph &graph, const CompilerOptions &options,
+  const std::unordered_map<ir::OperationIndex, std::string> &assigned_backends)
+  : _graph{graph}
+{
+  lowerGraph(options, &assigned_backends);
 }
 
-void LoweredGraph::lowerGraph(const CompilerOptions &options)
+void LoweredGraph::lowerGraph(
+  const CompilerOptions &options,
+  const std::unordered_map<ir::OperationIndex, std::string> *assigned_backends)
 {
   // Build backend contexts
   auto &backend_manager = BackendManager::get();
@@ -69,7 +109,14 @@ void LoweredGraph::lowerGraph(const CompilerOptions &options)
   // Schedule
   std::unique_ptr<BackendResolver> backend_resolver;
   auto all_backends = backend_manager.getAll();
-  if (options.he_scheduler)
+  if (assigned_backends)
+    backend_resolver = resolveAssignedBackends(_graph, *assigned_backends);
+
+  if (backend_resolver)
+  {
+    VERBOSE(LoweredGraph) << "Use backends assigned in advance" << std::endl;
+  }
+  else if (options.he_scheduler)
   {
     auto scheduler = HEScheduler(all_backends, options);
     backend_resolver = scheduler.schedule(_graph);
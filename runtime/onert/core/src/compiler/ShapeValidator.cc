@@ -55,6 +55,28 @@ void ShapeValidator::operator()()
     [&](const ir::OperationIndex &, const ir::IOperation &node) { node.accept(*this); });
 }
 
+void ShapeValidator::visit(const ir::operation::Attention &node)
+{
+  const auto &operands = _graph.operands();
+  const auto query_index(node.getInputs().at(ir::operation::Attention::Input::QUERY));
+  const auto key_index(node.getInputs().at(ir::operation::Attention::Input::KEY));
+  const auto value_index(node.getInputs().at(ir::operation::Attention::Input::VALUE));
+  const auto out_index{node.getOutputs().at(0)};
+
+  if (operands.at(out_index).info().isDynamic())
+    return;
+
+  const auto &query_shape = operands.at(query_index).shape();
+  const auto &key_shape = operands.at(key_index).shape();
+  const auto &value_shape = operands.at(value_index).shape();
+  OP_REQUIRES(query_shape.rank() == 4 && key_shape.rank() == 4 && value_shape.rank() == 4);
+  OP_REQUIRES(key_shape.dim(0) == query_shape.dim(0) && key_shape.dim(3) == query_shape.dim(3));
+  OP_REQUIRES(value_shape.dim(0) == key_shape.dim(0) && value_shape.dim(1) == key_shape.dim(1) &&
+              value_shape.dim(2) == key_shape.dim(2));
+  // Heads of a group share a key and value head
+  OP_REQUIRES(key_shape.dim(1) > 0 && query_shape.dim(1) % key_shape.dim(1) == 0);
+}
+
 void ShapeValidator::visit(const ir::operation::BatchMatMul &node)
 {
   const auto &operands = _graph.operands();
@@ -550,6 +572,17 @@ void ShapeValidator::visit(const ir::operation::TransposeConv &node)
   OP_REQUIRES(ifm_shape.N == ofm_shape.N);
   OP_REQUIRES(ifm_shape.C == ker_shape.C);
   OP_REQUIRES(ker_shape.N == ofm_shape.C);
+
+  // BIAS is optional, and may be absent from inputs or undefined
+  if (node.getInputs().size() > ir::operation::TransposeConv::Input::BIAS)
+  {
+    const auto bias_index{node.getInputs().at(ir::operation::TransposeConv::Input::BIAS)};
+    if (operands.exist(bias_index))
+    {
+      OP_REQUIRES(operands.at(bias_index).shape().rank() == 1);
+      OP_REQUIRES(operands.at(bias_index).shape().dim(0) == ofm_shape.C);
+    }
+  }
 }
 
 void ShapeValidator::visit(const ir::operation::Gather &node)
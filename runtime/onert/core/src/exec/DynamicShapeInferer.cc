@@ -117,6 +117,24 @@ void DynamicShapeInferer::visit(const ir::operation::ArgMinMax &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::Attention &op)
+{
+  const auto query_index = op.getInputs().at(ir::operation::Attention::Input::QUERY);
+  const auto value_index = op.getInputs().at(ir::operation::Attention::Input::VALUE);
+  auto query = _tensor_registry->getITensor(query_index);
+  auto value = _tensor_registry->getITensor(value_index);
+
+  // Output shape does not depend on key and mask, whose length grows with a cache of keys
+  if (!query->is_dynamic() && !value->is_dynamic())
+    return;
+
+  const auto output_index = op.getOutputs().at(0);
+  auto output = _tensor_registry->getITensor(output_index);
+
+  auto new_shape = shape_inference::inferAttentionShape(query->getShape(), value->getShape());
+  output->applyShape(new_shape);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::BatchMatMul &op)
 {
   const auto lhs_index = op.getInputs().at(ir::operation::BatchMatMul::Input::LHS);
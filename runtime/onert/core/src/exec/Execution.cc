@@ -20,6 +20,8 @@
 #include "train/TrainableExecutors.h"
 #include "util/logging.h"
 
+#include <cstring>
+
 namespace onert
 {
 namespace exec
@@ -121,6 +123,8 @@ void Execution::execute()
 {
   VERBOSE(Execution) << "Start execution" << std::endl;
 
+  bindStateBuffers();
+
   // Input length validation check
   for (const auto &input : _ctx.desc.inputs)
   {
@@ -139,6 +143,7 @@ void Execution::execute()
   }
 
   _executors->execute(_ctx);
+  appendStates();
   finished = true;
 
   VERBOSE(Execution) << "Execution finished" << std::endl;
@@ -223,5 +228,105 @@ size_t Execution::getOutputTotalSize(ir::IOIndex ind) const
   return _ctx.desc.outputs.at(ind.value())->info.total_size();
 }
 
+void Execution::bindState(const ir::IOIndex &input, const ir::IOIndex &output, uint32_t axis,
+                          const ir::IOIndex &length)
+{
+  const auto &input_info = _ctx.desc.inputs.at(input.value())->info;
+  const auto &output_info = _ctx.desc.outputs.at(output.value())->info;
+  const auto &length_info = _ctx.desc.inputs.at(length.value())->info;
+  const auto &shape = input_info.shape();
+  if (input_info.typeInfo().type() != output_info.typeInfo().type())
+    throw std::runtime_error{"State input and output should have the same type"};
+  if (static_cast<int>(axis) >= shape.rank() || output_info.shape().rank() != shape.rank())
+    throw std::runtime_error{"Invalid state axis"};
+  if (length == input || length_info.typeInfo().type() != ir::DataType::INT32 ||
+      length_info.shape().num_elements() != 1)
+    throw std::runtime_error{"State length should be another input of a scalar INT32"};
+
+  // Entries should be contiguous to append them
+  for (uint32_t i = 0; i < axis; ++i)
+  {
+    if (shape.dim(i) != 1)
+      throw std::runtime_error{"Dimensions before state axis should be 1"};
+  }
+  size_t entry_size = ir::sizeOfDataType(input_info.typeInfo().type());
+  for (int i = axis; i < shape.rank(); ++i)
+  {
+    if (shape.dim(i) <= 0)
+      throw std::runtime_error{"Dimensions from state axis should be known"};
+    if (i > static_cast<int>(axis))
+      entry_size *= shape.dim(i);
+  }
+  const int32_t appended_length = output_info.shape().dim(axis);
+  if (appended_length <= 0 || output_info.total_size() != appended_length * entry_size)
+    throw std::runtime_error{"State output does not match entries of state input"};
+
+  for (const auto &state : _states)
+  {
+    if (state.input == input || state.output == output || state.input == length ||
+        state.length_input == input)
+      throw std::runtime_error{"Input or output is bound to another state already"};
+    // A length input has a value, so states sharing it should grow together
+    if (state.length_input == length && state.appended.size() / state.entry_size !=
+                                          static_cast<size_t>(appended_length))
+      throw std::runtime_error{"States of a length should append the same number of entries"};
+  }
+
+  const int32_t max_length = shape.dim(axis);
+  std::vector<uint8_t> buffer(max_length * entry_size);
+  std::vector<uint8_t> appended(output_info.total_size());
+  _states.push_back(State{input, output, length, axis, 0, max_length, entry_size,
+                          std::move(buffer), std::move(appended)});
+
+  VERBOSE(Execution) << "Bind state (input: " << input << ", output: " << output
+                     << ", length: " << length << ", max length: " << max_length << ")"
+                     << std::endl;
+}
+
+void Execution::resetStates()
+{
+  for (auto &state : _states)
+    state.length = 0;
+}
+
+uint32_t Execution::getStateLength(const ir::IOIndex &input) const
+{
+  for (const auto &state : _states)
+  {
+    if (state.input == input)
+      return state.length;
+  }
+  throw std::runtime_error{"Input is not bound to a state"};
+}
+
+void Execution::bindStateBuffers()
+{
+  for (auto &state : _states)
+  {
+    if (state.length * state.entry_size + state.appended.size() > state.buffer.size())
+      throw std::runtime_error{"State is full, reset it to execute"};
+
+    // Shapes are not changed, so that shape inference does not run for each execution
+    setInput(state.input, state.buffer.data(), state.buffer.size());
+    setInput(state.length_input, &state.length, sizeof(state.length));
+    setOutput(state.output, state.appended.data(), state.appended.size());
+  }
+}
+
+void Execution::appendStates()
+{
+  for (auto &state : _states)
+  {
+    const auto &info = _ctx.desc.outputs.at(state.output.value())->info;
+    if (info.total_size() != state.appended.size())
+      throw std::runtime_error{"State output does not match entries of state input"};
+
+    // Only new entries are copied, as cached ones stay in buffer
+    std::memcpy(state.buffer.data() + state.length * state.entry_size, state.appended.data(),
+                state.appended.size());
+    state.length += state.appended.size() / state.entry_size;
+  }
+}
+
 } // namespace exec
 } // namespace onert
@@ -306,6 +306,82 @@ public:
   std::shared_ptr<onert::compiler::CompilerArtifact> artifact;
 };
 
+class CompiledMockUpStateModel
+{
+public:
+  CompiledMockUpStateModel()
+  {
+    // Model: appends an entry to a cache like a decoder step
+    // model input: cache, length, x
+    // model output: entry, seen, next
+    // constant: rhs, zero, one
+    // entry <= (x + rhs)
+    // seen <= (cache + zero)
+    // next <= (length + one)
+    // cache, seen shape: {3, 2}
+    // x, rhs, zero, entry shape: {1, 2}
+    // length, one, next shape: {1}, INT32
+    graph = std::make_shared<Graph>();
+    Shape shape{1, 2};
+    Shape cache_shape{3, 2};
+    Shape length_shape{1};
+    TypeInfo type{DataType::FLOAT32};
+    TypeInfo length_type{DataType::INT32};
+    static float rhs_data[2] = {10, 20};
+    static float zero_data[2] = {0, 0};
+    static int32_t one_data[1] = {1};
+    auto operand_cache = graph->addOperand(cache_shape, type);
+    auto operand_length = graph->addOperand(length_shape, length_type);
+    auto operand_x = graph->addOperand(shape, type);
+    auto operand_rhs = graph->addOperand(shape, type);
+    auto operand_zero = graph->addOperand(shape, type);
+    auto operand_one = graph->addOperand(length_shape, length_type);
+    auto operand_entry = graph->addOperand(shape, type);
+    auto operand_seen = graph->addOperand(cache_shape, type);
+    auto operand_next = graph->addOperand(length_shape, length_type);
+    graph->operands()
+      .at(operand_rhs)
+      .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&rhs_data), 8));
+    graph->operands()
+      .at(operand_zero)
+      .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&zero_data), 8));
+    graph->operands()
+      .at(operand_one)
+      .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&one_data), 4));
+    operation::BinaryArithmetic::Param add_param;
+    add_param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+    add_param.activation = Activation::NONE;
+    graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{operand_x, operand_rhs}, OperandIndexSequence{operand_entry},
+      add_param));
+    graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{operand_cache, operand_zero}, OperandIndexSequence{operand_seen},
+      add_param));
+    graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{operand_length, operand_one}, OperandIndexSequence{operand_next},
+      add_param));
+    graph->addInput(operand_cache);
+    graph->addInput(operand_length);
+    graph->addInput(operand_x);
+    graph->addOutput(operand_entry);
+    graph->addOutput(operand_seen);
+    graph->addOutput(operand_next);
+    graph->verify();
+
+    // Compile
+    auto model = std::make_shared<onert::ir::Model>();
+    model->push(onert::ir::SubgraphIndex{0}, graph);
+    coptions = onert::compiler::CompilerOptions::fromGlobalConfig();
+    onert::compiler::Compiler compiler{model, coptions.get()};
+    artifact = compiler.compile();
+  }
+
+public:
+  std::shared_ptr<Graph> graph;
+  std::unique_ptr<onert::compiler::CompilerOptions> coptions;
+  std::shared_ptr<onert::compiler::CompilerArtifact> artifact;
+};
+
 TEST(ExecInstance, simple)
 {
   auto mockup = CompiledMockUpModel();
@@ -778,6 +854,132 @@ TEST(ExecInstance, multi_model_dequant_input_quant_output)
   }
 }
 
+TEST(ExecInstance, state)
+{
+  auto mockup = CompiledMockUpStateModel();
+  auto executors = mockup.artifact->_executors;
+
+  auto cache = IOIndex{0};
+  auto length = IOIndex{1};
+  auto x = IOIndex{2};
+  auto entry = IOIndex{0};
+  auto seen = IOIndex{1};
+  auto next = IOIndex{2};
+
+  onert::exec::Execution execution{executors};
+  execution.bindState(cache, entry, 0, length);
+
+  float x_buffer[2] = {};
+  float seen_buffer[6] = {};
+  int32_t next_buffer[1] = {};
+  execution.setInput(x, reinterpret_cast<const void *>(x_buffer), 8);
+  execution.setOutput(seen, reinterpret_cast<void *>(seen_buffer), 24);
+  execution.setOutput(next, reinterpret_cast<void *>(next_buffer), 4);
+
+  // Each execution sees entries appended by the previous ones
+  for (uint32_t step = 0; step < 3; step++)
+  {
+    x_buffer[0] = step;
+    x_buffer[1] = -1.f * step;
+    execution.execute();
+    EXPECT_EQ(next_buffer[0], static_cast<int32_t>(step + 1));
+    EXPECT_EQ(execution.getStateLength(cache), step + 1);
+    for (uint32_t i = 0; i < step; i++)
+    {
+      EXPECT_EQ(seen_buffer[i * 2], 10.f + i);
+      EXPECT_EQ(seen_buffer[i * 2 + 1], 20.f - i);
+    }
+  }
+
+  execution.resetStates();
+  EXPECT_EQ(execution.getStateLength(cache), 0u);
+  x_buffer[0] = 5;
+  x_buffer[1] = 5;
+  execution.execute();
+  EXPECT_EQ(next_buffer[0], 1);
+  EXPECT_EQ(execution.getStateLength(cache), 1u);
+  x_buffer[0] = 0;
+  x_buffer[1] = 0;
+  execution.execute();
+  EXPECT_EQ(next_buffer[0], 2);
+  EXPECT_EQ(seen_buffer[0], 15);
+  EXPECT_EQ(seen_buffer[1], 25);
+}
+
+TEST(ExecInstance, state_static_shape)
+{
+  auto mockup = CompiledMockUpStateModel();
+  auto executors = mockup.artifact->_executors;
+
+  auto cache = IOIndex{0};
+  auto length = IOIndex{1};
+  auto x = IOIndex{2};
+  auto entry = IOIndex{0};
+  auto seen = IOIndex{1};
+  auto next = IOIndex{2};
+
+  onert::exec::Execution execution{executors};
+  execution.bindState(cache, entry, 0, length);
+
+  const float x_buffer[2] = {};
+  float seen_buffer[6] = {};
+  int32_t next_buffer[1] = {};
+  execution.setInput(x, reinterpret_cast<const void *>(x_buffer), 8);
+  execution.setOutput(seen, reinterpret_cast<void *>(seen_buffer), 24);
+  execution.setOutput(next, reinterpret_cast<void *>(next_buffer), 4);
+
+  // Input tensors become dynamic once their shapes differ from compiled ones, and then
+  // shape inference runs for all operations of each execution
+  for (uint32_t step = 0; step < 3; step++)
+  {
+    execution.execute();
+    EXPECT_EQ(execution.getInputShape(cache), (Shape{3, 2}));
+    for (uint32_t i = 0; i < executors->inputSize(); i++)
+      EXPECT_FALSE(executors->inputInfo(IOIndex{i}).isDynamic());
+    for (uint32_t i = 0; i < executors->outputSize(); i++)
+      EXPECT_FALSE(executors->outputInfo(IOIndex{i}).isDynamic());
+  }
+}
+
+TEST(ExecInstance, neg_state)
+{
+  auto mockup = CompiledMockUpStateModel();
+  auto executors = mockup.artifact->_executors;
+
+  auto cache = IOIndex{0};
+  auto length = IOIndex{1};
+  auto x = IOIndex{2};
+  auto entry = IOIndex{0};
+  auto seen = IOIndex{1};
+  auto next = IOIndex{2};
+
+  onert::exec::Execution execution{executors};
+  // Axis out of range
+  EXPECT_THROW(execution.bindState(cache, entry, 2, length), std::runtime_error);
+  // Length is not INT32
+  EXPECT_THROW(execution.bindState(cache, entry, 0, x), std::runtime_error);
+  // Length is the state input itself
+  EXPECT_THROW(execution.bindState(cache, entry, 0, cache), std::runtime_error);
+  // Not bound
+  EXPECT_THROW(execution.getStateLength(cache), std::runtime_error);
+
+  execution.bindState(cache, entry, 0, length);
+  EXPECT_THROW(execution.bindState(cache, entry, 0, length), std::runtime_error);
+
+  const float x_buffer[2] = {};
+  float seen_buffer[6] = {};
+  int32_t next_buffer[1] = {};
+  execution.setInput(x, reinterpret_cast<const void *>(x_buffer), 8);
+  execution.setOutput(seen, reinterpret_cast<void *>(seen_buffer), 24);
+  execution.setOutput(next, reinterpret_cast<void *>(next_buffer), 4);
+  for (uint32_t step = 0; step < 3; step++)
+    execution.execute();
+
+  // Full
+  EXPECT_THROW(execution.execute(), std::runtime_error);
+  EXPECT_EQ(execution.getStateLength(cache), 3u);
+}
+
 // TODO Add an unittest multi_model_quant_input_dequant_output
 
 } // namespace
@@ -82,6 +82,13 @@ void ExecutorBase::execute(const std::vector<backend::IPortableTensor *> &inputs
   ExecutionObservee subject(_observers, options);
 
   executeImpl(subject);
+
+  // I/O tensors given by caller may wrap user buffers that are valid only during this execution.
+  // Detach them not to leave dangling references in executor.
+  for (auto &&input_tensor : _input_tensors)
+    input_tensor->resetTensor();
+  for (auto &&output_tensor : _output_tensors)
+    output_tensor->resetTensor();
 }
 
 bool ExecutorBase::hasDynamicInput()
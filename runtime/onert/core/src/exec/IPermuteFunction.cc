@@ -18,6 +18,7 @@
 
 #include <cker/operation/Quantize.h>
 #include <cker/operation/Dequantize.h>
+#include <cker/operation/Transpose.h>
 #include "backend/IPortableTensor.h"
 #include "exec/IFunction.h"
 #include "ir/Index.h"
@@ -287,6 +288,56 @@ void IPermuteFunction::permute(backend::ITensor *src_tensor, backend::ITensor *d
   }
 }
 
+void IPermuteFunction::transpose(const backend::ITensor *src, uint8_t *dst_buffer,
+                                 size_t element_size, const ir::PermuteType &permute_type)
+{
+  assert(permute_type == ir::PermuteType::NHWC_TO_NCHW ||
+         permute_type == ir::PermuteType::NCHW_TO_NHWC);
+  nnfw::cker::TransposeParams params;
+  params.perm_count = 4;
+  params.perm[0] = 0;
+  if (permute_type == ir::PermuteType::NHWC_TO_NCHW)
+  {
+    params.perm[1] = 3;
+    params.perm[2] = 1;
+    params.perm[3] = 2;
+  }
+  else
+  {
+    params.perm[1] = 2;
+    params.perm[2] = 3;
+    params.perm[3] = 1;
+  }
+
+  const auto src_shape = getShape(src);
+  nnfw::cker::Shape dst_shape(4);
+  for (int i = 0; i < 4; ++i)
+    dst_shape.SetDim(i, src_shape.Dims(params.perm[i]));
+
+  // Values are only moved, so they are permuted per element size
+  switch (element_size)
+  {
+    case 1:
+      nnfw::cker::Transpose(params, src_shape, reinterpret_cast<const int8_t *>(src->buffer()),
+                            dst_shape, reinterpret_cast<int8_t *>(dst_buffer), _ruy_context);
+      break;
+    case 2:
+      nnfw::cker::Transpose(params, src_shape, reinterpret_cast<const int16_t *>(src->buffer()),
+                            dst_shape, reinterpret_cast<int16_t *>(dst_buffer), _ruy_context);
+      break;
+    case 4:
+      nnfw::cker::Transpose(params, src_shape, reinterpret_cast<const int32_t *>(src->buffer()),
+                            dst_shape, reinterpret_cast<int32_t *>(dst_buffer), _ruy_context);
+      break;
+    case 8:
+      nnfw::cker::Transpose(params, src_shape, reinterpret_cast<const int64_t *>(src->buffer()),
+                            dst_shape, reinterpret_cast<int64_t *>(dst_buffer), _ruy_context);
+      break;
+    default:
+      throw std::runtime_error("IPermuteFunction: Not supported element size");
+  }
+}
+
 const std::type_info &IPermuteFunction::underlying_type(ir::DataType type) const
 {
   switch (type)
@@ -29,6 +29,11 @@
 #include <vector>
 #include <unordered_map>
 
+namespace ruy
+{
+class Context;
+} // namespace ruy
+
 namespace onert
 {
 namespace exec
@@ -135,7 +140,12 @@ private:
     assert(dst_buffer != nullptr);
     assert(dst_size == dst->total_size());
 
-    if (rank == 4 && permute_type != ir::PermuteType::COPY)
+    if (rank == 4 && permute_type != ir::PermuteType::COPY && !src->has_padding() &&
+        !dst->has_padding())
+    {
+      transpose(src, dst_buffer, sizeof(T), permute_type);
+    }
+    else if (rank == 4 && permute_type != ir::PermuteType::COPY)
     {
       switch (permute_type)
       {
@@ -232,6 +242,10 @@ private:
     }
   }
 
+  // Permute layouts of tensors without padding by the tiled transpose of cker
+  void transpose(const backend::ITensor *src, uint8_t *dst_buffer, size_t element_size,
+                 const ir::PermuteType &permute_type);
+
 protected:
   // NOTE The typeid expression is lvalue expression which refers to an object with static storage
   //      duration, of the polymorphic type const std::type_info or of some type derived from it.
@@ -245,6 +259,8 @@ protected:
   std::vector<std::vector<size_t>> _dst_tensors_offsets;
   std::vector<ir::PermuteType> _permute_types;
   std::unordered_map<const backend::ITensor *, std::vector<uint8_t>> _buffers_map;
+  // Thread pool to split transposes, nullptr to run them on the caller thread
+  ruy::Context *_ruy_context = nullptr;
 };
 
 // Simple PermuteLayer
@@ -382,6 +382,54 @@ TEST(IPermuteFunction, float_to_float)
   }
 }
 
+TEST(IPermuteFunction, dense_layout)
+{
+  // Tensors without padding are transposed by tiles, shapes are not multiples of tiles
+  const std::vector<Shape> shapes{{2, 9, 11, 13}, {1, 17, 3, 40}};
+  const std::vector<TypeInfo> type_infos{TypeInfo(DataType::FLOAT32),
+                                         TypeInfo(DataType::QUANT_INT8_SYMM, 1.0f, 0)};
+  for (const auto &type_info : type_infos)
+  {
+    std::vector<std::unique_ptr<MockUpTensor>> inputs(4);
+    std::vector<std::unique_ptr<MockUpTensor>> outputs(4);
+    std::vector<std::unique_ptr<uint8_t[]>> input_buffers(4);
+    std::vector<std::unique_ptr<uint8_t[]>> output_buffers(4);
+    for (size_t i = 0; i < 4; ++i)
+    {
+      const Shape &nhwc = shapes[i / 2];
+      const Shape nchw{nhwc.dim(0), nhwc.dim(3), nhwc.dim(1), nhwc.dim(2)};
+      const bool from_nhwc = i % 2 == 0;
+      inputs[i] = std::make_unique<MockUpTensor>(from_nhwc ? nhwc : nchw, type_info,
+                                                 from_nhwc ? Layout::NHWC : Layout::NCHW, 0);
+      input_buffers[i] = std::make_unique<uint8_t[]>(inputs[i]->total_size());
+      for (size_t j = 0; j < inputs[i]->total_size(); ++j)
+        input_buffers[i][j] = static_cast<uint8_t>(j * 7 + 3);
+      inputs[i]->setBuffer(input_buffers[i].get());
+
+      outputs[i] = std::make_unique<MockUpTensor>(from_nhwc ? nchw : nhwc, type_info,
+                                                  from_nhwc ? Layout::NCHW : Layout::NHWC, 0);
+      output_buffers[i] = std::make_unique<uint8_t[]>(outputs[i]->total_size());
+      outputs[i]->setBuffer(output_buffers[i].get());
+    }
+
+    auto mockup_layer = std::make_unique<MockUpLayer>(inputs, outputs);
+    mockup_layer->run();
+
+    const size_t data_size = sizeOfDataType(type_info.type());
+    for (size_t i = 0; i < 4; ++i)
+    {
+      const Shape &nhwc = shapes[i / 2];
+      ShapeLoop(nhwc, [&](const Coordinates &coords) {
+        const Coordinates nchw_coords{coords[0], coords[3], coords[1], coords[2]};
+        const auto &input_coords = inputs[i]->layout() == Layout::NHWC ? coords : nchw_coords;
+        const auto &output_coords = outputs[i]->layout() == Layout::NHWC ? coords : nchw_coords;
+        EXPECT_EQ(0, memcmp(outputs[i]->buffer() + outputs[i]->calcOffset(output_coords),
+                            inputs[i]->buffer() + inputs[i]->calcOffset(input_coords), data_size));
+      });
+    }
+  }
+}
+
 TEST(IPermuteFunction, float_to_qasymm8)
 {
   const size_t input_pads[4] = {0, 0, 1, 2};
@@ -42,10 +42,14 @@ using MeasurementData = std::unordered_map<
 
 class JSON
 {
+public:
+  ///@brief default file containing measurements
+  static constexpr const char *default_measurement_file = "exec_time.json";
+
 public:
   explicit JSON(const std::vector<const backend::Backend *> &backends,
                 MeasurementData &measurements)
-    : _measurement_file("exec_time.json"), _backends(), _measurements(measurements)
+    : _measurement_file(default_measurement_file), _backends(), _measurements(measurements)
   {
     for (const auto b : backends)
     {
@@ -16,7 +16,9 @@
 
 #include "ParallelExecutor.h"
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include "util/logging.h"
 #include "exec/IFunction.h"
@@ -26,37 +28,80 @@ namespace onert
 namespace exec
 {
 
-class HookFunction : public IFunction
+class ParallelExecutor::HookFunction : public IFunction
 {
 public:
-  HookFunction(IFunction *fn, const std::function<void()> &setup,
-               const std::function<void()> &teardown)
-    : _fn{fn}, _setup{setup}, _teardown{teardown}
+  HookFunction(ParallelExecutor *executor, uint32_t job_index)
+    : _executor{executor}, _job_index{job_index}
   {
   }
 
 public:
-  void run() override
-  {
-    _setup();
-    _fn->run();
-    _teardown();
-  }
+  void run() override { _executor->runJob(_job_index); }
 
 private:
-  IFunction *_fn;
-  std::function<void()> _setup;
-  std::function<void()> _teardown;
+  ParallelExecutor *_executor;
+  uint32_t _job_index;
 };
 
 void ParallelExecutor::notify(uint32_t finished_job_id)
 {
+  // Capacity is reserved in advance, so collecting ready jobs does not allocate
+  auto &ready_jobs = _ready_buffers[finished_job_id];
+  ready_jobs.clear();
+
   std::unique_lock<std::mutex> lock{_mu_jobs};
 
-  DataflowExecutor::notify(finished_job_id);
+  for (auto &&id : _output_info[finished_job_id])
+  {
+    assert(_input_info[id] > 0);
+    if (--_input_info[id] == 0) // No dependent jobs left, ready for execution
+      ready_jobs.push_back(id);
+  }
+
+  const bool all_finished = (--_num_unfinished_jobs == 0);
 
   lock.unlock();
-  _cv_jobs.notify_all();
+
+  // The job with the lowest priority is dispatched first so that the one with the highest
+  // priority is on top of this worker's queue.
+  std::sort(ready_jobs.begin(), ready_jobs.end(),
+            [this](uint32_t lhs, uint32_t rhs) { return _job_ranks[lhs] < _job_ranks[rhs]; });
+  for (auto &&id : ready_jobs)
+    dispatch(id);
+
+  if (all_finished)
+    _cv_jobs.notify_one();
+}
+
+void ParallelExecutor::dispatch(uint32_t job_index)
+{
+  VERBOSE(ParallelExecutor) << "Assigning fn " << job_index << std::endl;
+
+  auto &job = _waiting_jobs[job_index];
+  assert(job != nullptr);
+
+  job->fn_seq()->initRunning();
+
+  // dynamic tensor setting
+  bool handle_dynamic_tensor =
+    _lowered_graph->getHasDynamicTensor(_job_to_op.at(job_index)) || _dynamic_input_exists;
+  job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
+
+  // Each job is dispatched only once per execution, so no other thread touches these slots
+  _finished_jobs[job_index] = std::move(job);
+  _scheduler->assign(_hooks[job_index].get(), _job_backends[job_index]);
+}
+
+void ParallelExecutor::runJob(uint32_t job_index)
+{
+  const auto op_ind = _job_to_op.at(job_index);
+  const auto backend = _job_backends[job_index];
+
+  _subject->notifyJobBegin(this, _profiling_subg_index, op_ind, backend);
+  _finished_jobs[job_index]->run();
+  _subject->notifyJobEnd(this, _profiling_subg_index, op_ind, backend);
+  notify(job_index);
 }
 
 ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
@@ -68,92 +113,76 @@ ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lower
                      std::move(code_map), tracing_ctx}
 {
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
-}
 
-void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
-{
-  bool dynamic_input_exists = hasDynamicInput();
+  const auto num_jobs = static_cast<uint32_t>(_finished_jobs.size());
 
-  // Init scheduler
   // TODO Consider to have distinct backend set in GraphLowerInfo
   BackendSet backends;
-  for (const auto &[idx, backend] : _lowered_graph->lower_info().operation)
+  for (uint32_t i = 0; i < num_jobs; ++i)
+  {
+    const auto backend = _lowered_graph->lower_info().operation.at(_job_to_op.at(i));
+    _job_backends.emplace_back(backend);
     backends.add(backend);
 
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+    _ready_buffers.emplace_back();
+    _ready_buffers.back().reserve(_output_info[i].size());
+    _hooks.emplace_back(std::make_unique<HookFunction>(this, i));
+  }
 
-  assert(noWaitingJobs());
+  _scheduler = std::make_unique<ParallelScheduler>(backends, num_jobs);
+}
 
-  // Execution setup
-  _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
+ParallelExecutor::~ParallelExecutor() = default;
 
-  for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
+void ParallelExecutor::prepareJobOrder()
+{
+  for (uint32_t i = 0; i < _finished_jobs.size(); ++i)
   {
-    VERBOSE(ParallelExecutor) << i << ": " << _input_info[i] << std::endl;
-    if (_input_info[i] == 0)
-    {
-      emplaceToReadyJobs(i);
-    }
+    _job_ranks.emplace_back(calculateRank({_job_to_op.at(i)}));
+    if (_initial_input_info[i] == 0)
+      _initial_jobs.emplace_back(i);
   }
-  assert(!_ready_jobs.empty()); // Cannot begin if there is no initial jobs
 
-  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << _ready_jobs.size() << std::endl;
+  std::stable_sort(
+    _initial_jobs.begin(), _initial_jobs.end(),
+    [this](uint32_t lhs, uint32_t rhs) { return _job_ranks[lhs] > _job_ranks[rhs]; });
+}
 
-  auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
+void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
+{
+  if (_job_ranks.empty())
+    prepareJobOrder();
 
-  subject.notifySubgraphBegin(profiling_subg_index);
+  _dynamic_input_exists = hasDynamicInput();
+  _subject = &subject;
+  _profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
 
-  while (true)
-  {
-    std::unique_lock<std::mutex> lock{_mu_jobs};
-
-    if (_ready_jobs.empty())
-    {
-      _cv_jobs.wait(lock, [this] { return !_ready_jobs.empty() || noWaitingJobs(); });
-      // Check finish condition
-      if (_ready_jobs.empty() && noWaitingJobs())
-      {
-        break;
-      }
-    }
-
-    auto job = std::move(_ready_jobs.begin()->second);
-    _ready_jobs.erase(_ready_jobs.begin());
-
-    lock.unlock();
-
-    VERBOSE(ParallelExecutor) << "Assigning fn " << job->index() << std::endl;
-
-    auto job_index = job->index();
-    auto op_ind = _job_to_op[job_index];
-    const auto backend = _lowered_graph->lower_info().operation.at(op_ind);
-    auto setup = [&, op_ind, backend]() {
-      subject.notifyJobBegin(this, profiling_subg_index, op_ind, backend);
-    };
-    auto teardown = [&, job_index, op_ind, backend]() {
-      subject.notifyJobEnd(this, profiling_subg_index, op_ind, backend);
-      notify(job_index);
-    };
-
-    job->fn_seq()->initRunning();
-
-    // dynamic tensor setting
-    bool handle_dynamic_tensor =
-      _lowered_graph->getHasDynamicTensor(op_ind) || dynamic_input_exists;
-    job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
-
-    _scheduler->assign(std::make_unique<HookFunction>(job->fn_seq(), setup, teardown), backend);
-    _finished_jobs[job_index] = std::move(job);
-  }
+  assert(noWaitingJobs());
+
+  // Execution setup
+  _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
+  _num_unfinished_jobs = _waiting_jobs.size();
+
+  assert(!_initial_jobs.empty()); // Cannot begin if there is no initial jobs
+  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << _initial_jobs.size() << std::endl;
+
+  subject.notifySubgraphBegin(_profiling_subg_index);
+
+  // The rest of jobs are dispatched by workers as soon as their producers are done
+  for (auto &&job_index : _initial_jobs)
+    dispatch(job_index);
+
+  std::unique_lock<std::mutex> lock{_mu_jobs};
+  _cv_jobs.wait(lock, [this] { return _num_unfinished_jobs == 0; });
+  lock.unlock();
 
   assert(noWaitingJobs());
 
-  // Wait for all the jobs done
-  _scheduler->finish();
-  subject.notifySubgraphEnd(profiling_subg_index);
+  subject.notifySubgraphEnd(_profiling_subg_index);
 
   // Reset input info for the next execution
   _input_info = _initial_input_info;
+  _subject = nullptr;
 }
 
 } // namespace exec
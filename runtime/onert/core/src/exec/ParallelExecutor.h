@@ -23,6 +23,7 @@
 #include "util/TracingCtx.h"
 
 #include <memory>
+#include <vector>
 
 namespace onert
 {
@@ -31,6 +32,9 @@ namespace exec
 
 /**
  * @brief Class to execute Graph in parallel
+ *
+ * Worker threads and the per-job records to be scheduled live as long as the executor, so an
+ * execution in steady state does not create threads nor allocate memory for scheduling.
  */
 class ParallelExecutor : public DataflowExecutor
 {
@@ -49,12 +53,49 @@ public:
                    backend::BackendContexts &&backend_contexts,
                    const compiler::TensorRegistries &tensor_regs, compiler::CodeMap &&code_map,
                    const util::TracingCtx *tracing_ctx);
+  ~ParallelExecutor();
 
   void executeImpl(const ExecutionObservee &subject) override;
 
+private:
+  class HookFunction;
+
+private:
+  /**
+   * @brief Prepare job priorities and the initial jobs sorted by them
+   *
+   * @note  Ranks are given after construction, so it is done on the first execution
+   */
+  void prepareJobOrder();
+  /**
+   * @brief Hand over a ready job to the scheduler
+   *
+   * @note  Called from the main thread for the initial jobs, and from the worker that finished
+   *        the producer for the other jobs
+   */
+  void dispatch(uint32_t job_index);
+  void runJob(uint32_t job_index);
+
 private:
   std::condition_variable _cv_jobs;
   std::mutex _mu_jobs;
+  /// @brief Number of jobs not finished yet in current execution
+  uint32_t _num_unfinished_jobs = 0;
+  /// @brief Backend of each job
+  std::vector<const backend::Backend *> _job_backends;
+  /// @brief Priority of each job, higher runs first
+  std::vector<int64_t> _job_ranks;
+  /// @brief Jobs without any dependency, sorted by priority
+  std::vector<uint32_t> _initial_jobs;
+  /// @brief Buffer of each job to collect the successors that became ready when it finished
+  std::vector<std::vector<uint32_t>> _ready_buffers;
+  /// @brief Preallocated scheduling records, one per job
+  std::vector<std::unique_ptr<HookFunction>> _hooks;
+  // States of current execution which are shared with workers
+  const ExecutionObservee *_subject = nullptr;
+  ir::SubgraphIndex _profiling_subg_index;
+  bool _dynamic_input_exists = false;
+  // NOTE Declared last to join workers before the other members are destroyed
   std::unique_ptr<ParallelScheduler> _scheduler;
 };
 
@@ -16,9 +16,11 @@
 
 #include "ParallelScheduler.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include <memory>
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 
 namespace onert
@@ -26,29 +28,24 @@ namespace onert
 namespace exec
 {
 
-ParallelScheduler::ParallelScheduler(const BackendSet &backends)
+ParallelScheduler::ParallelScheduler(const BackendSet &backends, uint32_t num_jobs)
 {
   assert(!backends.empty());
 
+  // NOTE Kernels of a backend may share non-reentrant states (e.g. cpu backend's ruy context).
+  //      Use more than one worker per backend only if the backends in use allow it.
+  const auto num_workers = util::getConfigInt(util::config::PARALLEL_NUM_WORKERS);
   for (auto &&backend : backends)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    _thread_pools[backend] = std::make_unique<ThreadPool>(std::max(num_workers, 1), num_jobs);
   }
 }
 
-void ParallelScheduler::assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend)
+void ParallelScheduler::assign(IFunction *fn, const backend::Backend *backend)
 {
   assert(!_thread_pools.empty());
 
-  _thread_pools.at(backend)->enqueue(std::move(fn));
-}
-
-void ParallelScheduler::finish()
-{
-  for (auto &&itr : _thread_pools)
-  {
-    itr.second->finish();
-  }
+  _thread_pools.at(backend)->enqueue(fn);
 }
 
 } // namespace exec
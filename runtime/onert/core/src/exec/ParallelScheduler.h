@@ -36,19 +36,19 @@ public:
    * @brief Constructs ParallelScheduler object
    *
    * @param backends Backend set
+   * @param num_jobs Number of jobs to be scheduled in an execution
    */
-  ParallelScheduler(const BackendSet &backends);
+  ParallelScheduler(const BackendSet &backends, uint32_t num_jobs);
   /**
    * @brief Assign a task to the given backend
    *
-   * @param[in] fn Function to be assigned
-   * @param[in] fn Target backend
-   */
-  void assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend);
-  /**
-   * @brief Block until all jobs are finished
+   * @param[in] fn      Function to be assigned. It must be alive until it finishes running
+   * @param[in] backend Target backend
+   *
+   * @note  If it is called from a worker of @c backend 's thread pool, the task is pushed to that
+   *        worker's own queue and it runs next on the same thread.
    */
-  void finish();
+  void assign(IFunction *fn, const backend::Backend *backend);
 
 private:
   std::unordered_map<const backend::Backend *, std::unique_ptr<ThreadPool>> _thread_pools;
@@ -19,6 +19,49 @@
 #include "EdgeTensor.h"
 #include "IPermuteFunction.h"
 #include "../backend/builtin/UserTensor.h"
+#include "util/logging.h"
+
+namespace
+{
+
+using namespace onert;
+
+/**
+ * @brief Check whether a user buffer is aligned enough to be accessed by kernels directly
+ *
+ * Kernels access I/O buffers through typed pointers, so the buffer should be aligned to its
+ * element size at least.
+ */
+bool isAligned(const void *buffer, ir::DataType type)
+{
+  const auto alignment = ir::sizeOfDataType(type);
+  return reinterpret_cast<uintptr_t>(buffer) % alignment == 0;
+}
+
+/**
+ * @brief Check whether an input buffer shares memory with any output buffer
+ *
+ * Kernels may write outputs before they finish reading inputs. If the input is bound directly,
+ * its data can be overwritten in the middle of execution.
+ */
+bool overlapsOutputs(const exec::InputDesc &input, const exec::IODescription &desc)
+{
+  const auto in_begin = reinterpret_cast<uintptr_t>(input.buffer);
+  const auto in_end = in_begin + input.size;
+  for (const auto &output : desc.outputs)
+  {
+    if (output->buffer == nullptr || output->size == 0)
+      continue;
+
+    const auto out_begin = reinterpret_cast<uintptr_t>(output->buffer);
+    const auto out_end = out_begin + output->size;
+    if (in_begin < out_end && out_begin < in_end)
+      return true;
+  }
+  return false;
+}
+
+} // namespace
 
 namespace onert
 {
@@ -89,8 +132,29 @@ void SingleModelExecutors::execute(const ExecutionContext &ctx)
     auto user_type = desc->info.typeInfo().type();
     auto &model_info = entryExecutor()->inputInfo(i).typeInfo();
     auto model_type = model_info.type();
-    if ((user_type != model_type && user_type == ir::DataType::FLOAT32) ||
-        (desc->layout == ir::Layout::NCHW))
+    const bool need_conversion = (user_type != model_type && user_type == ir::DataType::FLOAT32) ||
+                                 (desc->layout == ir::Layout::NCHW);
+
+    // User buffer is bound to the executor directly (zero-copy) if it does not need conversion.
+    // Otherwise, or if it cannot be accessed safely by kernels, it is copied to EdgeTensor.
+    bool bind_directly = !need_conversion;
+    if (bind_directly && desc->buffer != nullptr)
+    {
+      if (!isAligned(desc->buffer, model_type))
+      {
+        VERBOSE(SingleModelExecutors) << "Input " << i << "'s buffer is misaligned, copy it"
+                                      << std::endl;
+        bind_directly = false;
+      }
+      else if (overlapsOutputs(*desc, ctx.desc))
+      {
+        VERBOSE(SingleModelExecutors) << "Input " << i << "'s buffer overlaps output, copy it"
+                                      << std::endl;
+        bind_directly = false;
+      }
+    }
+
+    if (!bind_directly)
     {
       auto quantized_info = desc->info;
       quantized_info.typeInfo(model_info);
@@ -125,8 +189,18 @@ void SingleModelExecutors::execute(const ExecutionContext &ctx)
     auto user_type = desc->info.typeInfo().type();
     auto &model_info = entryExecutor()->outputInfo(i).typeInfo();
     auto model_type = model_info.type();
-    if ((user_type != model_type && user_type == ir::DataType::FLOAT32) ||
-        (desc->layout == ir::Layout::NCHW))
+    const bool need_conversion = (user_type != model_type && user_type == ir::DataType::FLOAT32) ||
+                                 (desc->layout == ir::Layout::NCHW);
+
+    bool bind_directly = !need_conversion;
+    if (bind_directly && desc->buffer != nullptr && !isAligned(desc->buffer, model_type))
+    {
+      VERBOSE(SingleModelExecutors) << "Output " << i << "'s buffer is misaligned, copy it"
+                                    << std::endl;
+      bind_directly = false;
+    }
+
+    if (!bind_directly)
     {
       auto quantized_info = desc->info;
       quantized_info.typeInfo(model_info);
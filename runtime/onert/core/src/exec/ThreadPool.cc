@@ -23,13 +23,26 @@ namespace onert
 namespace exec
 {
 
-ThreadPool::ThreadPool(uint32_t num_threads)
+namespace
+{
+
+// The pool and the deque index of the calling thread, if it is a worker
+thread_local const ThreadPool *tls_pool = nullptr;
+thread_local uint32_t tls_index = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(uint32_t num_threads, uint32_t queue_capacity)
 {
   assert(num_threads >= 1);
 
   for (uint32_t i = 0; i < num_threads; i++)
   {
-    _threads.emplace_back(std::ref(_worker));
+    _queues.emplace_back(std::make_unique<WorkStealingQueue>(queue_capacity));
+  }
+  for (uint32_t i = 0; i < num_threads; i++)
+  {
+    _threads.emplace_back(&ThreadPool::worker, this, i);
   }
 }
 
@@ -37,14 +50,74 @@ ThreadPool::~ThreadPool()
 {
   if (!_threads.empty())
   {
-    _worker.terminate();
+    {
+      std::unique_lock<std::mutex> lock{_mu};
+      _state = State::FORCE_FINISHING;
+    }
+    _cv.notify_all();
     join();
   }
 }
 
-void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn) { _worker.enqueue(std::move(fn)); }
+void ThreadPool::enqueue(IFunction *fn)
+{
+  const auto index = (tls_pool == this) ? tls_index : (_next_queue++ % _queues.size());
+  _queues[index]->push(fn);
+  _num_jobs++;
+
+  // Wake a sleeping worker only. Busy workers will find the job before going to sleep.
+  if (_num_sleeping > 0)
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    _cv.notify_one();
+  }
+}
+
+uint32_t ThreadPool::numJobsInQueue() { return _num_jobs; }
+
+IFunction *ThreadPool::take(uint32_t index)
+{
+  auto fn = _queues[index]->pop();
+  for (uint32_t i = 1; fn == nullptr && i < _queues.size(); i++)
+  {
+    fn = _queues[(index + i) % _queues.size()]->steal();
+  }
+
+  if (fn != nullptr)
+    _num_jobs--;
+  return fn;
+}
+
+void ThreadPool::worker(uint32_t index)
+{
+  tls_pool = this;
+  tls_index = index;
+
+  while (true)
+  {
+    auto *fn = take(index);
+    if (fn != nullptr)
+    {
+      fn->run();
+      continue;
+    }
 
-uint32_t ThreadPool::numJobsInQueue() { return _worker.numJobsInQueue(); }
+    std::unique_lock<std::mutex> lock{_mu};
+    _num_sleeping++;
+    _cv.wait(lock, [this] { return (_state != State::ONLINE) || (_num_jobs > 0); });
+    _num_sleeping--;
+
+    if (_state == State::FORCE_FINISHING)
+    {
+      assert(_num_jobs == 0 && "Terminating with unfinished jobs");
+      return;
+    }
+    else if (_state == State::FINISHING && _num_jobs == 0)
+    {
+      return;
+    }
+  }
+}
 
 void ThreadPool::join()
 {
@@ -57,7 +130,11 @@ void ThreadPool::join()
 
 void ThreadPool::finish()
 {
-  _worker.finish();
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    _state = State::FINISHING;
+  }
+  _cv.notify_all();
   join();
 }
 
@@ -17,26 +17,48 @@
 #ifndef __ONERT_EXEC_THREAD_POOL_H__
 #define __ONERT_EXEC_THREAD_POOL_H__
 
-#include <thread>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
-#include "WorkQueue.h"
+#include "WorkStealingQueue.h"
 
 namespace onert
 {
 namespace exec
 {
 
+/**
+ * @brief Work-stealing thread pool
+ *
+ * Every worker owns a @c WorkStealingQueue. A job enqueued from one of the pool's own workers
+ * goes to that worker's deque and runs next on the same thread; a job enqueued from outside is
+ * distributed round-robin. Idle workers steal from the other deques before going to sleep.
+ *
+ * The pool does not own jobs, so a caller may enqueue the same preallocated job on every run.
+ * Workers live until the pool is destroyed or @c finish is called.
+ */
 class ThreadPool
 {
+public:
+  enum class State
+  {
+    ONLINE,
+    FINISHING,
+    FORCE_FINISHING
+  };
+
 public:
   /**
    * @brief Coustruct ThreadPool object
    *
-   * @param num_threads Number of threads
+   * @param num_threads    Number of threads
+   * @param queue_capacity Initial capacity of each worker's queue
    */
-  ThreadPool(uint32_t num_threads = 1);
+  ThreadPool(uint32_t num_threads = 1, uint32_t queue_capacity = 16);
   /**
    * @brief Destroy ThreadPool object
    */
@@ -44,11 +66,11 @@ public:
   /**
    * @brief Enqueue a function
    *
-   * @param fn A function to be queued
+   * @param fn A function to be queued. It must be alive until it finishes running
    */
-  void enqueue(std::unique_ptr<IFunction> &&fn);
+  void enqueue(IFunction *fn);
   /**
-   * @brief Get number of jobs in worker's queue
+   * @brief Get number of jobs in workers' queues
    *
    * @return Number of jobs
    */
@@ -60,11 +82,19 @@ public:
   void finish();
 
 private:
+  void worker(uint32_t index);
+  IFunction *take(uint32_t index);
   void join();
 
 private:
-  WorkQueue _worker;
+  std::vector<std::unique_ptr<WorkStealingQueue>> _queues;
   std::vector<std::thread> _threads;
+  std::atomic<uint32_t> _num_jobs{0};
+  std::atomic<uint32_t> _num_sleeping{0};
+  std::atomic<uint32_t> _next_queue{0};
+  State _state{State::ONLINE};
+  std::mutex _mu;
+  std::condition_variable _cv;
 };
 
 } // namespace exec
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+namespace
+{
+using namespace onert;
+using namespace exec;
+
+class LambdaFunction : public IFunction
+{
+public:
+  LambdaFunction(const std::function<void()> &fn) : _fn{fn} {}
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+TEST(ThreadPool, run_all_jobs)
+{
+  std::atomic<uint32_t> count{0};
+  LambdaFunction fn{[&]() { count++; }};
+  {
+    // Small capacity to make the queues grow
+    ThreadPool pool{4, 2};
+    for (uint32_t i = 0; i < 1000; ++i)
+      pool.enqueue(&fn);
+    pool.finish();
+  }
+  ASSERT_EQ(count, 1000);
+}
+
+TEST(ThreadPool, successor_runs_on_same_thread)
+{
+  std::thread::id producer_id;
+  std::thread::id successor_id;
+  LambdaFunction successor{[&]() { successor_id = std::this_thread::get_id(); }};
+  {
+    ThreadPool pool{1};
+    LambdaFunction producer{[&]() {
+      producer_id = std::this_thread::get_id();
+      pool.enqueue(&successor);
+    }};
+    pool.enqueue(&producer);
+    pool.finish();
+  }
+  ASSERT_NE(producer_id, std::thread::id{});
+  ASSERT_EQ(producer_id, successor_id);
+}
+
+TEST(ThreadPool, steal_jobs)
+{
+  constexpr uint32_t num_jobs = 64;
+  std::atomic<uint32_t> count{0};
+  std::atomic<bool> stolen{false};
+  std::atomic<std::thread::id> owner;
+  LambdaFunction job{[&]() {
+    if (std::this_thread::get_id() != owner.load())
+      stolen = true;
+    count++;
+  }};
+  {
+    ThreadPool pool{2};
+    // One job fills its worker's own queue, and then blocks until another worker steals
+    LambdaFunction producer{[&]() {
+      owner = std::this_thread::get_id();
+      for (uint32_t i = 0; i < num_jobs; ++i)
+        pool.enqueue(&job);
+      while (!stolen)
+        std::this_thread::yield();
+    }};
+    pool.enqueue(&producer);
+    while (count != num_jobs)
+      std::this_thread::yield();
+    pool.finish();
+  }
+  ASSERT_TRUE(stolen);
+  ASSERT_EQ(count, num_jobs);
+}
+
+TEST(ThreadPool, neg_finish_twice)
+{
+  LambdaFunction fn{[]() {}};
+  ThreadPool pool{2};
+  pool.enqueue(&fn);
+  pool.finish();
+  ASSERT_NO_THROW(pool.finish());
+  ASSERT_EQ(pool.numJobsInQueue(), 0);
+}
+
+} // namespace
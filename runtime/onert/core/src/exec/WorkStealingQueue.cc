@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkStealingQueue.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace onert
+{
+namespace exec
+{
+
+WorkStealingQueue::WorkStealingQueue(uint32_t capacity) : _ring(std::max(capacity, 1u), nullptr)
+{
+}
+
+void WorkStealingQueue::push(IFunction *fn)
+{
+  assert(fn != nullptr);
+
+  std::lock_guard<std::mutex> lock{_mu};
+  if (_size == _ring.size())
+    grow();
+  _ring[(_head + _size) % _ring.size()] = fn;
+  _size++;
+}
+
+IFunction *WorkStealingQueue::pop()
+{
+  std::lock_guard<std::mutex> lock{_mu};
+  if (_size == 0)
+    return nullptr;
+
+  _size--;
+  return _ring[(_head + _size) % _ring.size()];
+}
+
+IFunction *WorkStealingQueue::steal()
+{
+  std::lock_guard<std::mutex> lock{_mu};
+  if (_size == 0)
+    return nullptr;
+
+  auto fn = _ring[_head];
+  _head = (_head + 1) % _ring.size();
+  _size--;
+  return fn;
+}
+
+void WorkStealingQueue::grow()
+{
+  std::vector<IFunction *> ring(_ring.size() * 2, nullptr);
+  for (uint32_t i = 0; i < _size; ++i)
+    ring[i] = _ring[(_head + i) % _ring.size()];
+  _ring.swap(ring);
+  _head = 0;
+}
+
+} // namespace exec
+} // namespace onert
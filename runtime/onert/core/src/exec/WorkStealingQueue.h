@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WORK_STEALING_QUEUE_H__
+#define __ONERT_EXEC_WORK_STEALING_QUEUE_H__
+
+#include <mutex>
+#include <vector>
+
+#include "exec/IFunction.h"
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Per-worker job deque
+ *
+ * The owner worker pushes and pops at the back (LIFO) so that a job made ready by the job it
+ * has just finished runs next on the same thread, while other workers steal from the front
+ * (FIFO). Each deque has its own lock, so the lock is uncontended unless someone is stealing.
+ *
+ * Jobs are not owned by the deque. It is a ring buffer which grows only when it is full, so
+ * pushing and popping do not allocate once it has reached its working size.
+ */
+class WorkStealingQueue
+{
+public:
+  /**
+   * @brief Construct WorkStealingQueue object
+   *
+   * @param capacity Initial capacity
+   */
+  WorkStealingQueue(uint32_t capacity = 16);
+  /**
+   * @brief Push a job to the back of the deque
+   *
+   * @param fn Function to be executed(a job)
+   */
+  void push(IFunction *fn);
+  /**
+   * @brief Pop a job from the back of the deque. Only the owner worker calls this
+   *
+   * @return A job, or nullptr if the deque is empty
+   */
+  IFunction *pop();
+  /**
+   * @brief Steal a job from the front of the deque. Called by non-owner workers
+   *
+   * @return A job, or nullptr if the deque is empty
+   */
+  IFunction *steal();
+
+private:
+  void grow();
+
+private:
+  std::vector<IFunction *> _ring;
+  uint32_t _head = 0;
+  uint32_t _size = 0;
+  std::mutex _mu;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WORK_STEALING_QUEUE_H__
@@ -71,6 +71,15 @@ void OperationDumper::visit(const ArgMinMax &node)
   VERBOSE(LIR) << "  - Output : Output(" << node.getOutputs().at(0) << ")" << std::endl;
 }
 
+void OperationDumper::visit(const Attention &node)
+{
+  std::string causal = node.param().causal ? "(Causal)" : "";
+  VERBOSE(LIR) << "* " << node.name() << causal << std::endl;
+  VERBOSE(LIR) << "  - Inputs : Query, Key, Value and Mask(" << node.getInputs() << ")"
+               << std::endl;
+  VERBOSE(LIR) << "  - Output : Output(" << node.getOutputs().at(0) << ")" << std::endl;
+}
+
 void OperationDumper::visit(const BatchToSpaceND &node)
 {
   std::string block_size =
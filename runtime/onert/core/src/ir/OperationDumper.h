@@ -32,6 +32,7 @@ public:
 
 public:
   void visit(const operation::ArgMinMax &) override;
+  void visit(const operation::Attention &) override;
   void visit(const operation::BatchToSpaceND &node) override;
   void visit(const operation::BCQFullyConnected &node) override;
   void visit(const operation::BinaryArithmetic &node) override;
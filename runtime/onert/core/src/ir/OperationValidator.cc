@@ -113,21 +113,31 @@ void OperationValidator::visit(const operation::ArgMinMax &node)
   OP_REQUIRES(isValidType(output_index, output_type));
 }
 
+void OperationValidator::visit(const operation::Attention &node)
+{
+  const auto output_index(node.getOutputs().at(0));
+
+  OP_REQUIRES(isValidType(output_index, DataType::FLOAT32));
+  for (const auto &input_index : node.getInputs() | Remove::UNDEFINED)
+    OP_REQUIRES(isSameType(input_index, output_index));
+}
+
 void OperationValidator::visit(const operation::BatchMatMul &node)
 {
   const auto lhs_index(node.getInputs().at(operation::BatchMatMul::Input::LHS));
   const auto rhs_index(node.getInputs().at(operation::BatchMatMul::Input::RHS));
   const auto output_index(node.getOutputs().at(0));
 
-  // Constant lhs and rhs is not implemented yet
-  OP_REQUIRES(!isConstant(lhs_index) && !isConstant(rhs_index));
+  // Constant lhs is not implemented yet
+  OP_REQUIRES(!isConstant(lhs_index));
 
-  // Allow hybrid quantization (lhs: float / rhs: qint8 / out: float)
-  OP_REQUIRES(isValidType(
-    lhs_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
+  // Allow hybrid quantization (lhs: float / rhs: qint8 or ggml block quant / out: float)
+  OP_REQUIRES(isValidType(lhs_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
+                                      DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_SYMM}));
   OP_REQUIRES(isSameType(lhs_index, rhs_index) ||
               ((operandType(lhs_index) == DataType::FLOAT32) &&
-               (operandType(rhs_index) == DataType::QUANT_INT8_ASYMM)));
+               isValidType(rhs_index, {DataType::QUANT_INT8_ASYMM, DataType::QUANT_GGML_Q4_0,
+                                       DataType::QUANT_GGML_Q8_0})));
   OP_REQUIRES(isSameType(lhs_index, output_index));
 }
 
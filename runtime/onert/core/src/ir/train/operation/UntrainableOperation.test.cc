@@ -35,6 +35,15 @@ operation::ArgMinMax generateArgMinMax()
   return operation::ArgMinMax{OperandIndexSequence{1, 2}, OperandIndexSequence{0}, param};
 }
 
+operation::Attention generateAttention()
+{
+  operation::Attention::Param param;
+  param.scale = 0.125f;
+  param.causal = true;
+
+  return operation::Attention{OperandIndexSequence{1, 2, 3}, OperandIndexSequence{0}, param};
+}
+
 operation::BatchMatMul generateBatchMatMul()
 {
   operation::BatchMatMul::Param param;
@@ -532,6 +541,7 @@ operation::TransposeConv generateTransposeConv()
   operation::TransposeConv::Param param;
   param.padding = Padding();
   param.stride = Stride();
+  param.activation = Activation::NONE;
 
   return operation::TransposeConv{OperandIndexSequence{1, 2, 3}, OperandIndexSequence{0}, param};
 }
@@ -614,6 +624,9 @@ TEST(UntrainableOperation, testAllOps)
   const auto argminmax = generateArgMinMax();
   verifyOp(argminmax);
 
+  const auto attention = generateAttention();
+  verifyOp(attention);
+
   const auto batch_matmul = generateBatchMatMul();
   verifyOp(batch_matmul);
 
@@ -846,6 +859,12 @@ TEST(UntrainableOperation, neg_TrainableOperationVisitor)
     EXPECT_ANY_THROW(visitor.invoke(*untrainable));
   }
 
+  {
+    const auto attention = generateAttention();
+    auto untrainable = generateUntrainableOperation(attention);
+    EXPECT_ANY_THROW(visitor.invoke(*untrainable));
+  }
+
   {
     const auto batch_matmul = generateBatchMatMul();
     auto untrainable = generateUntrainableOperation(batch_matmul);
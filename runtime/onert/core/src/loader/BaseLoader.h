@@ -71,7 +71,9 @@ public:
   explicit BaseLoader(std::unique_ptr<ir::Model> &model)
     : _base{nullptr}, _pagesize(getpagesize()), _fd(-1), _model(model), _domain_model{nullptr}
   {
-    _use_mmaped_data = util::getConfigBool(util::config::USE_MMAPED_DATA);
+    // Lazy weight paging keeps weights file-backed until kernels use them
+    _use_mmaped_data = util::getConfigBool(util::config::USE_MMAPED_DATA) ||
+                       util::getConfigBool(util::config::LAZY_WEIGHT_PAGING);
   }
 
   /**
@@ -131,6 +133,7 @@ private:
 
   void loadAddV2(const Operator *op, ir::Graph &subg);
   void loadArgMinMax(const Operator *op, ir::Graph &subg, bool is_argmax);
+  void loadAttention(const Operator *op, ir::Graph &subg);
   void loadBatchMatMul(const Operator *op, ir::Graph &subg);
   void loadBinaryArithmetic(const Operator *op, ir::Graph &subg,
                             ir::operation::BinaryArithmetic::ArithmeticType op_type);
@@ -731,6 +734,8 @@ void BaseLoader<LoaderDomain>::loadTransposeConv(const Operator *op, ir::Graph &
   ir::operation::TransposeConv::Param param;
   const auto *options = op->builtin_options_as_TransposeConvOptions();
   loadStridesAndPaddings(param, options);
+  // TFLite schema of this version has no fused activation for TransposeConv
+  param.activation = ir::Activation::NONE;
 
   loadOperationTo<ir::operation::TransposeConv>(op, subg, param);
 }
@@ -1112,6 +1117,7 @@ void BaseLoader<LoaderDomain>::loadCustom(const Operator *op, ir::Graph &subg)
   {
     AddV2,
     ReduceAll,
+    Attention,
     MatrixBandPart,
     BatchMatMul,
     Einsum,
@@ -1126,6 +1132,7 @@ void BaseLoader<LoaderDomain>::loadCustom(const Operator *op, ir::Graph &subg)
   std::map<std::string, BuiltinOP> builtin_map = {
     {"AddV2", BuiltinOP::AddV2},
     {"All", BuiltinOP::ReduceAll},
+    {"Attention", BuiltinOP::Attention},
     {"MatrixBandPart", BuiltinOP::MatrixBandPart},
     {"BatchMatMulV2", BuiltinOP::BatchMatMul},
     {"Einsum", BuiltinOP::Einsum},
@@ -1148,6 +1155,9 @@ void BaseLoader<LoaderDomain>::loadCustom(const Operator *op, ir::Graph &subg)
       case BuiltinOP::ReduceAll:
         loadReduceAll(op, subg);
         break;
+      case BuiltinOP::Attention:
+        loadAttention(op, subg);
+        break;
       case BuiltinOP::MatrixBandPart:
         loadOperationTo<ir::operation::MatrixBandPart>(op, subg);
         break;
@@ -1317,6 +1327,28 @@ void BaseLoader<LoaderDomain>::loadEinsum(const Operator *op, ir::Graph &subg)
     throw std::runtime_error{"Einsum: NYI input - only support two inputs"};
   }
 }
+
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadAttention(const Operator *op, ir::Graph &subg)
+{
+  ir::operation::Attention::Param param;
+  // Default is non-causal attention scaled by 1 / sqrt(depth)
+  param.scale = 0.f;
+  param.causal = false;
+  if (op->custom_options() != nullptr)
+  {
+    const auto attr_map = getCustomOpAttrMap(op);
+    param.scale = attr_map["scale"].AsFloat();
+    param.causal = attr_map["causal"].AsBool();
+  }
+
+  const auto attention = loadOperationTo<ir::operation::Attention>(op, subg, param);
+  if (attention->getInputs().size() != 3 && attention->getInputs().size() != 4)
+  {
+    throw std::runtime_error{"Attention: query, key, value and optional mask are required"};
+  }
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadFusedBatchNorm(const Operator *op, ir::Graph &subg)
 {
@@ -66,6 +66,11 @@ protected:
   //  TFLite: adj_x, adj_y
   void loadBatchMatMul(const Operator *op, ir::Graph &subg);
 
+  // Different options
+  //  Circle: fused_activation_function
+  //  TFLite: (none)
+  void loadTransposeConv(const Operator *op, ir::Graph &subg);
+
   // Only circle operations
   void loadInstanceNorm(const Operator *op, ir::Graph &subg);
   void loadBCQFullyConnected(const Operator *op, ir::Graph &subg);
@@ -80,6 +85,7 @@ public:
     {
       case BuiltinOperator::BuiltinOperator_FULLY_CONNECTED:
       case BuiltinOperator::BuiltinOperator_BCQ_FULLY_CONNECTED:
+      case BuiltinOperator::BuiltinOperator_TRANSPOSE_CONV:
       case BuiltinOperator::BuiltinOperator_UNIDIRECTIONAL_SEQUENCE_LSTM:
         return true;
       default:
@@ -141,6 +147,9 @@ private:
       case circle::BuiltinOperator::BuiltinOperator_BATCH_MATMUL:
         loadBatchMatMul(op, subg);
         return;
+      case circle::BuiltinOperator::BuiltinOperator_TRANSPOSE_CONV:
+        loadTransposeConv(op, subg);
+        return;
       case circle::BuiltinOperator::BuiltinOperator_INSTANCE_NORM:
         loadInstanceNorm(op, subg);
         return;
@@ -174,6 +183,22 @@ void CircleLoader::loadBatchMatMul(const Operator *op, ir::Graph &subg)
   subg.addOperation(std::move(new_op));
 }
 
+void CircleLoader::loadTransposeConv(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  ir::operation::TransposeConv::Param param;
+  const auto *options = op->builtin_options_as_TransposeConvOptions();
+  loadStridesAndPaddings(param, options);
+  param.activation = convertActivation(options->fused_activation_function());
+
+  std::unique_ptr<ir::Operation> new_op(new ir::operation::TransposeConv(inputs, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
 void CircleLoader::loadInstanceNorm(const Operator *op, ir::Graph &subg)
 {
   ir::OperandIndexSequence inputs;
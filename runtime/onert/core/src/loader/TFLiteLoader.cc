@@ -80,6 +80,7 @@ public:
     switch (op)
     {
       case BuiltinOperator::BuiltinOperator_FULLY_CONNECTED:
+      case BuiltinOperator::BuiltinOperator_TRANSPOSE_CONV:
       case BuiltinOperator::BuiltinOperator_UNIDIRECTIONAL_SEQUENCE_LSTM:
         return true;
       default:
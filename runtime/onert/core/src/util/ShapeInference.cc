@@ -229,6 +229,17 @@ ir::Shape inferReduceShape(const ir::Shape &input_shape, const std::vector<int>
   }
 }
 
+ir::Shape inferAttentionShape(const ir::Shape &query_shape, const ir::Shape &value_shape)
+{
+  if (query_shape.rank() != 4 || value_shape.rank() != 4)
+    throw std::runtime_error{"Attention shape inference: query and value should be rank 4"};
+
+  // [batch, heads, q_len, value depth]
+  ir::Shape output_shape(query_shape);
+  output_shape.dim(3) = value_shape.dim(3);
+  return output_shape;
+}
+
 ir::Shape inferBatchMatMulShape(const ir::Shape &lhs_shape, const ir::Shape &rhs_shape,
                                 const ir::operation::BatchMatMul::Param &param)
 {
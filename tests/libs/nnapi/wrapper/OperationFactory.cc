@@ -1061,6 +1061,7 @@ OperationFactory::OperationFactory()
     param.padding.type =
       NNAPIConvert::getPaddingType(operands.at(padding_index).asScalar<PaddingCode>());
     param.stride = makeStride(operands, hstride_index, vstride_index);
+    param.activation = Activation::NONE;
 
     return new operation::TransposeConv{inputs, outputs, param};
   };
@@ -569,6 +569,16 @@ uint32_t CircleGen::addOperatorTranspose(const OperatorParams &params)
                                 circle::BuiltinOptions_TransposeOptions, options);
 }
 
+uint32_t CircleGen::addOperatorTransposeConv(const OperatorParams &params,
+                                             circle::Padding padding, int stride_w, int stride_h,
+                                             circle::ActivationFunctionType actfn)
+{
+  auto options =
+    circle::CreateTransposeConvOptions(_fbb, padding, stride_w, stride_h, actfn).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_TRANSPOSE_CONV,
+                                circle::BuiltinOptions_TransposeConvOptions, options);
+}
+
 uint32_t CircleGen::addOperatorSqrt(const OperatorParams &params)
 {
   return addOperatorWithOptions(params, circle::BuiltinOperator_SQRT, circle::BuiltinOptions_NONE,
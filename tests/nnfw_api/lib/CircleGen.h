@@ -227,6 +227,9 @@ public:
   uint32_t addOperatorSub(const OperatorParams &params, circle::ActivationFunctionType actfn);
   uint32_t addOperatorTile(const OperatorParams &params);
   uint32_t addOperatorTranspose(const OperatorParams &params);
+  uint32_t addOperatorTransposeConv(
+    const OperatorParams &params, circle::Padding padding, int stride_w, int stride_h,
+    circle::ActivationFunctionType actfn = circle::ActivationFunctionType_NONE);
   uint32_t addOperatorWhile(const OperatorParams &params, uint32_t cond_subg, uint32_t body_subg);
 
   // NOTE Please add addOperator functions ABOVE this line in ALPHABETICAL ORDER
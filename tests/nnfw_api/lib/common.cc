@@ -56,6 +56,17 @@ std::vector<uint8_t> quantData(const std::vector<float> &buf_val, const circle::
       ggml_quantize_chunk(GGML_TYPE_Q4_0, buf_val.data(), buf.data(), 0, 1, num_elems, nullptr);
       return buf;
     }
+    case circle::TensorType::TensorType_GGML_Q8_0:
+    {
+      size_t num_elems = buf_val.size();
+      const size_t block_size = ggml_blck_size(GGML_TYPE_Q8_0);
+      const int64_t num_block = num_elems / block_size;
+      const size_t block_struct_size = ggml_type_size(GGML_TYPE_Q8_0);
+
+      auto buf = std::vector<uint8_t>(num_block * block_struct_size);
+      ggml_quantize_chunk(GGML_TYPE_Q8_0, buf_val.data(), buf.data(), 0, 1, num_elems, nullptr);
+      return buf;
+    }
     default:
       throw std::runtime_error("Unsupported tensor type");
   }
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fixtures.h"
+
+#include <Batcher.h>
+
+#include <chrono>
+#include <future>
+#include <vector>
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+// Two floats per sample : out = in + {1, 2}
+CircleBuffer genBatchAddModel()
+{
+  CircleGen cgen;
+  std::vector<float> rhs_data{1, 2};
+  uint32_t rhs_buf = cgen.addBuffer(rhs_data);
+  int lhs = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, rhs_buf});
+  int out = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorAdd({{lhs, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({lhs}, {out});
+  return cgen.finish();
+}
+
+class BatcherTest : public ValidationTestSessionCreated
+{
+protected:
+  void SetUp() override
+  {
+    ValidationTestSessionCreated::SetUp();
+    _cbuf = genBatchAddModel();
+    NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session, _cbuf.buffer(), _cbuf.size()));
+    NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+    NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+  }
+
+  CircleBuffer _cbuf;
+};
+
+} // namespace
+
+TEST_F(BatcherTest, batch_by_max_batch_size)
+{
+  batcher::BatcherOptions options;
+  options.max_batch_size = 4;
+  // Long enough that only full batches can complete the requests within the test
+  options.max_delay = std::chrono::duration_cast<std::chrono::microseconds>(60s);
+  batcher::Batcher batcher{_session, options};
+
+  constexpr uint32_t num_requests = 8;
+  std::vector<std::vector<float>> inputs(num_requests);
+  std::vector<std::vector<float>> outputs(num_requests, std::vector<float>(2));
+  std::vector<std::future<NNFW_STATUS>> futures;
+  for (uint32_t i = 0; i < num_requests; ++i)
+  {
+    inputs[i] = {static_cast<float>(i), static_cast<float>(10 * i)};
+    futures.emplace_back(batcher.submit({inputs[i].data()}, {outputs[i].data()}));
+  }
+
+  for (auto &future : futures)
+  {
+    ASSERT_EQ(future.wait_for(10s), std::future_status::ready);
+    NNFW_ENSURE_SUCCESS(future.get());
+  }
+
+  for (uint32_t i = 0; i < num_requests; ++i)
+    ASSERT_EQ(outputs[i], (std::vector<float>{i + 1.f, 10.f * i + 2.f}));
+
+  const auto stats = batcher.stats();
+  ASSERT_EQ(stats.requests, num_requests);
+  ASSERT_EQ(stats.batches, 2u);
+  ASSERT_EQ(stats.failed_requests, 0u);
+  ASSERT_DOUBLE_EQ(stats.avgBatchSize(), 4.0);
+}
+
+TEST_F(BatcherTest, batch_by_max_delay)
+{
+  batcher::BatcherOptions options;
+  options.max_batch_size = 8;
+  options.max_delay = std::chrono::duration_cast<std::chrono::microseconds>(200ms);
+  batcher::Batcher batcher{_session, options};
+
+  constexpr uint32_t num_requests = 3;
+  std::vector<std::vector<float>> inputs(num_requests, std::vector<float>{1, 1});
+  std::vector<std::vector<float>> outputs(num_requests, std::vector<float>(2));
+  std::vector<std::future<NNFW_STATUS>> futures;
+  for (uint32_t i = 0; i < num_requests; ++i)
+    futures.emplace_back(batcher.submit({inputs[i].data()}, {outputs[i].data()}));
+
+  // A partial batch runs once the oldest request has waited max_delay
+  for (auto &future : futures)
+  {
+    ASSERT_EQ(future.wait_for(10s), std::future_status::ready);
+    NNFW_ENSURE_SUCCESS(future.get());
+  }
+
+  for (const auto &output : outputs)
+    ASSERT_EQ(output, (std::vector<float>{2, 3}));
+
+  const auto stats = batcher.stats();
+  ASSERT_EQ(stats.requests, num_requests);
+  ASSERT_EQ(stats.batches, 1u);
+  ASSERT_GE(stats.max_latency.count(), 200000);
+}
+
+TEST_F(BatcherTest, stats_after_futures)
+{
+  batcher::BatcherOptions options;
+  options.max_batch_size = 1;
+  batcher::Batcher batcher{_session, options};
+
+  std::vector<float> input{0, 0};
+  std::vector<float> output(2);
+  for (uint32_t i = 1; i <= 16; ++i)
+  {
+    NNFW_ENSURE_SUCCESS(batcher.submit({input.data()}, {output.data()}).get());
+    // Every completed request must be counted once its future is ready
+    const auto stats = batcher.stats();
+    ASSERT_EQ(stats.requests, i);
+    ASSERT_EQ(stats.batches, i);
+  }
+}
+
+TEST_F(BatcherTest, neg_run_error)
+{
+  batcher::BatcherOptions options;
+  options.max_batch_size = 1;
+  batcher::Batcher batcher{_session, options};
+
+  // nnfw_set_input fails on a null buffer, and the error is given to the request
+  std::vector<float> output(2);
+  ASSERT_EQ(batcher.submit({nullptr}, {output.data()}).get(), NNFW_STATUS_ERROR);
+
+  auto stats = batcher.stats();
+  ASSERT_EQ(stats.requests, 1u);
+  ASSERT_EQ(stats.failed_requests, 1u);
+
+  // A failed batch does not affect the next one
+  std::vector<float> input{1, 1};
+  NNFW_ENSURE_SUCCESS(batcher.submit({input.data()}, {output.data()}).get());
+  ASSERT_EQ(output, (std::vector<float>{2, 3}));
+
+  stats = batcher.stats();
+  ASSERT_EQ(stats.requests, 2u);
+  ASSERT_EQ(stats.failed_requests, 1u);
+}
+
+TEST_F(BatcherTest, neg_submit_wrong_io_count)
+{
+  batcher::Batcher batcher{_session, batcher::BatcherOptions{}};
+
+  std::vector<float> input{1, 1};
+  std::vector<float> output(2);
+  ASSERT_EQ(batcher.submit({input.data(), input.data()}, {output.data()}).get(),
+            NNFW_STATUS_ERROR);
+  ASSERT_EQ(batcher.submit({input.data()}, {}).get(), NNFW_STATUS_ERROR);
+
+  // Rejected requests never reach the batching thread
+  ASSERT_EQ(batcher.stats().requests, 0u);
+}
+
+TEST_F(ValidationTestSessionCreated, neg_batcher_create)
+{
+  ASSERT_THROW(batcher::Batcher(nullptr, batcher::BatcherOptions{}), std::runtime_error);
+
+  auto cbuf = genBatchAddModel();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+
+  batcher::BatcherOptions options;
+  options.max_batch_size = 0;
+  ASSERT_THROW(batcher::Batcher(_session, options), std::runtime_error);
+}
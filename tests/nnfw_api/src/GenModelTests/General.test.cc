@@ -340,6 +340,66 @@ TEST_F(GenModelTest, neg_Reshape_without_shape_param)
 }
 
 // test to check model that has op->while->op
+TEST_F(GenModelTest, Inplace_chain)
+{
+  // (( Input 0 )) -> [ Add ] -> [ Relu ] -> [ Reshape ] -> [ Add ] -> (( Output ))
+  //                                                          ^
+  // (( Input 1 )) -------------------------------------------'
+  //
+  // Relu and Reshape can run in-place on the buffer of the first Add
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  std::vector<int32_t> new_shape_data{4};
+  uint32_t new_shape_buf = cgen.addBuffer(new_shape_data);
+  int in0 = cgen.addTensor({{1, 2, 2, 1}, f32});
+  int in1 = cgen.addTensor({{4}, f32});
+  int t1 = cgen.addTensor({{1, 2, 2, 1}, f32});
+  int t2 = cgen.addTensor({{1, 2, 2, 1}, f32});
+  int new_shape = cgen.addTensor({{1}, circle::TensorType::TensorType_INT32, new_shape_buf});
+  int t3 = cgen.addTensor({{4}, f32});
+  int out = cgen.addTensor({{4}, f32});
+  cgen.addOperatorAdd({{in0, in0}, {t1}}, circle::ActivationFunctionType_NONE);
+  cgen.addOperatorRelu({{t1}, {t2}});
+  cgen.addOperatorReshape({{t2, new_shape}, {t3}}, &new_shape_data);
+  cgen.addOperatorAdd({{t3, in1}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({in0, in1}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, -2, 3, -4}, {1, 1, 1, 1}}, {{3, 1, 7, 1}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, Inplace_input_used_twice)
+{
+  // (( Input )) -> [ Add ] -+-> [ Relu ] -> [ Add ] -> [ Reshape ] -> (( Output ))
+  //                         `----------------^
+  //
+  // Relu must not overwrite the first Add's output which is still read by the second Add
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  std::vector<int32_t> new_shape_data{4};
+  uint32_t new_shape_buf = cgen.addBuffer(new_shape_data);
+  int in = cgen.addTensor({{1, 2, 2, 1}, f32});
+  int t1 = cgen.addTensor({{1, 2, 2, 1}, f32});
+  int t2 = cgen.addTensor({{1, 2, 2, 1}, f32});
+  int t3 = cgen.addTensor({{1, 2, 2, 1}, f32});
+  int new_shape = cgen.addTensor({{1}, circle::TensorType::TensorType_INT32, new_shape_buf});
+  int out = cgen.addTensor({{4}, f32});
+  cgen.addOperatorAdd({{in, in}, {t1}}, circle::ActivationFunctionType_NONE);
+  cgen.addOperatorRelu({{t1}, {t2}});
+  cgen.addOperatorAdd({{t2, t1}, {t3}}, circle::ActivationFunctionType_NONE);
+  cgen.addOperatorReshape({{t3, new_shape}, {out}}, &new_shape_data);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, -2, 3, -4}}, {{4, -4, 12, -8}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
 TEST_F(GenModelTest, while_with_input_output)
 {
   // The model looks just like the below pseudocode
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "fixtures.h"
+#include "common.h"
+#include "CircleGen.h"
+
+#include <cstring>
+
+/**
+ * @brief Testing the following model:
+ *       #1 = placeholder (shape = [3, 3], dtype=float)
+ *       #2 = transpose(#1, perm = [1, 0])
+ *
+ * Transpose cannot run in-place, so this model shows whether user buffers shared between input
+ * and output are handled safely.
+ */
+auto build_model_transpose_io_binding()
+{
+  CircleGen cgen;
+  std::vector<int32_t> perms_data{1, 0};
+  uint32_t perms_buf = cgen.addBuffer(perms_data);
+  int perms = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32, perms_buf});
+  int in = cgen.addTensor({{3, 3}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{3, 3}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorTranspose({{in, perms}, {out}});
+  cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+class IOBindingTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session));
+    NNFW_ENSURE_SUCCESS(
+      nnfw_load_circle_from_buffer(_session, _model_buf.buffer(), _model_buf.size()));
+    NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+    NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+  }
+
+  void TearDown() override { NNFW_ENSURE_SUCCESS(nnfw_close_session(_session)); }
+
+protected:
+  const CircleBuffer _model_buf = build_model_transpose_io_binding();
+  nnfw_session *_session = nullptr;
+  const std::vector<float> _input = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+  const std::vector<float> _expected = {0, 3, 6, 1, 4, 7, 2, 5, 8};
+};
+
+TEST_F(IOBindingTest, aligned_buffers)
+{
+  std::vector<float> output(_expected.size());
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, _input.data(),
+                                     sizeof(float) * _input.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                                      sizeof(float) * output.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+
+  ASSERT_EQ(output, _expected);
+}
+
+TEST_F(IOBindingTest, misaligned_buffers)
+{
+  const size_t size = sizeof(float) * _input.size();
+  // Offset by 1 byte to make buffers misaligned for float access
+  std::vector<uint8_t> input_storage(size + 1);
+  std::vector<uint8_t> output_storage(size + 1);
+  uint8_t *input = input_storage.data() + 1;
+  uint8_t *output = output_storage.data() + 1;
+  std::memcpy(input, _input.data(), size);
+
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, input, size));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, output, size));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+
+  std::vector<float> actual(_expected.size());
+  std::memcpy(actual.data(), output, size);
+  ASSERT_EQ(actual, _expected);
+}
+
+TEST_F(IOBindingTest, shared_input_output_buffer)
+{
+  std::vector<float> buffer = _input;
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, buffer.data(),
+                                     sizeof(float) * buffer.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, buffer.data(),
+                                      sizeof(float) * buffer.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+
+  ASSERT_EQ(buffer, _expected);
+}
+
+TEST_F(IOBindingTest, neg_run_after_buffer_released)
+{
+  {
+    std::vector<float> output(_expected.size());
+    NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, _input.data(),
+                                       sizeof(float) * _input.size()));
+    NNFW_ENSURE_SUCCESS(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                                        sizeof(float) * output.size()));
+    NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+    ASSERT_EQ(output, _expected);
+  }
+
+  // Output buffer is released, so user should set it again before next run
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, nullptr, 0));
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_ERROR);
+}
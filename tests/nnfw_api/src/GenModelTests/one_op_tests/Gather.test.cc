@@ -53,6 +53,40 @@ TEST_F(GenModelTest, OneOp_Gather_Q4_0)
   SUCCEED();
 }
 
+TEST_F(GenModelTest, OneOp_Gather_Q8_0)
+{
+  CircleGen cgen;
+
+  // Each block has 127 * 0.0625 as its max, so values are exact after quantization
+  std::vector<float> params(4 * 64);
+  for (uint32_t i = 0; i < params.size(); i++)
+  {
+    int32_t quant = (i % 32 == 0) ? 127 : static_cast<int32_t>(i * 7 % 255) - 127;
+    params[i] = quant * 0.0625f;
+  }
+
+  auto input_vector = quantData(params, circle::TensorType::TensorType_GGML_Q8_0);
+  auto input_buf = cgen.addBuffer(input_vector);
+  int input = cgen.addTensor({{4, 64}, circle::TensorType::TensorType_GGML_Q8_0, input_buf});
+  int indice = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32});
+  int output = cgen.addTensor({{2, 64}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorGather({{input, indice}, {output}});
+  cgen.setInputsAndOutputs({indice}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+
+  TestCaseData tc;
+  tc.addInput<int32_t>({3, 1});
+  std::vector<float> expected{params.begin() + 192, params.end()};
+  expected.insert(expected.end(), params.begin() + 64, params.begin() + 128);
+  tc.addOutput<float>(expected);
+  _context->addTestCase(tc);
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
 TEST_F(GenModelTest, neg_OneOp_Gather_Q4_0_InvalidOutType)
 {
   CircleGen cgen;
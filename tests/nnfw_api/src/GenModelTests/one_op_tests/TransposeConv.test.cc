@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+TEST_F(GenModelTest, OneOp_TransposeConv)
+{
+  CircleGen cgen;
+  std::vector<int32_t> shape_data{1, 3, 3, 1};
+  uint32_t shape_buf = cgen.addBuffer(shape_data);
+  std::vector<float> weight_data{1, 2, 3, 4};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  int shape = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, shape_buf});
+  int weight = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 3, 3, 1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorTransposeConv({{shape, weight, in}, {out}}, circle::Padding_VALID, 1, 1);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4}}, {{1, 4, 4, 6, 20, 16, 9, 24, 16}}));
+  _context->setBackends({"acl_cl", "acl_neon", "cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_TransposeConv_Bias)
+{
+  CircleGen cgen;
+  std::vector<int32_t> shape_data{1, 4, 4, 2};
+  uint32_t shape_buf = cgen.addBuffer(shape_data);
+  std::vector<float> weight_data{1, 0, 2, -1, 0, 3, -2, 1, -1, 2, 0, 1, 3, -1, 1, 0};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  std::vector<float> bias_data{1, -1};
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int shape = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, shape_buf});
+  int weight = cgen.addTensor({{2, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+  int in = cgen.addTensor({{1, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int bias = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, bias_buf});
+  int out = cgen.addTensor({{1, 4, 4, 2}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorTransposeConv({{shape, weight, in, bias}, {out}}, circle::Padding_VALID, 2, 2);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+    {{1, -2, 3, 0, 2, -1, 4, 1}},
+    {{2, -6, 5, -3, 4, -4, 7, -1, -5, 4, -3, 0, 1, 8, -5, 2, 3, -5, 6, -2, 5, -3, 8, 0, -2, 6, -4,
+      1, 4, 10, -6, 3}}));
+  _context->setBackends({"acl_cl", "acl_neon", "cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_TransposeConv_BiasRelu)
+{
+  CircleGen cgen;
+  std::vector<int32_t> shape_data{1, 4, 4, 2};
+  uint32_t shape_buf = cgen.addBuffer(shape_data);
+  std::vector<float> weight_data{1, 0, 2, -1, 0, 3, -2, 1, -1, 2, 0, 1, 3, -1, 1, 0};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  std::vector<float> bias_data{1, -1};
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int shape = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, shape_buf});
+  int weight = cgen.addTensor({{2, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+  int in = cgen.addTensor({{1, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int bias = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, bias_buf});
+  int out = cgen.addTensor({{1, 4, 4, 2}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorTransposeConv({{shape, weight, in, bias}, {out}}, circle::Padding_VALID, 2, 2,
+                                circle::ActivationFunctionType_RELU);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+    {{1, -2, 3, 0, 2, -1, 4, 1}},
+    {{2, 0, 5, 0, 4, 0, 7, 0, 0, 4, 0, 0, 1, 8, 0, 2, 3, 0, 6, 0, 5, 0, 8, 0, 0, 6, 0, 1, 4, 10, 0,
+      3}}));
+  _context->setBackends({"acl_cl", "acl_neon", "cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_TransposeConv_I8_FilterZeroPointRelu)
+{
+  CircleGen cgen;
+  std::vector<int32_t> shape_data{1, 3, 3, 1};
+  uint32_t shape_buf = cgen.addBuffer(shape_data);
+  // {1, 2, 3, 4} quantized with zero point 2
+  std::vector<int8_t> weight_data{3, 4, 5, 6};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  int shape = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, shape_buf});
+  int weight =
+    cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_INT8, weight_buf}, 1.0, 2);
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_INT8}, 1.0, 0);
+  int out = cgen.addTensor({{1, 3, 3, 1}, circle::TensorType::TensorType_INT8}, 1.0, -10);
+  cgen.addOperatorTransposeConv({{shape, weight, in}, {out}}, circle::Padding_VALID, 1, 1,
+                                circle::ActivationFunctionType_RELU);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    uniformTCD<int8_t>({{1, -2, 3, -4}}, {{-9, -10, -10, -4, -10, -10, -1, -10, -10}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_TransposeConv_OptionalBias)
+{
+  CircleGen cgen;
+  std::vector<int32_t> shape_data{1, 3, 3, 1};
+  uint32_t shape_buf = cgen.addBuffer(shape_data);
+  std::vector<float> weight_data{1, 2, 3, 4};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  int shape = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, shape_buf});
+  int weight = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 3, 3, 1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorTransposeConv({{shape, weight, in, -1 /* Optional bias */}, {out}},
+                                circle::Padding_VALID, 1, 1);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4}}, {{1, 4, 4, 6, 20, 16, 9, 24, 16}}));
+  _context->setBackends({"acl_cl", "acl_neon", "cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_TransposeConv_InvalidBiasShape)
+{
+  CircleGen cgen;
+  std::vector<int32_t> shape_data{1, 3, 3, 1};
+  uint32_t shape_buf = cgen.addBuffer(shape_data);
+  std::vector<float> weight_data{1, 2, 3, 4};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  std::vector<float> bias_data{1, 2, 3};
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int shape = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, shape_buf});
+  int weight = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int bias = cgen.addTensor({{3}, circle::TensorType::TensorType_FLOAT32, bias_buf});
+  int out = cgen.addTensor({{1, 3, 3, 1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorTransposeConv({{shape, weight, in, bias}, {out}}, circle::Padding_VALID, 1, 1);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
@@ -137,4 +137,128 @@ TEST_F(ValidationTestTwoSessionsCreated, two_sessions_run_simple_While_model)
   SUCCEED();
 }
 
+TEST_F(ValidationTestTwoSessions, shared_session_run_simple_Add_model)
+{
+  CircleGen cgen;
+  std::vector<float> rhs_data{5, 4, 7, 4};
+  uint32_t rhs_buf = cgen.addBuffer(rhs_data);
+  int lhs = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32, rhs_buf});
+  int out = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorAdd({{lhs, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({lhs}, {out});
+  auto cbuf = cgen.finish();
+
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session1, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session1, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_create_shared_session(_session1, &_session2));
+
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session2));
+
+  std::vector<float> in_buf1{1, 3, 2, 4};
+  std::vector<float> out_buf1(4);
+  std::vector<float> in_buf2{0, 1, 2, 3};
+  std::vector<float> out_buf2(4);
+
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session1, 0, NNFW_TYPE_TENSOR_FLOAT32, in_buf1.data(),
+                                     in_buf1.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(_session1, 0, NNFW_TYPE_TENSOR_FLOAT32, out_buf1.data(),
+                                      out_buf1.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session2, 0, NNFW_TYPE_TENSOR_FLOAT32, in_buf2.data(),
+                                     in_buf2.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(_session2, 0, NNFW_TYPE_TENSOR_FLOAT32, out_buf2.data(),
+                                      out_buf2.size() * sizeof(float)));
+
+  NNFW_ENSURE_SUCCESS(nnfw_run_async(_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_run_async(_session2));
+
+  NNFW_ENSURE_SUCCESS(nnfw_await(_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_await(_session2));
+
+  ASSERT_EQ(out_buf1, (std::vector<float>{6, 7, 9, 8}));
+  ASSERT_EQ(out_buf2, (std::vector<float>{5, 5, 9, 7}));
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session2));
+}
+
+TEST_F(ValidationTestTwoSessions, shared_session_different_input_shapes)
+{
+  CircleGen cgen;
+  std::vector<float> rhs_data{10};
+  uint32_t rhs_buf = cgen.addBuffer(rhs_data);
+  int lhs = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{1}, circle::TensorType::TensorType_FLOAT32, rhs_buf});
+  int out = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorAdd({{lhs, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({lhs}, {out});
+  auto cbuf = cgen.finish();
+
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session1, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session1, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_create_shared_session(_session1, &_session2));
+
+  // Changing the input shape of one session must not change the other
+  nnfw_tensorinfo ti2 = {NNFW_TYPE_TENSOR_FLOAT32, 4, {1, 3, 2, 1}};
+  NNFW_ENSURE_SUCCESS(nnfw_set_input_tensorinfo(_session2, 0, &ti2));
+
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session2));
+
+  nnfw_tensorinfo out_ti1, out_ti2;
+  NNFW_ENSURE_SUCCESS(nnfw_output_tensorinfo(_session1, 0, &out_ti1));
+  NNFW_ENSURE_SUCCESS(nnfw_output_tensorinfo(_session2, 0, &out_ti2));
+  ASSERT_EQ(out_ti1.rank, 4);
+  ASSERT_EQ(out_ti1.dims[1], 2);
+  ASSERT_EQ(out_ti2.rank, 4);
+  ASSERT_EQ(out_ti2.dims[1], 3);
+
+  std::vector<float> in_buf1{1, 2, 3, 4};
+  std::vector<float> out_buf1(4);
+  std::vector<float> in_buf2{0, 1, 2, 3, 4, 5};
+  std::vector<float> out_buf2(6);
+
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session1, 0, NNFW_TYPE_TENSOR_FLOAT32, in_buf1.data(),
+                                     in_buf1.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(_session1, 0, NNFW_TYPE_TENSOR_FLOAT32, out_buf1.data(),
+                                      out_buf1.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session2, 0, NNFW_TYPE_TENSOR_FLOAT32, in_buf2.data(),
+                                     in_buf2.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(_session2, 0, NNFW_TYPE_TENSOR_FLOAT32, out_buf2.data(),
+                                      out_buf2.size() * sizeof(float)));
+
+  NNFW_ENSURE_SUCCESS(nnfw_run_async(_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_run_async(_session2));
+
+  NNFW_ENSURE_SUCCESS(nnfw_await(_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_await(_session2));
+
+  ASSERT_EQ(out_buf1, (std::vector<float>{11, 12, 13, 14}));
+  ASSERT_EQ(out_buf2, (std::vector<float>{10, 11, 12, 13, 14, 15}));
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session2));
+}
+
+TEST_F(ValidationTestTwoSessions, neg_shared_session_after_prepare)
+{
+  constexpr int N = 1, H = 4, W = 4, C = 1;
+  AveragePoolModel model(N, H, W, C);
+
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session1));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_load_circle_from_buffer(_session1, model.cbuf.buffer(), model.cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session1));
+
+  ASSERT_EQ(nnfw_create_shared_session(_session1, &_session2), NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(_session2, nullptr);
+  ASSERT_EQ(nnfw_create_shared_session(nullptr, &_session2), NNFW_STATUS_UNEXPECTED_NULL);
+  ASSERT_EQ(nnfw_create_shared_session(_session1, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session1));
+}
+
 // TODO Write two-session-test with large models run by threads
@@ -0,0 +1,89 @@
+#!/bin/bash
+
+# This script compares startup time and memory usage of a model among weight loading modes
+#
+# - default            : weights are copied into heap at model loading
+# - USE_MMAPED_DATA    : weights are mmaped, but kernels prepare(prepack) them at compilation
+# - LAZY_WEIGHT_PAGING : weights are mmaped and paged in on first use with madvise hints,
+#                        and kernels prepare them at the first run
+#
+# Usage
+# ```
+# $ ./benchmark_lazy_weights.sh --nnpackage=/path/to/nnpkg --backends=cpu --num_runs=5
+# ```
+#
+# Page cache is not dropped by default. Run as root with --drop_caches to measure cold start.
+
+SCRIPT_ROOT="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+
+ONERT_RUN=$SCRIPT_ROOT/../../Product/out/bin/onert_run
+BACKENDS=cpu
+NUM_RUNS=5
+DROP_CACHES=0
+
+function Usage()
+{
+    echo "Usage: ./benchmark_lazy_weights.sh --nnpackage=/path/to/nnpkg [options]"
+    echo ""
+    echo "--nnpackage=<dir>         : directory containing nnpackage (or model file)"
+    echo "--onert_run=<path>        : path of onert_run (default: $ONERT_RUN)"
+    echo "--backends=<list>         : backend list (default: $BACKENDS)"
+    echo "--num_runs=<num>          : number of runs (default: $NUM_RUNS)"
+    echo "--drop_caches             : drop page cache before each mode (requires root)"
+}
+
+for i in "$@"
+do
+    case $i in
+        -h|--help|help)
+            Usage
+            exit 1
+            ;;
+        --nnpackage=*)
+            NNPKG_PATH=${i#*=}
+            ;;
+        --onert_run=*)
+            ONERT_RUN=${i#*=}
+            ;;
+        --backends=*)
+            BACKENDS=${i#*=}
+            ;;
+        --num_runs=*)
+            NUM_RUNS=${i#*=}
+            ;;
+        --drop_caches)
+            DROP_CACHES=1
+            ;;
+    esac
+    shift
+done
+
+if [ -z "$NNPKG_PATH" ]; then
+    Usage
+    exit 1
+fi
+
+if [ ! -x "$ONERT_RUN" ]; then
+    echo "onert_run is not found: $ONERT_RUN"
+    exit 1
+fi
+
+function RunMode()
+{
+    local MODE=$1
+    shift
+
+    if [ $DROP_CACHES -eq 1 ]; then
+        sync
+        echo 3 > /proc/sys/vm/drop_caches
+    fi
+
+    echo "[ $MODE ]"
+    env BACKENDS=$BACKENDS "$@" $ONERT_RUN -m -w 1 -r $NUM_RUNS $NNPKG_PATH \
+        | grep -E "^(MODEL_LOAD|PREPARE|EXECUTE|RSS|HWM|PSS)|^- |^Used Peak Memory"
+    echo ""
+}
+
+RunMode "default"
+RunMode "USE_MMAPED_DATA" USE_MMAPED_DATA=1
+RunMode "LAZY_WEIGHT_PAGING" LAZY_WEIGHT_PAGING=1
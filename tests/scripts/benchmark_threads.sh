@@ -0,0 +1,74 @@
+#!/bin/bash
+
+# This script compares execution time of a model among numbers of cpu backend threads
+#
+# Kernels of cpu backend share a thread pool whose size is NUM_THREADS. Besides Conv and
+# FullyConnected, elementwise kernels (BinaryArithmetic, ElementwiseActivation and
+# ElementwiseUnary) split large tensors over the pool, so models with large elementwise ops
+# show how they scale.
+#
+# Usage
+# ```
+# $ ./benchmark_threads.sh --nnpackage=/path/to/nnpkg --threads="1 2 4 8 16" --num_runs=10
+# ```
+
+SCRIPT_ROOT="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+
+ONERT_RUN=$SCRIPT_ROOT/../../Product/out/bin/onert_run
+BACKENDS=cpu
+NUM_RUNS=10
+THREADS="1 2 4 8 16"
+
+function Usage()
+{
+    echo "Usage: ./benchmark_threads.sh --nnpackage=/path/to/nnpkg [options]"
+    echo ""
+    echo "--nnpackage=<dir>         : directory containing nnpackage (or model file)"
+    echo "--onert_run=<path>        : path of onert_run (default: $ONERT_RUN)"
+    echo "--backends=<list>         : backend list (default: $BACKENDS)"
+    echo "--num_runs=<num>          : number of runs (default: $NUM_RUNS)"
+    echo "--threads=<list>          : numbers of threads to run (default: \"$THREADS\")"
+}
+
+for i in "$@"
+do
+    case $i in
+        -h|--help|help)
+            Usage
+            exit 1
+            ;;
+        --nnpackage=*)
+            NNPKG_PATH=${i#*=}
+            ;;
+        --onert_run=*)
+            ONERT_RUN=${i#*=}
+            ;;
+        --backends=*)
+            BACKENDS=${i#*=}
+            ;;
+        --num_runs=*)
+            NUM_RUNS=${i#*=}
+            ;;
+        --threads=*)
+            THREADS=${i#*=}
+            ;;
+    esac
+    shift
+done
+
+if [ -z "$NNPKG_PATH" ]; then
+    Usage
+    exit 1
+fi
+
+if [ ! -x "$ONERT_RUN" ]; then
+    echo "onert_run is not found: $ONERT_RUN"
+    exit 1
+fi
+
+for NUM_THREADS in $THREADS; do
+    echo "[ NUM_THREADS=$NUM_THREADS ]"
+    env BACKENDS=$BACKENDS NUM_THREADS=$NUM_THREADS $ONERT_RUN -w 1 -r $NUM_RUNS $NNPKG_PATH \
+        | grep -E "^- "
+    echo ""
+done
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file TransposeConv benchmark of cker kernels used by onert cpu backend
+ *
+ * Conv2D from OFM into IFM with the same kernel is measured together as a baseline,
+ * since it has the same amount of computation as TransposeConv from IFM into OFM.
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/Conv.h>
+#include <cker/operation/TransposeConv.h>
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nnfw::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 3);
+NONIUS_PARAM(IFM_H, 244);
+NONIUS_PARAM(IFM_W, 244);
+
+NONIUS_PARAM(OFM_C, 3);
+NONIUS_PARAM(OFM_H, 244);
+NONIUS_PARAM(OFM_W, 244);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+int32_t calculatePadding(const std::string &padding_name, int32_t in_size, int32_t out_size,
+                         int32_t stride, int32_t ker_size)
+{
+  if (padding_name != "SAME")
+    return 0;
+  const int32_t needed_input = (out_size - 1) * stride + ker_size;
+  return std::max(0, needed_input - in_size) / 2;
+}
+
+struct Configuration
+{
+  Shape ifm_shape;
+  Shape ofm_shape;
+  Shape ker_shape;
+  Shape bias_shape;
+
+  TransposeConvParams params;
+  PaddingType padding_type;
+
+  Configuration(nonius::chronometer meter)
+  {
+    const int32_t batch = meter.param<BATCH>();
+    const int32_t ifm_C = meter.param<IFM_C>();
+    const int32_t ifm_H = meter.param<IFM_H>();
+    const int32_t ifm_W = meter.param<IFM_W>();
+    const int32_t ofm_C = meter.param<OFM_C>();
+    const int32_t ofm_H = meter.param<OFM_H>();
+    const int32_t ofm_W = meter.param<OFM_W>();
+    const int32_t ker_H = meter.param<KER_H>();
+    const int32_t ker_W = meter.param<KER_W>();
+
+    ifm_shape.ReplaceWith(Shape{batch, ifm_H, ifm_W, ifm_C});
+    ofm_shape.ReplaceWith(Shape{batch, ofm_H, ofm_W, ofm_C});
+    ker_shape.ReplaceWith(Shape{ofm_C, ker_H, ker_W, ifm_C});
+    bias_shape.ReplaceWith(Shape{ofm_C});
+
+    padding_type = meter.param<PADDING>() == "SAME" ? PaddingType::kSame : PaddingType::kValid;
+    params.stride_height = meter.param<STRIDE_H>();
+    params.stride_width = meter.param<STRIDE_W>();
+    // NOTE The padding calculation formula of TransposeConv is opposite to Conv.
+    //      So the location of ifm and ofm is changed.
+    params.padding_values.height =
+      calculatePadding(meter.param<PADDING>(), ofm_H, ifm_H, params.stride_height, ker_H);
+    params.padding_values.width =
+      calculatePadding(meter.param<PADDING>(), ofm_W, ifm_W, params.stride_width, ker_W);
+    params.float_activation_min = std::numeric_limits<float>::lowest();
+    params.float_activation_max = std::numeric_limits<float>::max();
+  }
+
+  // Conv2D from OFM into IFM, kernel is [IFM_C, KER_H, KER_W, OFM_C]
+  ConvParams conv_params() const
+  {
+    ConvParams conv_params;
+    conv_params.padding_type = padding_type;
+    conv_params.padding_values = params.padding_values;
+    conv_params.stride_width = params.stride_width;
+    conv_params.stride_height = params.stride_height;
+    conv_params.dilation_width_factor = 1;
+    conv_params.dilation_height_factor = 1;
+    conv_params.float_activation_min = params.float_activation_min;
+    conv_params.float_activation_max = params.float_activation_max;
+    return conv_params;
+  }
+  Shape conv_ker_shape() const
+  {
+    return Shape{ifm_shape.Dims(3), ker_shape.Dims(1), ker_shape.Dims(2), ofm_shape.Dims(3)};
+  }
+};
+
+void runTransposeConv(nonius::chronometer meter, bool use_reference, int num_threads)
+{
+  Configuration p{meter};
+
+  std::vector<float> ifm(p.ifm_shape.FlatSize(), 1.f);
+  std::vector<float> ofm(p.ofm_shape.FlatSize());
+  std::vector<float> ker(p.ker_shape.FlatSize(), 1.f);
+  std::vector<float> bias(p.bias_shape.FlatSize(), 0.f);
+
+  if (use_reference)
+  {
+    meter.measure([&](int) {
+      reference::TransposeConv(p.params, p.ifm_shape, ifm.data(), p.ker_shape, ker.data(),
+                               p.ofm_shape, ofm.data());
+    });
+    return;
+  }
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(num_threads);
+  TransposeConv kernel;
+  kernel.prepare(p.ker_shape, ker.data());
+
+  meter.measure([&](int) {
+    kernel(p.params, p.ifm_shape, ifm.data(), p.ker_shape, ker.data(), p.bias_shape, bias.data(),
+           p.ofm_shape, ofm.data(), &ruy_context);
+  });
+}
+
+int hardwareThreads() { return std::max(1u, std::thread::hardware_concurrency()); }
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CKER_TransposeConv_Reference",
+                       [](nonius::chronometer meter) { runTransposeConv(meter, true, 1); })
+
+NONIUS_LOCAL_BENCHMARK("CKER_TransposeConv_Gemm_1",
+                       [](nonius::chronometer meter) { runTransposeConv(meter, false, 1); })
+
+NONIUS_LOCAL_BENCHMARK("CKER_TransposeConv_Gemm_N", [](nonius::chronometer meter) {
+  runTransposeConv(meter, false, hardwareThreads());
+})
+
+NONIUS_LOCAL_BENCHMARK("CKER_Conv_Equivalent", [](nonius::chronometer meter) {
+  Configuration p{meter};
+  const Shape conv_ker_shape = p.conv_ker_shape();
+
+  std::vector<float> ifm(p.ofm_shape.FlatSize(), 1.f);
+  std::vector<float> ofm(p.ifm_shape.FlatSize());
+  std::vector<float> ker(conv_ker_shape.FlatSize(), 1.f);
+  std::vector<float> bias(p.ifm_shape.Dims(3), 0.f);
+  const Shape bias_shape{p.ifm_shape.Dims(3)};
+
+  const ConvParams params = p.conv_params();
+  Conv kernel;
+  bool is_replaced_weights = false;
+  kernel.prepareF32(conv_ker_shape, ker.data(), params.padding_type, is_replaced_weights, 1, 1);
+
+  meter.measure([&](int) {
+    kernel(params, p.ofm_shape, ifm.data(), conv_ker_shape, ker.data(), bias_shape, bias.data(),
+           p.ifm_shape, ofm.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
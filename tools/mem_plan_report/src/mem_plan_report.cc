@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Report the arena size each memory planner gives for a circle model, against the lower bound,
+// for each linearization order
+//
+// Claims and releases are replayed in the same way as basic::planTensors over the order of the
+// primary subgraph, both for the topological order and for the memory-aware order. Constants and
+// model inputs/outputs are not planned by backends, so they are left out. Dynamic tensors are left
+// out as well.
+
+#include "backend/basic/MemoryPlannerFactory.h"
+#include "compiler/Linear.h"
+#include "ir/Graph.h"
+#include "loader/CircleLoader.h"
+
+#include <arser/arser.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace onert;
+
+namespace
+{
+
+struct Event
+{
+  bool claim;
+  ir::OperandIndex index;
+  size_t size;
+};
+
+std::vector<Event> replay(const ir::Graph &graph, const std::vector<ir::OperationIndex> &order)
+{
+  std::vector<Event> events;
+  ir::OperandIndexMap<uint32_t> uses_map;
+  ir::OperandIndexMap<bool> planned;
+
+  auto io = graph.getInputs() + graph.getOutputs();
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    const auto &info = obj.info();
+    if (obj.isConstant() || info.isDynamic() || io.contains(ind))
+      return;
+
+    planned[ind] = true;
+    uses_map[ind] = obj.getUses().size();
+    if (!obj.getDef().valid())
+      events.push_back({true, ind, info.total_size()});
+  });
+
+  for (const auto &op_ind : order)
+  {
+    const auto &op = graph.operations().at(op_ind);
+
+    for (const auto &ind : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (planned.count(ind))
+        events.push_back({true, ind, graph.operands().at(ind).info().total_size()});
+    }
+
+    for (const auto &ind : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (!planned.count(ind))
+        continue;
+      assert(uses_map[ind] > 0);
+      if (--uses_map[ind] == 0)
+        events.push_back({false, ind, 0});
+    }
+  }
+
+  return events;
+}
+
+size_t lowerBound(const std::vector<Event> &events)
+{
+  ir::OperandIndexMap<size_t> live;
+  size_t live_size = 0;
+  size_t peak = 0;
+  for (const auto &event : events)
+  {
+    if (event.claim)
+    {
+      live[event.index] = event.size;
+      live_size += event.size;
+      peak = std::max(peak, live_size);
+    }
+    else
+    {
+      live_size -= live[event.index];
+    }
+  }
+  return peak;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  arser::Arser arser{"Report planned arena size of memory planners for a circle model"};
+  arser.add_argument("model").type(arser::DataType::STR).help("circle model path");
+  arser.add_argument("--planner")
+    .nargs(1)
+    .accumulated(true)
+    .type(arser::DataType::STR)
+    .help("Planner to report, can be given several times (default: Bump FirstFit WIC Lifetime)");
+
+  try
+  {
+    arser.parse(argc, argv);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << e.what() << std::endl;
+    std::cout << arser;
+    return 255;
+  }
+
+  std::vector<std::string> planners{"Bump", "FirstFit", "WIC", "Lifetime"};
+  if (arser["--planner"])
+    planners = arser.get<std::vector<std::string>>("--planner");
+
+  std::unique_ptr<ir::Model> model;
+  try
+  {
+    model = loader::loadCircleModel(arser.get<std::string>("model"));
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Failed to load model : " << e.what() << std::endl;
+    return 255;
+  }
+
+  auto graph = std::dynamic_pointer_cast<ir::Graph>(model->primary_subgraph());
+  if (graph == nullptr)
+  {
+    std::cerr << "Primary subgraph is not a plain graph" << std::endl;
+    return 255;
+  }
+
+  const std::vector<std::vector<Event>> events{
+    replay(*graph, compiler::Linear::linearize(*graph, false)),
+    replay(*graph, compiler::Linear::linearize(*graph, true))};
+
+  std::vector<size_t> lower_bounds;
+  for (const auto &order_events : events)
+    lower_bounds.emplace_back(lowerBound(order_events));
+
+  auto print_row = [&](const std::string &name, const std::vector<size_t> &sizes) {
+    std::cout << std::left << std::setw(12) << name << std::right;
+    for (size_t i = 0; i < sizes.size(); ++i)
+    {
+      // Ratios are against the lower bound of the topological order, the current default
+      const double ratio =
+        lower_bounds[0] == 0 ? 1.0 : static_cast<double>(sizes[i]) / lower_bounds[0];
+      std::cout << std::setw(14) << sizes[i] << std::setw(8) << std::fixed << std::setprecision(3)
+                << ratio;
+    }
+    std::cout << std::endl;
+  };
+
+  std::cout << std::left << std::setw(12) << "planner" << std::right << std::setw(22)
+            << "topological" << std::setw(22) << "memory-aware" << std::endl;
+  print_row("lower bound", lower_bounds);
+
+  for (const auto &key : planners)
+  {
+    std::vector<size_t> planned;
+    for (const auto &order_events : events)
+    {
+      std::unique_ptr<backend::basic::IMemoryPlanner<ir::OperandIndex>> planner{
+        backend::basic::MemoryPlannerFactory::get().create(key)};
+      for (const auto &event : order_events)
+      {
+        if (event.claim)
+          planner->claim(event.index, event.size);
+        else
+          planner->release(event.index);
+      }
+      planned.emplace_back(planner->capacity());
+    }
+    print_row(key, planned);
+  }
+
+  return 0;
+}